@@ -8,6 +8,7 @@
 #include "share/atm_process/atmosphere_process_group.hpp"
 #include "share/atm_process/atmosphere_process_dag.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/grid/remap/horiz_interp_remapper_data.hpp"
 #include "share/util/eamxx_time_stamp.hpp"
 #include "share/util/eamxx_timing.hpp"
 #include "share/util/eamxx_utils.hpp"
@@ -128,6 +129,13 @@ set_params(const ekat::ParameterList& atm_params)
 
   create_logger ();
 
+  // Optionally fence the device at timer start/stop, to get meaningful timings on GPU
+  set_timers_device_fence(m_atm_params.sublist("driver_options").get("fence_timers",false));
+
+  // Optionally cache the horiz remap data, so that later runs can skip reading large map files
+  HorizRemapperData::set_cache_dir(m_atm_params.sublist("driver_options").get<std::string>("horiz_remap_cache_dir",""),
+                                   m_atm_logger);
+
   m_ad_status |= s_params_set;
 }
 
@@ -782,13 +790,15 @@ void AtmosphereDriver::initialize_output_managers () {
     }
   }
 
-  // Setup output managers
+  // Setup output managers. Diagnostics are shared across all of them.
+  m_diag_registry = std::make_shared<DiagnosticRegistry>();
   for (auto& om : m_output_managers) {
     EKAT_REQUIRE_MSG(not om.is_restart(),
                      "Error! No restart output should be in m_output_managers. Model restart "
                      "output should be setup in m_restart_output_manager./n");
 
     om.set_logger(m_atm_logger);
+    om.set_diagnostic_registry(m_diag_registry);
     om.setup(m_field_mgr,m_grids_manager->get_grid_names());
   }
 
@@ -931,6 +941,18 @@ void AtmosphereDriver::restart_model ()
 
   m_atm_logger->info("    [EAMxx] Restart filename: " + filename);
 
+  // If pipelined, the restart fields are read by the scorpio background thread, while
+  // the ones already read are copied to device (see AtmosphereInput::read_variables)
+  const auto& io_params = m_atm_params.sublist("scorpio");
+  if (io_params.isSublist("model_restart") and
+      io_params.sublist("model_restart").get<bool>("pipelined_io",false)) {
+    scorpio::enable_async_tasks(1024);
+    if (not scorpio::async_tasks_enabled()) {
+      m_atm_logger->warn("    [EAMxx] WARNING! Pipelined restart reads require MPI_THREAD_MULTIPLE.\n"
+                         "      Restart fields will be read synchronously.");
+    }
+  }
+
   for (auto& gn : m_grids_manager->get_grid_names()) {
     if (fvphyshack and gn == "physics_gll") continue;
     if (not m_field_mgr->has_group("RESTART", gn)) {
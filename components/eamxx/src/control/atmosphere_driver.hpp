@@ -202,6 +202,9 @@ protected:
   std::shared_ptr<OutputManager>            m_restart_output_manager;
   std::list<OutputManager>                  m_output_managers;
 
+  // Diagnostics requested by multiple output streams are created/computed only once
+  std::shared_ptr<DiagnosticRegistry>       m_diag_registry;
+
   std::shared_ptr<ATMBufferManager>         m_memory_buffer;
   std::shared_ptr<SCDataManager>            m_surface_coupling_import_data_manager;
   std::shared_ptr<SCDataManager>            m_surface_coupling_export_data_manager;
@@ -0,0 +1,220 @@
+#include "diagnostics/field_at_pressure_levels.hpp"
+#include "share/util/eamxx_universal_constants.hpp"
+
+#include "ekat/std_meta/ekat_std_utils.hpp"
+#include "ekat/util/ekat_string_utils.hpp"
+#include "ekat/util/ekat_upper_bound.hpp"
+#include "ekat/util/ekat_units.hpp"
+
+namespace scream
+{
+
+namespace {
+
+// Locate p_tgt within the (increasing) pressure column [beg,beg+nlevs).
+// Returns false if p_tgt is out of bounds. Otherwise, the interpolated value is
+//   y(k0) + (y(k1)-y(k0))/dx * dp
+// which matches the formula used in FieldAtPressureLevel (including corner cases).
+KOKKOS_INLINE_FUNCTION
+bool locate (const Real* beg, const int nlevs, const Real p_tgt,
+             int& k0, int& k1, Real& dx, Real& dp)
+{
+  if (p_tgt<beg[0] or p_tgt>beg[nlevs-1]) {
+    return false;
+  }
+  k1 = ekat::upper_bound(beg,beg+nlevs,p_tgt) - beg;
+  if (k1==0 or k1==nlevs) {
+    // Corner case: p_tgt==x(0) or p_tgt==x(nlevs-1)
+    k1 = k0 = (k1==0 ? 0 : nlevs-1);
+    dx = 1;
+    dp = 0;
+  } else {
+    k0 = k1-1;
+    dx = beg[k1] - beg[k0];
+    dp = p_tgt - beg[k0];
+  }
+  return true;
+}
+
+} // anonymous namespace
+
+// =========================================================================================
+FieldAtPressureLevels::
+FieldAtPressureLevels (const ekat::Comm& comm, const ekat::ParameterList& params)
+ : AtmosphereDiagnostic(comm,params)
+{
+  m_field_name = m_params.get<std::string>("field_name");
+
+  const auto units = m_params.get<std::string>("pressure_units");
+  EKAT_REQUIRE_MSG (units=="mb" or units=="hPa" or units=="Pa",
+      "Error! Invalid units for FieldAtPressureLevels.\n"
+      " - input units: " + units + "\n"
+      " - valid units: 'mb', 'hPa', 'Pa'\n");
+
+  // Figure out the pressure values (separated by '_'), and convert to Pa if needed
+  auto p_values = m_params.get<std::string>("pressure_values");
+  for (const auto& p : ekat::split(p_values,'_')) {
+    if (units=="mb" || units=="hPa") {
+      m_pressure_levels.push_back(std::stod(p)*100);
+    } else {
+      m_pressure_levels.push_back(std::stod(p));
+    }
+  }
+  EKAT_REQUIRE_MSG (m_pressure_levels.size()>0,
+      "Error! No pressure level provided to FieldAtPressureLevels.\n"
+      " - field name: " + m_field_name + "\n");
+
+  m_diag_name = m_field_name + "_at_" + p_values + units;
+}
+
+void FieldAtPressureLevels::
+set_grids (const std::shared_ptr<const GridsManager> grids_manager)
+{
+  const auto& gname = m_params.get<std::string>("grid_name");
+  add_field<Required>(m_field_name,gname);
+
+  // We don't know yet which one we need
+  add_field<Required>("p_mid",gname);
+  add_field<Required>("p_int",gname);
+}
+
+void FieldAtPressureLevels::
+initialize_impl (const RunType /*run_type*/)
+{
+  const auto& f = get_field_in(m_field_name);
+  const auto& fid = f.get_header().get_identifier();
+
+  // Sanity checks
+  using namespace ShortFieldTagsNames;
+  const auto& layout = fid.get_layout();
+  EKAT_REQUIRE_MSG (layout.rank()>=2 && layout.rank()<=3,
+      "Error! Field rank not supported by FieldAtPressureLevels.\n"
+      " - field name: " + fid.name() + "\n"
+      " - field layout: " + layout.to_string() + "\n");
+  const auto tag = layout.tags().back();
+  EKAT_REQUIRE_MSG (tag==LEV || tag==ILEV,
+      "Error! FieldAtPressureLevels diagnostic expects a layout ending with 'LEV'/'ILEV' tag.\n"
+      " - field name  : " + fid.name() + "\n"
+      " - field layout: " + layout.to_string() + "\n");
+
+  // All good, create the diag output
+  const int num_plevs = m_pressure_levels.size();
+  auto d_layout = layout.clone().strip_dim(tag).append_dim(CMP,num_plevs,"plev");
+  FieldIdentifier d_fid (m_diag_name,d_layout,fid.get_units(),fid.get_grid_name());
+  m_diagnostic_output = Field(d_fid);
+  m_diagnostic_output.allocate_view();
+
+  m_pressure_name = tag==LEV ? "p_mid" : "p_int";
+  m_num_levs = layout.dims().back();
+  auto num_cols = layout.dims().front();
+
+  // Copy target levels on device
+  m_p_tgt = KT::view_1d<Real>("p_tgt",num_plevs);
+  auto p_tgt_h = Kokkos::create_mirror_view(m_p_tgt);
+  for (int ip=0; ip<num_plevs; ++ip) {
+    p_tgt_h(ip) = m_pressure_levels[ip];
+  }
+  Kokkos::deep_copy(m_p_tgt,p_tgt_h);
+
+  // Add a field representing the mask as extra data to the diagnostic field.
+  // The mask only depends on the pressure field and the target levels, so we name it
+  // after those: remappers will then treat masks of different diags as the same field.
+  auto nondim = ekat::units::Units::nondimensional();
+  const auto& gname = fid.get_grid_name();
+  m_mask_val = m_params.get<double>("mask_value",Real(constants::DefaultFillValue<float>::value));
+
+  std::string mask_name = m_pressure_name + "_at_" + m_params.get<std::string>("pressure_values")
+                        + m_params.get<std::string>("pressure_units") + " mask";
+  FieldLayout mask_layout( {COL,CMP}, {num_cols,num_plevs}, {e2str(COL),"plev"});
+  FieldIdentifier mask_fid (mask_name,mask_layout, nondim, gname);
+  Field diag_mask(mask_fid);
+  diag_mask.allocate_view();
+  m_diagnostic_output.get_header().set_extra_data("mask_data",diag_mask);
+  m_diagnostic_output.get_header().set_extra_data("mask_value",m_mask_val);
+
+  using stratts_t = std::map<std::string,std::string>;
+
+  // Propagate any io string attribute from input field to diag field
+  const auto& src = get_fields_in().front();
+  const auto& src_atts = src.get_header().get_extra_data<stratts_t>("io: string attributes");
+        auto& dst_atts = m_diagnostic_output.get_header().get_extra_data<stratts_t>("io: string attributes");
+  for (const auto& [name, val] : src_atts) {
+    dst_atts[name] = val;
+  }
+}
+
+// =========================================================================================
+void FieldAtPressureLevels::compute_diagnostic_impl()
+{
+  using MemberType = typename KT::MemberType;
+
+  //This is 2D source pressure
+  const Field& p_src = get_field_in(m_pressure_name);
+  const auto p_src_v = p_src.get_view<const Real**>();
+  const Field& f = get_field_in(m_field_name);
+
+  // The setup for interpolation varies depending on the rank of the input field:
+  const int rank = f.rank();
+
+  const auto& pl = p_src.get_header().get_identifier().get_layout();
+  const int ncols = pl.dim(0);
+  const int nlevs = pl.dim(1);
+  const int nplevs = m_p_tgt.extent(0);
+
+  auto p_tgt = m_p_tgt;
+  auto mval = m_mask_val;
+  auto mask = m_diagnostic_output.get_header().get_extra_data<Field>("mask_data").get_view<Real**>();
+
+  // One team per column: each target level is located once, and (for vector fields)
+  // the result is reused for all components.
+  if (rank==2) {
+    auto policy = KT::TeamPolicy(ncols,Kokkos::AUTO);
+    auto diag = m_diagnostic_output.get_view<Real**>();
+    auto f_v  = f.get_view<const Real**>();
+    Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const MemberType& team) {
+      const int icol = team.league_rank();
+      auto x1 = ekat::subview(p_src_v,icol);
+      auto y1 = ekat::subview(f_v,icol);
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(team,nplevs),[&](const int ip) {
+        int k0, k1;
+        Real dx, dp;
+        if (locate(x1.data(),nlevs,p_tgt(ip),k0,k1,dx,dp)) {
+          diag(icol,ip) = y1(k0) + (y1(k1)-y1(k0))/dx * dp;
+          mask(icol,ip) = 1;
+        } else {
+          diag(icol,ip) = mval;
+          mask(icol,ip) = 0;
+        }
+      });
+    });
+  } else if (rank==3) {
+    const int ndims = f.get_header().get_identifier().get_layout().dim(1);
+    auto policy = KT::TeamPolicy(ncols,Kokkos::AUTO,Kokkos::AUTO);
+    auto diag = m_diagnostic_output.get_view<Real***>();
+    auto f_v  = f.get_view<const Real***>();
+    Kokkos::parallel_for(policy,KOKKOS_LAMBDA(const MemberType& team) {
+      const int icol = team.league_rank();
+      auto x1 = ekat::subview(p_src_v,icol);
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(team,nplevs),[&](const int ip) {
+        int k0, k1;
+        Real dx, dp;
+        const bool found = locate(x1.data(),nlevs,p_tgt(ip),k0,k1,dx,dp);
+        Kokkos::parallel_for(Kokkos::ThreadVectorRange(team,ndims),[&](const int idim) {
+          if (found) {
+            auto y1 = ekat::subview(f_v,icol,idim);
+            diag(icol,idim,ip) = y1(k0) + (y1(k1)-y1(k0))/dx * dp;
+          } else {
+            diag(icol,idim,ip) = mval;
+          }
+        });
+        Kokkos::single(Kokkos::PerThread(team),[&]{
+          mask(icol,ip) = found ? 1 : 0;
+        });
+      });
+    });
+  } else {
+    EKAT_ERROR_MSG("Error! field at pressure levels only supports fields ranks 2 and 3 \n");
+  }
+}
+
+} //namespace scream
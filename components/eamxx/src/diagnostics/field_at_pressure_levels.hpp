@@ -0,0 +1,56 @@
+#ifndef EAMXX_FIELD_AT_PRESSURE_LEVELS_HPP
+#define EAMXX_FIELD_AT_PRESSURE_LEVELS_HPP
+
+#include "share/atm_process/atmosphere_diagnostic.hpp"
+
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * This diagnostic will produce slices of a field at multiple pressure levels
+ *
+ * It is equivalent to N FieldAtPressureLevel diagnostics, but the output is a
+ * single field, with a trailing "plev" dimension. Levels are located and
+ * interpolated in one kernel, rather than in N separate ones.
+ * The mask (COL,PLEV) depends only on the source pressure and the target
+ * levels, so all diags with the same set of levels produce the same mask.
+ */
+
+class FieldAtPressureLevels : public AtmosphereDiagnostic
+{
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+
+  // Constructors
+  FieldAtPressureLevels (const ekat::Comm& comm, const ekat::ParameterList& params);
+
+  // The name of the diagnostic CLASS (not the computed field)
+  std::string name () const { return "FieldAtPressureLevels"; }
+
+  // Set the grid
+  void set_grids (const std::shared_ptr<const GridsManager> grids_manager);
+
+protected:
+#ifdef KOKKOS_ENABLE_CUDA
+public:
+#endif
+  void compute_diagnostic_impl ();
+protected:
+  void initialize_impl (const RunType /*run_type*/);
+
+  std::string         m_pressure_name;
+  std::string         m_field_name;
+  std::string         m_diag_name;
+
+  std::vector<Real>   m_pressure_levels;
+  KT::view_1d<Real>   m_p_tgt;
+  int                 m_num_levs;
+  Real                m_mask_val;
+
+}; // class FieldAtPressureLevels
+
+} //namespace scream
+
+#endif // EAMXX_FIELD_AT_PRESSURE_LEVELS_HPP
@@ -59,7 +59,8 @@ void HorizAvgDiag::compute_diagnostic_impl() {
   const auto &f = get_fields_in().front();
   const auto &d = m_diagnostic_output;
   // Call the horiz_contraction impl that will take care of everything
-  horiz_contraction<Real>(d, f, m_scaled_area, &m_comm);
+  // (except the allreduce, if the caller will do it)
+  horiz_contraction<Real>(d, f, m_scaled_area, m_defer_global_sum ? nullptr : &m_comm);
 }
 
 }  // namespace scream
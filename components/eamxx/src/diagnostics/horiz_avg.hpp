@@ -22,6 +22,9 @@ class HorizAvgDiag : public AtmosphereDiagnostic {
   // Set the grid
   void set_grids(const std::shared_ptr<const GridsManager> grids_manager);
 
+  // The output is a contraction over the local columns, summed across ranks
+  bool can_defer_global_sum() const { return true; }
+
  protected:
 #ifdef KOKKOS_ENABLE_CUDA
  public:
@@ -0,0 +1,142 @@
+#include "catch2/catch.hpp"
+
+#include "diagnostics/field_at_pressure_levels.hpp"
+#include "diagnostics/field_at_pressure_level.hpp"
+
+#include "share/grid/mesh_free_grids_manager.hpp"
+#include "share/field/field_utils.hpp"
+#include "share/util/eamxx_setup_random_test.hpp"
+
+#include "ekat/util/ekat_string_utils.hpp"
+
+namespace scream {
+
+std::shared_ptr<GridsManager>
+create_gm (const ekat::Comm& comm, const int ncols, const int nlevs) {
+
+  const int num_global_cols = ncols*comm.size();
+
+  auto gm = create_mesh_free_grids_manager(comm,0,0,nlevs,num_global_cols);
+  gm->build_grids();
+
+  return gm;
+}
+
+template<typename DiagType>
+std::shared_ptr<AtmosphereDiagnostic>
+create_diag (const ekat::Comm& comm,
+             const std::shared_ptr<const GridsManager>& gm,
+             const std::shared_ptr<const FieldManager>& fm,
+             const std::string& fname,
+             const std::string& pname,
+             const std::string& pvalues)
+{
+  ekat::ParameterList params;
+  params.set("field_name",fname);
+  params.set("grid_name",fm->get_grid()->name());
+  params.set(pname,pvalues);
+  params.set("pressure_units",std::string("Pa"));
+  auto diag = std::make_shared<DiagType>(comm,params);
+  diag->set_grids(gm);
+  for (const auto& req : diag->get_required_field_requests()) {
+    diag->set_required_field(fm->get_field(req.fid));
+  }
+  diag->initialize(util::TimeStamp(),RunType::Initial);
+  return diag;
+}
+
+TEST_CASE("field_at_pressure_levels")
+{
+  using namespace ShortFieldTagsNames;
+  using namespace ekat::units;
+  using FL = FieldLayout;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  const int ncols = 3;
+  const int nlevs = 10;
+  const int ndims = 2;
+  auto gm   = create_gm(comm,ncols,nlevs);
+  auto grid = gm->get_grid("point_grid");
+  const auto& gn = grid->name();
+
+  auto engine = scream::setup_random_test(&comm);
+  using RPDF = std::uniform_real_distribution<Real>;
+  RPDF pdf_f(0,1);
+
+  // Pressure increasing from 100mb to 1000mb, slightly different in each column
+  auto fm = std::make_shared<FieldManager>(grid);
+  FieldIdentifier fid_pm("p_mid",FL({COL,LEV},{ncols,nlevs}),Pa,gn);
+  FieldIdentifier fid_pi("p_int",FL({COL,ILEV},{ncols,nlevs+1}),Pa,gn);
+  FieldIdentifier fid_v ("V",FL({COL,CMP,LEV},{ncols,ndims,nlevs}),m,gn);
+  FieldIdentifier fid_s ("S",FL({COL,ILEV},{ncols,nlevs+1}),m,gn);
+  fm->register_field(FieldRequest(fid_pm,SCREAM_PACK_SIZE));
+  fm->register_field(FieldRequest(fid_pi,SCREAM_PACK_SIZE));
+  fm->register_field(FieldRequest(fid_v,SCREAM_PACK_SIZE));
+  fm->register_field(FieldRequest(fid_s,SCREAM_PACK_SIZE));
+  fm->registration_ends();
+
+  auto p_mid = fm->get_field("p_mid");
+  auto p_int = fm->get_field("p_int");
+  auto pm_h = p_mid.get_view<Real**,Host>();
+  auto pi_h = p_int.get_view<Real**,Host>();
+  for (int icol=0; icol<ncols; ++icol) {
+    const Real p_top = 10000 + 100*icol;
+    const Real dp = (100000-p_top)/nlevs;
+    for (int k=0; k<=nlevs; ++k) {
+      pi_h(icol,k) = p_top + k*dp;
+      if (k<nlevs)
+        pm_h(icol,k) = p_top + (k+0.5)*dp;
+    }
+  }
+  p_mid.sync_to_dev();
+  p_int.sync_to_dev();
+  randomize(fm->get_field("V"),engine,pdf_f);
+  randomize(fm->get_field("S"),engine,pdf_f);
+  fm->init_fields_time_stamp(util::TimeStamp({2022,1,1},{0,0,0}));
+
+  // Include levels out of bounds, at the boundaries, and in the interior.
+  const std::vector<std::string> plevs = {"5000","10000","25000","50000.5","85000","100000","200000"};
+  const std::string pvalues = ekat::join(plevs,"_");
+  const int nplevs = plevs.size();
+
+  for (std::string fname : {"V","S"}) {
+    auto diag = create_diag<FieldAtPressureLevels>(comm,gm,fm,fname,"pressure_values",pvalues);
+    diag->compute_diagnostic();
+    auto d = diag->get_diagnostic();
+    auto mask = d.get_header().get_extra_data<Field>("mask_data");
+
+    // Check output layout
+    const auto& d_layout = d.get_header().get_identifier().get_layout();
+    REQUIRE (d_layout.dims().back()==nplevs);
+    REQUIRE (d_layout.names().back()=="plev");
+    REQUIRE (d.name()==fname+"_at_"+pvalues+"Pa");
+
+    // Compare against single-level diags
+    d.sync_to_host();
+    mask.sync_to_host();
+    auto mask_h = mask.get_view<const Real**,Host>();
+    for (int ip=0; ip<nplevs; ++ip) {
+      auto diag1 = create_diag<FieldAtPressureLevel>(comm,gm,fm,fname,"pressure_value",plevs[ip]);
+      diag1->compute_diagnostic();
+      auto d1 = diag1->get_diagnostic();
+      auto mask1 = d1.get_header().get_extra_data<Field>("mask_data");
+      d1.sync_to_host();
+      mask1.sync_to_host();
+      auto mask1_h = mask1.get_view<const Real*,Host>();
+
+      for (int icol=0; icol<ncols; ++icol) {
+        REQUIRE (mask_h(icol,ip)==mask1_h(icol));
+        if (d.rank()==2) {
+          REQUIRE (d.get_view<const Real**,Host>()(icol,ip)==d1.get_view<const Real*,Host>()(icol));
+        } else {
+          for (int idim=0; idim<ndims; ++idim) {
+            REQUIRE (d.get_view<const Real***,Host>()(icol,idim,ip)==d1.get_view<const Real**,Host>()(icol,idim));
+          }
+        }
+      }
+    }
+  }
+}
+
+} // namespace scream
@@ -1,5 +1,6 @@
 #include "catch2/catch.hpp"
 #include "diagnostics/register_diagnostics.hpp"
+#include "share/field/field_reduction_batch.hpp"
 #include "share/field/field_utils.hpp"
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/util/eamxx_setup_random_test.hpp"
@@ -161,6 +162,16 @@ TEST_CASE("horiz_avg") {
   diag3->compute_diagnostic();
   auto diag3_f = diag3->get_diagnostic();
   REQUIRE(views_are_equal(diag3_f, diag3_manual));
+
+  // Defer the allreduce, and do it with a batch, like DiagnosticRegistry does
+  REQUIRE(diag3->can_defer_global_sum());
+  FieldReductionBatch batch(comm);
+  batch.add_all_reduce(diag3_f);
+  diag3_f.deep_copy(0);
+  diag3->compute_diagnostic(0, true);
+  batch.start();
+  batch.finish();
+  REQUIRE(views_are_equal(diag3_f, diag3_manual));
 }
 
 }  // namespace scream
@@ -1,5 +1,6 @@
 #include "catch2/catch.hpp"
 #include "diagnostics/register_diagnostics.hpp"
+#include "share/field/field_reduction_batch.hpp"
 #include "share/field/field_utils.hpp"
 #include "share/grid/mesh_free_grids_manager.hpp"
 #include "share/util/eamxx_setup_random_test.hpp"
@@ -192,6 +193,16 @@ TEST_CASE("zonal_avg") {
   diag3->compute_diagnostic();
   auto diag3_field = diag3->get_diagnostic();
   REQUIRE(views_are_equal(diag3_field, diag3m_field));
+
+  // Defer the allreduce, and do it with a batch, like DiagnosticRegistry does
+  REQUIRE(diag3->can_defer_global_sum());
+  FieldReductionBatch batch(comm);
+  batch.add_all_reduce(diag3_field);
+  diag3_field.deep_copy(0);
+  diag3->compute_diagnostic(0, true);
+  batch.start();
+  batch.finish();
+  REQUIRE(views_are_equal(diag3_field, diag3m_field));
 }
 
 } // namespace scream
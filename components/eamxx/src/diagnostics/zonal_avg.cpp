@@ -2,39 +2,37 @@
 
 #include "share/field/field_utils.hpp"
 
-#include <ekat/util/ekat_math_utils.hpp>
+#include <algorithm>
+#include <vector>
 
 namespace scream {
 
-void ZonalAvgDiag::compute_zonal_sum(const Field &result, const Field &field, const Field &weight,
-                                     const Field &lat, const ekat::Comm *comm) {
+void ZonalAvgDiag::compute_zonal_sum(const Field &result, const Field &field) const {
   auto result_layout       = result.get_header().get_identifier().get_layout();
   const int num_zonal_bins = result_layout.dim(0);
   const int ncols          = field.get_header().get_identifier().get_layout().dim(0);
-  const Real lat_delta     = sp(180.0) / num_zonal_bins;
 
-  auto weight_view = weight.get_view<const Real *>();
-  auto lat_view    = lat.get_view<const Real *>();
-  using KT         = ekat::KokkosTypes<DefaultDevice>;
+  auto bin_offsets = m_bin_offsets;
+  auto bin_cols    = m_bin_cols;
+  auto bin_weights = m_bin_weights;
   using TeamPolicy = Kokkos::TeamPolicy<Field::device_t::execution_space>;
   using TeamMember = typename TeamPolicy::member_type;
   using ESU        = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+  // Each team only loops over the columns of its bin, so use the avg bin size as team size hint
+  const int bin_size_hint = std::max(ncols / num_zonal_bins, 1);
   switch (result_layout.rank()) {
   case 1: {
     auto field_view        = field.get_view<const Real *>();
     auto result_view       = result.get_view<Real *>();
-    TeamPolicy team_policy = ESU::get_default_team_policy(num_zonal_bins, ncols);
+    TeamPolicy team_policy = ESU::get_default_team_policy(num_zonal_bins, bin_size_hint);
     Kokkos::parallel_for(
         "compute_zonal_sum_" + field.name(), team_policy, KOKKOS_LAMBDA(const TeamMember &tm) {
-          const int lat_i      = tm.league_rank();
-          const Real lat_lower = sp(-90.0) + lat_i * lat_delta;
-          const Real lat_upper = lat_lower + lat_delta;
+          const int lat_i = tm.league_rank();
+          const int beg   = bin_offsets(lat_i);
           Kokkos::parallel_reduce(
-              Kokkos::TeamVectorRange(tm, ncols),
-              [&](int i, Real &val) {
-                // TODO: check if tenary is ok here (if not, multiply by flag)
-                int flag = (lat_lower <= lat_view(i)) && (lat_view(i) < lat_upper);
-                val += flag ? weight_view(i) * field_view(i) : sp(0.0);
+              Kokkos::TeamVectorRange(tm, bin_offsets(lat_i + 1) - beg),
+              [&](int k, Real &val) {
+                val += bin_weights(beg + k) * field_view(bin_cols(beg + k));
               },
               result_view(lat_i));
         });
@@ -43,20 +41,17 @@ void ZonalAvgDiag::compute_zonal_sum(const Field &result, const Field &field, co
     const int d1           = result_layout.dim(1);
     auto field_view        = field.get_view<const Real **>();
     auto result_view       = result.get_view<Real **>();
-    TeamPolicy team_policy = ESU::get_default_team_policy(num_zonal_bins * d1, ncols);
+    TeamPolicy team_policy = ESU::get_default_team_policy(num_zonal_bins * d1, bin_size_hint);
     Kokkos::parallel_for(
         "compute_zonal_sum_" + field.name(), team_policy, KOKKOS_LAMBDA(const TeamMember &tm) {
-          const int idx        = tm.league_rank();
-          const int d1_i       = idx / num_zonal_bins;
-          const int lat_i      = idx % num_zonal_bins;
-          const Real lat_lower = sp(-90.0) + lat_i * lat_delta;
-          const Real lat_upper = lat_lower + lat_delta;
+          const int idx   = tm.league_rank();
+          const int d1_i  = idx / num_zonal_bins;
+          const int lat_i = idx % num_zonal_bins;
+          const int beg   = bin_offsets(lat_i);
           Kokkos::parallel_reduce(
-              Kokkos::TeamVectorRange(tm, ncols),
-              [&](int i, Real &val) {
-                int flag = (lat_lower <= lat_view(i)) && (lat_view(i) < lat_upper);
-                // TODO: check if tenary is ok here (if not, multiply by flag)
-                val += flag ? weight_view(i) * field_view(i, d1_i) : sp(0.0);
+              Kokkos::TeamVectorRange(tm, bin_offsets(lat_i + 1) - beg),
+              [&](int k, Real &val) {
+                val += bin_weights(beg + k) * field_view(bin_cols(beg + k), d1_i);
               },
               result_view(lat_i, d1_i));
         });
@@ -66,22 +61,19 @@ void ZonalAvgDiag::compute_zonal_sum(const Field &result, const Field &field, co
     const int d2           = result_layout.dim(2);
     auto field_view        = field.get_view<const Real ***>();
     auto result_view       = result.get_view<Real ***>();
-    TeamPolicy team_policy = ESU::get_default_team_policy(num_zonal_bins * d1 * d2, ncols);
+    TeamPolicy team_policy = ESU::get_default_team_policy(num_zonal_bins * d1 * d2, bin_size_hint);
     Kokkos::parallel_for(
         "compute_zonal_sum_" + field.name(), team_policy, KOKKOS_LAMBDA(const TeamMember &tm) {
-          const int idx        = tm.league_rank();
-          const int d1_i       = idx / (num_zonal_bins * d2);
-          const int idx2       = idx % (num_zonal_bins * d2);
-          const int d2_i       = idx2 / num_zonal_bins;
-          const int lat_i      = idx2 % num_zonal_bins;
-          const Real lat_lower = sp(-90.0) + lat_i * lat_delta;
-          const Real lat_upper = lat_lower + lat_delta;
+          const int idx   = tm.league_rank();
+          const int d1_i  = idx / (num_zonal_bins * d2);
+          const int idx2  = idx % (num_zonal_bins * d2);
+          const int d2_i  = idx2 / num_zonal_bins;
+          const int lat_i = idx2 % num_zonal_bins;
+          const int beg   = bin_offsets(lat_i);
           Kokkos::parallel_reduce(
-              Kokkos::TeamVectorRange(tm, ncols),
-              [&](int i, Real &val) {
-                int flag = (lat_lower <= lat_view(i)) && (lat_view(i) < lat_upper);
-                // TODO: check if tenary is ok here (if not, multiply by flag)
-                val += flag ? weight_view(i) * field_view(i, d1_i, d2_i) : sp(0.0);
+              Kokkos::TeamVectorRange(tm, bin_offsets(lat_i + 1) - beg),
+              [&](int k, Real &val) {
+                val += bin_weights(beg + k) * field_view(bin_cols(beg + k), d1_i, d2_i);
               },
               result_view(lat_i, d1_i, d2_i));
         });
@@ -90,16 +82,76 @@ void ZonalAvgDiag::compute_zonal_sum(const Field &result, const Field &field, co
     EKAT_ERROR_MSG("Error! Unsupported field rank for zonal averages.\n");
   }
 
-  if (comm) {
-    // TODO: use device-side MPI calls
-    // TODO: the dev ptr causes problems; revisit this later
-    // TODO: doing cuda-aware MPI allreduce would be ~10% faster
-    Kokkos::fence();
-    result.sync_to_host();
-    comm->all_reduce(result.template get_internal_view_data<Real, Host>(), result_layout.size(),
-                     MPI_SUM);
-    result.sync_to_dev();
+  // If the caller batches the reductions of many diags, it will do the allreduce
+  if (m_defer_global_sum) {
+    return;
   }
+
+  // The result is contiguous, so a single allreduce covers all bins and all other dims
+  // TODO: use device-side MPI calls
+  // TODO: the dev ptr causes problems; revisit this later
+  // TODO: doing cuda-aware MPI allreduce would be ~10% faster
+  Kokkos::fence();
+  result.sync_to_host();
+  m_comm.all_reduce(result.template get_internal_view_data<Real, Host>(), result_layout.size(),
+                    MPI_SUM);
+  result.sync_to_dev();
+}
+
+void ZonalAvgDiag::build_bin_map() {
+  const int ncols      = m_lat.get_header().get_identifier().get_layout().dim(0);
+  const int nbins      = m_num_zonal_bins;
+  const Real lat_delta = sp(180.0) / nbins;
+
+  auto lat_h  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), m_lat.get_view<const Real *>());
+  auto area_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), m_area.get_view<const Real *>());
+
+  // Find the bin(s) of each column. A column is in bin b if lat_lower <= lat < lat_upper, with
+  // lat_lower=-90+b*lat_delta and lat_upper=lat_lower+lat_delta. Due to roundoff, a column
+  // near a bin edge may be in zero or two bins, so check the bounds explicitly around the
+  // estimated bin. Columns are visited in increasing order, so they are sorted within each bin.
+  std::vector<std::vector<int>> cols_per_bin(nbins);
+  std::vector<Real> zonal_area(nbins, 0);
+  for (int i = 0; i < ncols; ++i) {
+    const int lat_i = static_cast<int>((lat_h(i) + sp(90.0)) / lat_delta);
+    for (int b = std::max(lat_i - 1, 0); b <= std::min(lat_i + 1, nbins - 1); ++b) {
+      const Real lat_lower = sp(-90.0) + b * lat_delta;
+      const Real lat_upper = lat_lower + lat_delta;
+      if (lat_lower <= lat_h(i) && lat_h(i) < lat_upper) {
+        cols_per_bin[b].push_back(i);
+        zonal_area[b] += area_h(i);
+      }
+    }
+  }
+
+  // Store the map in CSR format
+  m_bin_offsets  = KT::view_1d<int>("zonal_bin_offsets", nbins + 1);
+  auto offsets_h = Kokkos::create_mirror_view(m_bin_offsets);
+  offsets_h(0)   = 0;
+  for (int b = 0; b < nbins; ++b) {
+    offsets_h(b + 1) = offsets_h(b) + cols_per_bin[b].size();
+  }
+  const int nentries = offsets_h(nbins);
+  m_bin_cols         = KT::view_1d<int>("zonal_bin_cols", nentries);
+  m_bin_weights      = KT::view_1d<Real>("zonal_bin_weights", nentries);
+  auto cols_h        = Kokkos::create_mirror_view(m_bin_cols);
+  auto weights_h     = Kokkos::create_mirror_view(m_bin_weights);
+  for (int b = 0; b < nbins; ++b) {
+    std::copy(cols_per_bin[b].begin(), cols_per_bin[b].end(), cols_h.data() + offsets_h(b));
+  }
+
+  // Global zonal area, with a single allreduce for all bins
+  m_comm.all_reduce(zonal_area.data(), nbins, MPI_SUM);
+
+  for (int b = 0; b < nbins; ++b) {
+    for (int k = offsets_h(b); k < offsets_h(b + 1); ++k) {
+      weights_h(k) = area_h(cols_h(k)) / zonal_area[b];
+    }
+  }
+
+  Kokkos::deep_copy(m_bin_offsets, offsets_h);
+  Kokkos::deep_copy(m_bin_cols, cols_h);
+  Kokkos::deep_copy(m_bin_weights, weights_h);
 }
 
 ZonalAvgDiag::ZonalAvgDiag(const ekat::Comm &comm, const ekat::ParameterList &params)
@@ -117,8 +169,7 @@ void ZonalAvgDiag::set_grids(const std::shared_ptr<const GridsManager> grids_man
   add_field<Required>(field_name, grid_name);
   const GridsManager::grid_ptr_type grid = grids_manager->get_grid(grid_name);
   m_lat                                  = grid->get_geometry_data("lat");
-  // area will be scaled in initialize_impl
-  m_scaled_area = grid->get_geometry_data("area").clone();
+  m_area                                 = grid->get_geometry_data("area");
 }
 
 void ZonalAvgDiag::initialize_impl(const RunType /*run_type*/) {
@@ -152,41 +203,14 @@ void ZonalAvgDiag::initialize_impl(const RunType /*run_type*/) {
   m_diagnostic_output = Field(diagnostic_id);
   m_diagnostic_output.allocate_view();
 
-  // allocate zonal area
-  const FieldIdentifier &area_id = m_scaled_area.get_header().get_identifier();
-  FieldLayout zonal_area_layout({CMP}, {m_num_zonal_bins}, {"bin"});
-  FieldIdentifier zonal_area_id("zonal area", zonal_area_layout, area_id.get_units(),
-                                area_id.get_grid_name());
-  Field zonal_area(zonal_area_id);
-  zonal_area.allocate_view();
-
-  // compute zonal area
-  FieldLayout ones_layout = area_id.get_layout().clone();
-  FieldIdentifier ones_id("ones", ones_layout, area_id.get_units(), area_id.get_grid_name());
-  Field ones(ones_id);
-  ones.allocate_view();
-  ones.deep_copy(1.0);
-  compute_zonal_sum(zonal_area, m_scaled_area, ones, m_lat, &m_comm);
-
-  // scale area by 1 / zonal area
-  using RangePolicy     = Kokkos::RangePolicy<Field::device_t::execution_space>;
-  const Real lat_delta  = sp(180.0) / m_num_zonal_bins;
-  const int ncols       = field_layout.dim(0);
-  const int nbins       = m_num_zonal_bins;
-  auto lat_view         = m_lat.get_view<const Real *>();
-  auto zonal_area_view  = zonal_area.get_view<const Real *>();
-  auto scaled_area_view = m_scaled_area.get_view<Real *>();
-  Kokkos::parallel_for(
-      "scale_area_by_zonal_area_" + field.name(), RangePolicy(0, ncols),
-      KOKKOS_LAMBDA(const int &i) {
-        const int lat_i = ekat::impl::min(static_cast<int>((lat_view(i) + sp(90.0)) / lat_delta),nbins-1);
-        scaled_area_view(i) /= zonal_area_view(lat_i);
-      });
+  // Precompute the bin->columns map and the area weights, so that each
+  // evaluation only needs to visit each column once
+  build_bin_map();
 }
 
 void ZonalAvgDiag::compute_diagnostic_impl() {
   const auto &field = get_fields_in().front();
-  compute_zonal_sum(m_diagnostic_output, field, m_scaled_area, m_lat, &m_comm);
+  compute_zonal_sum(m_diagnostic_output, field);
 }
 
 } // namespace scream
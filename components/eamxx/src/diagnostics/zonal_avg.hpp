@@ -23,6 +23,10 @@ public:
   // Set the grid
   void set_grids(const std::shared_ptr<const GridsManager> grids_manager);
 
+  // The output is a sum of area-weighted local partial sums (the weights already use the
+  // global zonal areas), so the allreduce can be left to the caller
+  bool can_defer_global_sum() const { return true; }
+
 protected:
 #ifdef KOKKOS_ENABLE_CUDA
 public:
@@ -30,24 +34,34 @@ public:
   void initialize_impl(const RunType /*run_type*/);
   void compute_diagnostic_impl();
 
-  // TODO: make it a local function in the cpp file
-  // Utility to compute the contraction of a field along its column dimension.
-  // This is equivalent to f_out = einsum('i,i...k->...k', weight, f_in).
+  // Utility to compute the weighted sum of a field over the columns of each zonal bin.
   // The implementation is such that:
   // - all Field objects must be allocated
-  // - the first dimension for field, weight, and lat is for the columns (COL)
+  // - the first dimension for field is for the columns (COL)
   // - the first dimension for result is for the zonal bins (CMP,"bin")
   // - field and result must be the same dimension, up to 3
-  // TODO: make it a local function in the cpp file
-  static void compute_zonal_sum(const Field &result, const Field &field, const Field &weight,
-                                const Field &lat, const ekat::Comm *comm = nullptr);
+  // The sum is a segmented reduction over the bin->columns map (see build_bin_map),
+  // so its cost is O(ncols), rather than O(nbins*ncols).
+  // If m_defer_global_sum=true, the result only stores the local partial sums.
+  void compute_zonal_sum(const Field &result, const Field &field) const;
 
 protected:
+  using KT = ekat::KokkosTypes<DefaultDevice>;
+
+  // Build the CSR map bin->columns, and the area weights for each entry of the map
+  void build_bin_map();
+
   std::string m_diag_name;
   int m_num_zonal_bins;
 
   Field m_lat;
-  Field m_scaled_area;
+  Field m_area;
+
+  // CSR map: the columns in bin b are m_bin_cols(m_bin_offsets(b)), ..., m_bin_cols(m_bin_offsets(b+1)-1),
+  // and m_bin_weights stores area/zonal_area for each of them (in the same order)
+  KT::view_1d<int>  m_bin_offsets;
+  KT::view_1d<int>  m_bin_cols;
+  KT::view_1d<Real> m_bin_weights;
 };
 
 } // namespace scream
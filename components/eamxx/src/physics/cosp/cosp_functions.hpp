@@ -29,73 +29,112 @@ namespace scream {
         inline void finalize() {
             cosp_c2f_final();
         };
-        inline void main(
-                const Int ncol, const Int nsubcol, const Int nlay, const Int ntau, const Int nctp, const Int ncth, const Real emsfc_lw,
+        // Host LayoutLeft (i.e., Fortran order) copies of the COSP inputs/outputs
+        struct Workspace {
+            Workspace () = default;
+            Workspace (const Int ncol, const Int nlay, const Int ntau, const Int nctp, const Int ncth)
+             : sunlit("sunlit_h", ncol), skt("skt_h", ncol)
+             , T_mid("T_mid_h", ncol, nlay), p_mid("p_mid_h", ncol, nlay), p_int("p_int_h", ncol, nlay+1)
+             , z_mid("z_mid_h", ncol, nlay), qv("qv_h", ncol, nlay), qc("qc_h", ncol, nlay), qi("qi_h", ncol, nlay)
+             , cldfrac("cldfrac_h", ncol, nlay)
+             , reff_qc("reff_qc_h", ncol, nlay), reff_qi("reff_qi_h", ncol, nlay)
+             , dtau067("dtau_067_h", ncol, nlay), dtau105("dtau105_h", ncol, nlay)
+             , isccp_ctptau("isccp_ctptau_h", ncol, ntau, nctp)
+             , modis_ctptau("modis_ctptau_h", ncol, ntau, nctp)
+             , misr_cthtau("misr_cthtau_h", ncol, ntau, ncth)
+            {}
+
+            lview_host_1d sunlit, skt;
+            lview_host_2d T_mid, p_mid, p_int, z_mid, qv, qc, qi, cldfrac,
+                          reff_qc, reff_qi, dtau067, dtau105;
+            lview_host_3d isccp_ctptau, modis_ctptau, misr_cthtau;
+        };
+
+        // Copy the inputs in the workspace, permuting data as needed
+        inline void copy_inputs(
+                const Workspace& ws, const Int ncol, const Int nlay,
                 const view_1d<const Real>& sunlit , const view_1d<const Real>& skt,
                 const view_2d<const Real>& T_mid  , const view_2d<const Real>& p_mid  ,
                 const view_2d<const Real>& p_int,  const view_2d<const Real>& z_mid,
                 const view_2d<const Real>& qv     , const view_2d<const Real>& qc,
                 const view_2d<const Real>& qi, const view_2d<const Real>& cldfrac,
                 const view_2d<const Real>& reff_qc, const view_2d<const Real>& reff_qi,
-                const view_2d<const Real>& dtau067, const view_2d<const Real>& dtau105,
-                const view_1d<Real>& isccp_cldtot , const view_3d<Real>& isccp_ctptau,
-                const view_3d<Real>& modis_ctptau, const view_3d<Real>& misr_cthtau) {
-
-            // Make host copies and permute data as needed
-            lview_host_2d
-                  T_mid_h("T_mid_h", ncol, nlay), p_mid_h("p_mid_h", ncol, nlay), p_int_h("p_int_h", ncol, nlay+1),
-                  z_mid_h("z_mid_h", ncol, nlay), qv_h("qv_h", ncol, nlay), qc_h("qc_h", ncol, nlay), qi_h("qi_h", ncol, nlay),
-                  cldfrac_h("cldfrac_h", ncol, nlay),
-                  reff_qc_h("reff_qc_h", ncol, nlay), reff_qi_h("reff_qi_h", ncol, nlay),
-                  dtau067_h("dtau_067_h", ncol, nlay), dtau105_h("dtau105_h", ncol, nlay);
-            lview_host_3d isccp_ctptau_h("isccp_ctptau_h", ncol, ntau, nctp);
-            lview_host_3d modis_ctptau_h("modis_ctptau_h", ncol, ntau, nctp);
-            lview_host_3d misr_cthtau_h("misr_cthtau_h", ncol, ntau, ncth);
-
-            // Copy to layoutLeft host views
+                const view_2d<const Real>& dtau067, const view_2d<const Real>& dtau105) {
             for (int i = 0; i < ncol; i++) {
+                ws.sunlit(i) = sunlit(i);
+                ws.skt(i) = skt(i);
                 for (int j = 0; j < nlay; j++) {
-                    T_mid_h(i,j) = T_mid(i,j);
-                    p_mid_h(i,j) = p_mid(i,j);
-                    z_mid_h(i,j) = z_mid(i,j);
-                    qv_h(i,j) = qv(i,j);
-                    qc_h(i,j) = qc(i,j);
-                    qi_h(i,j) = qi(i,j);
-                    cldfrac_h(i,j) = cldfrac(i,j);
-                    reff_qc_h(i,j) = reff_qc(i,j);
-                    reff_qi_h(i,j) = reff_qi(i,j);
-                    dtau067_h(i,j) = dtau067(i,j);
-                    dtau105_h(i,j) = dtau105(i,j);
+                    ws.T_mid(i,j) = T_mid(i,j);
+                    ws.p_mid(i,j) = p_mid(i,j);
+                    ws.z_mid(i,j) = z_mid(i,j);
+                    ws.qv(i,j) = qv(i,j);
+                    ws.qc(i,j) = qc(i,j);
+                    ws.qi(i,j) = qi(i,j);
+                    ws.cldfrac(i,j) = cldfrac(i,j);
+                    ws.reff_qc(i,j) = reff_qc(i,j);
+                    ws.reff_qi(i,j) = reff_qi(i,j);
+                    ws.dtau067(i,j) = dtau067(i,j);
+                    ws.dtau105(i,j) = dtau105(i,j);
                 }
             }
             for (int i = 0; i < ncol; i++) {
                 for (int j = 0; j < nlay+1; j++) {
-                    p_int_h(i,j) = p_int(i,j);
+                    ws.p_int(i,j) = p_int(i,j);
                 }
             }
+        }
+
+        // Call COSP on the inputs stored in the workspace. This only touches the workspace
+        // and the output views, via host loops, so it can run on a separate host thread.
+        inline void run(
+                const Workspace& ws,
+                const Int ncol, const Int nsubcol, const Int nlay, const Int ntau, const Int nctp, const Int ncth, const Real emsfc_lw,
+                const view_1d<Real>& isccp_cldtot , const view_3d<Real>& isccp_ctptau,
+                const view_3d<Real>& modis_ctptau, const view_3d<Real>& misr_cthtau) {
 
             // Subsample here?
 
             // Call COSP wrapper
             cosp_c2f_run(ncol, nsubcol, nlay, ntau, nctp, ncth,
-                    emsfc_lw, sunlit.data(), skt.data(), T_mid_h.data(), p_mid_h.data(), p_int_h.data(),
-                    z_mid_h.data(), qv_h.data(), qc_h.data(), qi_h.data(),
-                    cldfrac_h.data(), reff_qc_h.data(), reff_qi_h.data(), dtau067_h.data(), dtau105_h.data(),
-                    isccp_cldtot.data(), isccp_ctptau_h.data(), modis_ctptau_h.data(), misr_cthtau_h.data());
+                    emsfc_lw, ws.sunlit.data(), ws.skt.data(), ws.T_mid.data(), ws.p_mid.data(), ws.p_int.data(),
+                    ws.z_mid.data(), ws.qv.data(), ws.qc.data(), ws.qi.data(),
+                    ws.cldfrac.data(), ws.reff_qc.data(), ws.reff_qi.data(), ws.dtau067.data(), ws.dtau105.data(),
+                    isccp_cldtot.data(), ws.isccp_ctptau.data(), ws.modis_ctptau.data(), ws.misr_cthtau.data());
 
             // Copy outputs back to layoutRight views
             for (int i = 0; i < ncol; i++) {
                 for (int j = 0; j < ntau; j++) {
                     for (int k = 0; k < nctp; k++) {
-                        isccp_ctptau(i,j,k) = isccp_ctptau_h(i,j,k);
-                        modis_ctptau(i,j,k) = modis_ctptau_h(i,j,k);
+                        isccp_ctptau(i,j,k) = ws.isccp_ctptau(i,j,k);
+                        modis_ctptau(i,j,k) = ws.modis_ctptau(i,j,k);
                     }
                     for (int k = 0; k < ncth; k++) {
-                        misr_cthtau(i,j,k) = misr_cthtau_h(i,j,k);
+                        misr_cthtau(i,j,k) = ws.misr_cthtau(i,j,k);
                     }
                 }
             }
         }
+
+        inline void main(
+                const Int ncol, const Int nsubcol, const Int nlay, const Int ntau, const Int nctp, const Int ncth, const Real emsfc_lw,
+                const view_1d<const Real>& sunlit , const view_1d<const Real>& skt,
+                const view_2d<const Real>& T_mid  , const view_2d<const Real>& p_mid  ,
+                const view_2d<const Real>& p_int,  const view_2d<const Real>& z_mid,
+                const view_2d<const Real>& qv     , const view_2d<const Real>& qc,
+                const view_2d<const Real>& qi, const view_2d<const Real>& cldfrac,
+                const view_2d<const Real>& reff_qc, const view_2d<const Real>& reff_qi,
+                const view_2d<const Real>& dtau067, const view_2d<const Real>& dtau105,
+                const view_1d<Real>& isccp_cldtot , const view_3d<Real>& isccp_ctptau,
+                const view_3d<Real>& modis_ctptau, const view_3d<Real>& misr_cthtau) {
+
+            // Make host copies and permute data as needed
+            Workspace ws(ncol, nlay, ntau, nctp, ncth);
+            copy_inputs(ws, ncol, nlay, sunlit, skt, T_mid, p_mid, p_int, z_mid, qv, qc, qi,
+                        cldfrac, reff_qc, reff_qi, dtau067, dtau105);
+
+            run(ws, ncol, nsubcol, nlay, ntau, nctp, ncth, emsfc_lw,
+                isccp_cldtot, isccp_ctptau, modis_ctptau, misr_cthtau);
+        }
     }
 }
 #endif  /* SCREAM_COSP_FUNCTIONS_HPP */
@@ -1,5 +1,4 @@
 #include "eamxx_cosp.hpp"
-#include "cosp_functions.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
 #include "physics/share/physics_constants.hpp"
 
@@ -12,6 +11,38 @@
 
 namespace scream
 {
+
+namespace {
+
+// Remask night values to ZERO since our I/O does not know how to handle masked/missing values
+// in temporal averages; this is all host data, so we can just use host loops like its the 1980s
+template<typename SunlitView, typename View1d, typename View3d>
+void zero_night_columns (const SunlitView& sunlit, const View1d& isccp_cldtot,
+                         const View3d& isccp_ctptau, const View3d& modis_ctptau,
+                         const View3d& misr_cthtau)
+{
+  const int ncols = sunlit.extent(0);
+  const int ntau  = isccp_ctptau.extent(1);
+  const int nctp  = isccp_ctptau.extent(2);
+  const int ncth  = misr_cthtau.extent(2);
+  for (int i = 0; i < ncols; i++) {
+    if (sunlit(i) == 0) {
+      isccp_cldtot(i) = 0;
+      for (int j = 0; j < ntau; j++) {
+        for (int k = 0; k < nctp; k++) {
+          isccp_ctptau(i,j,k) = 0;
+          modis_ctptau(i,j,k) = 0;
+        }
+        for (int k = 0; k < ncth; k++) {
+          misr_cthtau (i,j,k) = 0;
+        }
+      }
+    }
+  }
+}
+
+} // anonymous namespace
+
 // =========================================================================================
 Cosp::Cosp (const ekat::Comm& comm, const ekat::ParameterList& params)
   : AtmosphereProcess(comm, params)
@@ -26,6 +57,15 @@ Cosp::Cosp (const ekat::Comm& comm, const ekat::ParameterList& params)
 
   // How many subcolumns to use for COSP
   m_num_subcols = m_params.get<Int>("cosp_subcolumns", 10);
+
+  // Whether to run COSP on a host thread, overlapped with the rest of the physics
+  m_async = m_params.get<bool>("cosp_async", false);
+  if (m_async) {
+    // Whether a COSP call is in flight at the end of the step, so it can be written to restart
+    ekat::any cosp_async_pending;
+    cosp_async_pending.reset<int>(0);
+    m_restart_extra_data["cosp_async_pending"] = cosp_async_pending;
+  }
 }
 
 // =========================================================================================
@@ -100,10 +140,35 @@ void Cosp::set_grids(const std::shared_ptr<const GridsManager> grids_manager)
   m_z_int = Field(FieldIdentifier("z_int",scalar3d_int,m,grid_name));
   m_z_mid.allocate_view();
   m_z_int.allocate_view();
+
+  if (m_async) {
+    // Snapshot of the inputs of the COSP call in flight. These are internal fields, so that
+    // they are saved in restart files if the call is still in flight at a restart step.
+    auto add_snapshot = [&](const std::string& name, const FieldLayout& layout, const Units& units) {
+      Field f (FieldIdentifier("cosp_async_"+name,layout,units,grid_name));
+      f.allocate_view();
+      add_internal_field(f);
+      m_inputs_snapshot[name] = f;
+    };
+    add_snapshot("sunlit",           scalar2d,     nondim);
+    add_snapshot("surf_radiative_T", scalar2d,     K);
+    add_snapshot("T_mid",            scalar3d_mid, K);
+    add_snapshot("p_mid",            scalar3d_mid, Pa);
+    add_snapshot("p_int",            scalar3d_int, Pa);
+    add_snapshot("z_mid",            scalar3d_mid, m);
+    add_snapshot("qv",               scalar3d_mid, kg/kg);
+    add_snapshot("qc",               scalar3d_mid, kg/kg);
+    add_snapshot("qi",               scalar3d_mid, kg/kg);
+    add_snapshot("cldfrac_rad",      scalar3d_mid, nondim);
+    add_snapshot("eff_radius_qc",    scalar3d_mid, micron);
+    add_snapshot("eff_radius_qi",    scalar3d_mid, micron);
+    add_snapshot("dtau067",          scalar3d_mid, nondim);
+    add_snapshot("dtau105",          scalar3d_mid, nondim);
+  }
 }
 
 // =========================================================================================
-void Cosp::initialize_impl (const RunType /* run_type */)
+void Cosp::initialize_impl (const RunType run_type)
 {
   // Set property checks for fields in this process
   CospFunc::initialize(m_num_cols, m_num_subcols, m_num_levs);
@@ -118,6 +183,30 @@ void Cosp::initialize_impl (const RunType /* run_type */)
       auto& atts = f.get_header().get_extra_data<stratts_t>("io: string attributes");
       atts["note"] = "Night values are zero; divide by cosp_sunlit to get daytime mean";
   }
+
+  if (m_async) {
+    // Private copies of the outputs, so that the COSP call in flight does not race
+    // with other processes (or the IO) using the fields host views
+    for (const auto& name : {"isccp_cldtot", "isccp_ctptau", "modis_ctptau", "misr_cthtau", "cosp_sunlit"}) {
+      m_async_results[name] = get_field_out(name).clone();
+    }
+
+    // The host buffers are allocated (and initialized) here, on the main thread,
+    // so that the COSP call in flight does not need to allocate any view
+    m_workspace = CospFunc::Workspace(m_num_cols, m_num_levs, m_num_tau, m_num_ctp, m_num_cth);
+
+    // Ensure the snapshot is recognized as initialized by the driver
+    for (auto& it : m_inputs_snapshot) {
+      it.second.get_header().get_tracking().update_time_stamp(start_of_step_ts());
+    }
+
+    // If a COSP call was in flight when the restart file was written, relaunch it
+    // from the saved inputs, so its results are output at the next step as usual
+    const auto pending = ekat::any_cast<int>(m_restart_extra_data["cosp_async_pending"]);
+    if (run_type==RunType::Restart and pending==1) {
+      launch_async_run();
+    }
+  }
 }
 
 // =========================================================================================
@@ -140,28 +229,20 @@ void Cosp::run_impl (const double dt)
   // Compare frequency in steps with current timestep
   auto update_cosp = cosp_do(cosp_freq_in_steps, end_of_step_ts().get_num_steps());
 
+  // In async mode, the results of the COSP call launched at the previous COSP step
+  // are stored in the output fields now
+  const bool has_async_results = m_async_run.valid();
+  wait_async_run();
+  if (has_async_results) {
+    for (auto& it : m_async_results) {
+      it.second.sync_to_dev();
+      get_field_out(it.first).deep_copy(it.second);
+    }
+    ekat::any_cast<int>(m_restart_extra_data["cosp_async_pending"]) = 0;
+  }
+
   // Call COSP wrapper routines
   if (update_cosp) {
-    // Get fields from field manager; note that we get host views because this
-    // interface serves primarily as a wrapper to a c++ to f90 bridge for the COSP
-    // all then need to be copied to layoutLeft views to permute the indices for
-    // F90.
-
-    // Ensure host data of input fields is up to date
-    get_field_in("qv").sync_to_host();
-    get_field_in("qc").sync_to_host();
-    get_field_in("qi").sync_to_host();
-    get_field_in("sunlit").sync_to_host();
-    get_field_in("surf_radiative_T").sync_to_host();
-    get_field_in("T_mid").sync_to_host();
-    get_field_in("p_mid").sync_to_host();
-    get_field_in("p_int").sync_to_host();
-    get_field_in("cldfrac_rad").sync_to_host();
-    get_field_in("eff_radius_qc").sync_to_host();
-    get_field_in("eff_radius_qi").sync_to_host();
-    get_field_in("dtau067").sync_to_host();
-    get_field_in("dtau105").sync_to_host();
-
     // Compute z_mid
     const auto T_mid_d = get_field_in("T_mid").get_view<const Real**>();
     const auto qv_d  = get_field_in("qv").get_view<const Real**>();
@@ -205,6 +286,35 @@ void Cosp::run_impl (const double dt)
     });
     Kokkos::fence();
 
+    if (m_async) {
+      snapshot_inputs();
+      launch_async_run();
+      if (not has_async_results) {
+        zero_outputs();
+      }
+      return;
+    }
+
+    // Get fields from field manager; note that we get host views because this
+    // interface serves primarily as a wrapper to a c++ to f90 bridge for the COSP
+    // all then need to be copied to layoutLeft views to permute the indices for
+    // F90.
+
+    // Ensure host data of input fields is up to date
+    get_field_in("qv").sync_to_host();
+    get_field_in("qc").sync_to_host();
+    get_field_in("qi").sync_to_host();
+    get_field_in("sunlit").sync_to_host();
+    get_field_in("surf_radiative_T").sync_to_host();
+    get_field_in("T_mid").sync_to_host();
+    get_field_in("p_mid").sync_to_host();
+    get_field_in("p_int").sync_to_host();
+    get_field_in("cldfrac_rad").sync_to_host();
+    get_field_in("eff_radius_qc").sync_to_host();
+    get_field_in("eff_radius_qi").sync_to_host();
+    get_field_in("dtau067").sync_to_host();
+    get_field_in("dtau105").sync_to_host();
+
     m_z_mid.sync_to_host();
     const auto z_mid_h = m_z_mid.get_view<const Real**,Host>();
     const auto T_mid_h   = get_field_in("T_mid").get_view<const Real**, Host>();
@@ -235,22 +345,7 @@ void Cosp::run_impl (const double dt)
             cldfrac_h, reff_qc_h, reff_qi_h, dtau067_h, dtau105_h,
             isccp_cldtot_h, isccp_ctptau_h, modis_ctptau_h, misr_cthtau_h
     );
-    // Remask night values to ZERO since our I/O does not know how to handle masked/missing values
-    // in temporal averages; this is all host data, so we can just use host loops like its the 1980s
-    for (int i = 0; i < m_num_cols; i++) {
-      if (sunlit_h(i) == 0) {
-        isccp_cldtot_h(i) = 0;
-        for (int j = 0; j < m_num_tau; j++) {
-          for (int k = 0; k < m_num_ctp; k++) {
-            isccp_ctptau_h(i,j,k) = 0;
-            modis_ctptau_h(i,j,k) = 0;
-          }
-          for (int k = 0; k < m_num_cth; k++) {
-            misr_cthtau_h (i,j,k) = 0;
-          }
-        }
-      }
-    }
+    zero_night_columns(sunlit_h, isccp_cldtot_h, isccp_ctptau_h, modis_ctptau_h, misr_cthtau_h);
 
     // Make sure dev data is up to date
     get_field_out("isccp_cldtot").sync_to_dev();
@@ -258,7 +353,7 @@ void Cosp::run_impl (const double dt)
     get_field_out("modis_ctptau").sync_to_dev();
     get_field_out("misr_cthtau").sync_to_dev();
     get_field_out("cosp_sunlit").sync_to_dev();
-  } else {
+  } else if (not has_async_results) {
     // If not updating COSP statistics, set these to ZERO; this essentially weights
     // the ISCCP cloud properties by the sunlit mask. What will be output for time-averages
     // then is the time-average mask-weighted statistics; to get true averages, we need to
@@ -268,17 +363,104 @@ void Cosp::run_impl (const double dt)
     //     avg(X) = sum(M * X) / sum(M) = (sum(M * X)/N) / (sum(M)/N) = avg(M * X) / avg(M)
     //
     // TODO: mask this when/if the AD ever supports masked averages
-    get_field_out("isccp_cldtot").deep_copy(0);
-    get_field_out("isccp_ctptau").deep_copy(0);
-    get_field_out("modis_ctptau").deep_copy(0);
-    get_field_out("misr_cthtau").deep_copy(0);
-    get_field_out("cosp_sunlit").deep_copy(0);
+    zero_outputs();
+  }
+}
+
+// =========================================================================================
+void Cosp::zero_outputs ()
+{
+  get_field_out("isccp_cldtot").deep_copy(0);
+  get_field_out("isccp_ctptau").deep_copy(0);
+  get_field_out("modis_ctptau").deep_copy(0);
+  get_field_out("misr_cthtau").deep_copy(0);
+  get_field_out("cosp_sunlit").deep_copy(0);
+}
+
+// =========================================================================================
+void Cosp::wait_async_run ()
+{
+  if (m_async_run.valid()) {
+    m_async_run.get();
   }
 }
 
+// =========================================================================================
+void Cosp::snapshot_inputs ()
+{
+  // The COSP call cannot use the fields host views directly, since they
+  // may be synced by other processes (or the IO) while COSP runs.
+  for (auto& it : m_inputs_snapshot) {
+    it.second.deep_copy(it.first=="z_mid" ? m_z_mid : get_field_in(it.first));
+    it.second.get_header().get_tracking().update_time_stamp(end_of_step_ts());
+  }
+}
+
+// =========================================================================================
+void Cosp::launch_async_run ()
+{
+  // Copy the snapshot in the LayoutLeft host buffers here, on the main thread, since
+  // the snapshot fields may be read by the IO (e.g., restart output) while COSP runs.
+  for (auto& it : m_inputs_snapshot) {
+    it.second.sync_to_host();
+  }
+  const auto& in = m_inputs_snapshot;
+  CospFunc::copy_inputs(m_workspace, m_num_cols, m_num_levs,
+      in.at("sunlit").get_view<const Real*, Host>(),
+      in.at("surf_radiative_T").get_view<const Real*, Host>(),
+      in.at("T_mid").get_view<const Real**, Host>(),
+      in.at("p_mid").get_view<const Real**, Host>(),
+      in.at("p_int").get_view<const Real**, Host>(),
+      in.at("z_mid").get_view<const Real**, Host>(),
+      in.at("qv").get_view<const Real**, Host>(),
+      in.at("qc").get_view<const Real**, Host>(),
+      in.at("qi").get_view<const Real**, Host>(),
+      in.at("cldfrac_rad").get_view<const Real**, Host>(),
+      in.at("eff_radius_qc").get_view<const Real**, Host>(),
+      in.at("eff_radius_qi").get_view<const Real**, Host>(),
+      in.at("dtau067").get_view<const Real**, Host>(),
+      in.at("dtau105").get_view<const Real**, Host>());
+
+  const auto& out = m_async_results;
+  const auto isccp_cldtot_h = out.at("isccp_cldtot").get_view<Real*, Host>();
+  const auto isccp_ctptau_h = out.at("isccp_ctptau").get_view<Real***, Host>();
+  const auto modis_ctptau_h = out.at("modis_ctptau").get_view<Real***, Host>();
+  const auto misr_cthtau_h  = out.at("misr_cthtau").get_view<Real***, Host>();
+  const auto cosp_sunlit_h  = out.at("cosp_sunlit").get_view<Real*, Host>();
+
+  const auto ws = m_workspace;
+  const Int ncol    = m_num_cols;
+  const Int nsubcol = m_num_subcols;
+  const Int nlev    = m_num_levs;
+  const Int ntau    = m_num_tau;
+  const Int nctp    = m_num_ctp;
+  const Int ncth    = m_num_cth;
+
+  ekat::any_cast<int>(m_restart_extra_data["cosp_async_pending"]) = 1;
+
+  // NOTE: the task only reads/writes views that were allocated on the main thread
+  //       (the workspace and the private results), via host loops. It does not
+  //       allocate any view nor launch any kernel, so it can safely run
+  //       concurrently with the kernels launched from the main thread.
+  m_async_run = std::async(std::launch::async,[=](){
+    Real emsfc_lw = 0.99;
+    for (int i = 0; i < ncol; i++) {
+      cosp_sunlit_h(i) = ws.sunlit(i);
+    }
+    CospFunc::run(ws, ncol, nsubcol, nlev, ntau, nctp, ncth, emsfc_lw,
+                  isccp_cldtot_h, isccp_ctptau_h, modis_ctptau_h, misr_cthtau_h);
+    zero_night_columns(ws.sunlit, isccp_cldtot_h, isccp_ctptau_h, modis_ctptau_h, misr_cthtau_h);
+  });
+}
+
 // =========================================================================================
 void Cosp::finalize_impl()
 {
+  // The results of a COSP call still in flight (launched at the last step of the run)
+  // can no longer be output, and are discarded. If the run is continued from a restart
+  // file written at the last step, the call is relaunched at initialization instead.
+  wait_async_run();
+
   // Finalize COSP wrappers
   CospFunc::finalize();
 }
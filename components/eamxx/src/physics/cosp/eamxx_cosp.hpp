@@ -3,8 +3,11 @@
 
 #include "share/atm_process/atmosphere_process.hpp"
 #include "share/util/eamxx_common_physics_functions.hpp"
+#include "physics/cosp/cosp_functions.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 
+#include <future>
+#include <map>
 #include <string>
 
 namespace scream
@@ -14,6 +17,13 @@ namespace scream
  * The class responsible to handle the calculation of COSP diagnostics
  * The AD should store exactly ONE instance of this class stored
  * in its list of subcomponents (the AD should make sure of this).
+ *
+ * In async mode, the COSP simulators run on a separate host thread, overlapped with
+ * the rest of the (device) physics. The inputs are snapshotted at the COSP step, and
+ * the results are stored in the output fields at the following step (i.e., they lag
+ * by one step, together with cosp_sunlit, so that sunlit-weighted averages are unaffected).
+ * The snapshot is stored in internal fields, and whether a call is in flight is stored in
+ * the restart extra data, so that a restarted run can relaunch the call from the same inputs.
 */
 
 class Cosp : public AtmosphereProcess
@@ -55,6 +65,18 @@ public:
 protected:
   void finalize_impl   ();
 
+  // Set the outputs to zero (i.e., no COSP statistics this step)
+  void zero_outputs ();
+
+  // Wait for the COSP call in flight (if any), re-throwing its exceptions
+  void wait_async_run ();
+
+  // Copy the current inputs in the snapshot fields
+  void snapshot_inputs ();
+
+  // Launch COSP on a host thread, using the inputs in the snapshot fields
+  void launch_async_run ();
+
   // cosp frequency; positive is interpreted as number of steps, negative as number of hours
   int m_cosp_frequency;
   ekat::CaseInsensitiveString m_cosp_frequency_units;
@@ -72,6 +94,14 @@ protected:
   // TODO: use atm buffer instead
   Field m_z_mid;
   Field m_z_int;
+
+  // Async mode: snapshot of the inputs of the COSP call in flight (internal fields),
+  // the host buffers used by the call, and its results
+  bool                          m_async;
+  std::map<std::string,Field>   m_inputs_snapshot;
+  std::map<std::string,Field>   m_async_results;
+  CospFunc::Workspace           m_workspace;
+  std::future<void>             m_async_run;
 }; // class Cosp
 
 } // namespace scream
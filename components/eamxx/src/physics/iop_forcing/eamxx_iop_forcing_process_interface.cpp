@@ -136,6 +136,19 @@ void IOPForcing::initialize_impl (const RunType run_type)
   const auto iop_nudge_uv = m_iop_data_manager->get_params().get<bool>("iop_nudge_uv");
   const Real one_over_num_dofs = 1.0/m_grid->get_num_global_dofs();
   if (iop_nudge_tq or iop_nudge_uv) m_helper_fields.at("horiz_mean_weights").deep_copy(one_over_num_dofs);
+
+  // The domain means used for nudging are all reduced with a single allreduce
+  if (iop_nudge_tq or iop_nudge_uv) {
+    const auto& weights = m_helper_fields.at("horiz_mean_weights");
+    m_domain_means = std::make_shared<FieldReductionBatch>(m_comm);
+    if (iop_nudge_tq) {
+      m_domain_means->add_horiz_contraction(m_helper_fields.at("qv_mean"), get_field_out("qv"), weights);
+      m_domain_means->add_horiz_contraction(m_helper_fields.at("t_mean"), get_field_out("T_mid"), weights);
+    }
+    if (iop_nudge_uv) {
+      m_domain_means->add_horiz_contraction(m_helper_fields.at("horiz_winds_mean"), get_field_out("horiz_winds"), weights);
+    }
+  }
 }
 // =========================================================================================
 KOKKOS_FUNCTION
@@ -449,18 +462,13 @@ void IOPForcing::run_impl (const double dt)
     // Compute domain mean of qv, T_mid, u, and v
     view_1d<Pack> qv_mean, t_mean;
     view_2d<Pack> horiz_winds_mean;
+    m_domain_means->start();
+    m_domain_means->finish();
     if (iop_nudge_tq){
-      horiz_contraction<Real>(m_helper_fields.at("qv_mean"), get_field_out("qv"),
-                              m_helper_fields.at("horiz_mean_weights"), &m_comm);
       qv_mean = m_helper_fields.at("qv_mean").get_view<Pack*>();
-
-      horiz_contraction<Real>(m_helper_fields.at("t_mean"), get_field_out("T_mid"),
-                              m_helper_fields.at("horiz_mean_weights"), &m_comm);
       t_mean = m_helper_fields.at("t_mean").get_view<Pack*>();
     }
     if (iop_nudge_uv){
-      horiz_contraction<Real>(m_helper_fields.at("horiz_winds_mean"), get_field_out("horiz_winds"),
-                              m_helper_fields.at("horiz_mean_weights"), &m_comm);
       horiz_winds_mean = m_helper_fields.at("horiz_winds_mean").get_view<Pack**>();
     }
 
@@ -6,6 +6,7 @@
 
 #include "share/atm_process/atmosphere_process.hpp"
 #include "share/atm_process/ATMBufferManager.hpp"
+#include "share/field/field_reduction_batch.hpp"
 #include "share/util/eamxx_column_ops.hpp"
 
 #include "physics/share/physics_constants.hpp"
@@ -144,6 +145,9 @@ protected:
   // Some helper fields.
   std::map<std::string,Field> m_helper_fields;
 
+  // Batched reduction of the domain means needed for nudging
+  std::shared_ptr<FieldReductionBatch> m_domain_means;
+
   // Struct which contains local variables
   Buffer m_buffer;
 
@@ -0,0 +1,241 @@
+#include "physics/ml_correction/eamxx_ml_correction_network.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <algorithm>
+#include <fstream>
+
+namespace scream {
+
+namespace {
+
+// Read the next token from the file, and check it matches the expected keyword
+void read_keyword (std::ifstream& in, const std::string& keyword, const std::string& filename)
+{
+  std::string s;
+  in >> s;
+  EKAT_REQUIRE_MSG (in.good() and s==keyword,
+      "Error! Bad ML correction network file.\n"
+      " - file name: " + filename + "\n"
+      " - expected : " + keyword + "\n"
+      " - found    : " + s + "\n");
+}
+
+template<typename T>
+T read_value (std::ifstream& in, const std::string& what, const std::string& filename)
+{
+  T val;
+  in >> val;
+  EKAT_REQUIRE_MSG (not in.fail(),
+      "Error! Could not read " + what + " from ML correction network file.\n"
+      " - file name: " + filename + "\n");
+  return val;
+}
+
+template<typename HostView>
+void read_values (std::ifstream& in, const HostView& v, const std::string& what, const std::string& filename)
+{
+  for (size_t i=0; i<v.size(); ++i) {
+    v.data()[i] = read_value<double>(in,what,filename);
+  }
+}
+
+} // anonymous namespace
+
+MLCorrectionNetwork::
+MLCorrectionNetwork (const std::string& filename)
+ : m_filename (filename)
+{
+  std::ifstream in(filename);
+  EKAT_REQUIRE_MSG (in.is_open(),
+      "Error! Could not open ML correction network file.\n"
+      " - file name: " + filename + "\n");
+
+  read_keyword(in,"eamxx_mlp",filename);
+  const int version = read_value<int>(in,"format version",filename);
+  EKAT_REQUIRE_MSG (version==1,
+      "Error! Unsupported ML correction network file format version.\n"
+      " - file name: " + filename + "\n"
+      " - version  : " + std::to_string(version) + "\n");
+
+  auto read_vars = [&](const std::string& keyword, std::vector<Variable>& vars) {
+    read_keyword(in,keyword,filename);
+    const int n = read_value<int>(in,"number of " + keyword,filename);
+    int offset = 0;
+    for (int i=0; i<n; ++i) {
+      Variable var;
+      var.name   = read_value<std::string>(in,keyword + " name",filename);
+      var.size   = read_value<int>(in,keyword + " size",filename);
+      var.offset = offset;
+      EKAT_REQUIRE_MSG (var.size>0,
+          "Error! Invalid variable size in ML correction network file.\n"
+          " - file name: " + filename + "\n"
+          " - variable : " + var.name + "\n");
+      offset += var.size;
+      vars.push_back(var);
+    }
+    return offset;
+  };
+  const int nin  = read_vars("inputs",m_inputs);
+  const int nout = read_vars("outputs",m_outputs);
+
+  read_keyword(in,"layers",filename);
+  const int nlayers = read_value<int>(in,"number of layers",filename);
+  EKAT_REQUIRE_MSG (nlayers>0,
+      "Error! ML correction network must have at least one layer.\n"
+      " - file name: " + filename + "\n");
+  for (int l=0; l<nlayers; ++l) {
+    Layer layer;
+    layer.nin  = read_value<int>(in,"layer input size",filename);
+    layer.nout = read_value<int>(in,"layer output size",filename);
+    const auto act = read_value<std::string>(in,"layer activation",filename);
+    if (act=="linear") {
+      layer.act = Activation::Linear;
+    } else if (act=="relu") {
+      layer.act = Activation::ReLU;
+    } else if (act=="tanh") {
+      layer.act = Activation::Tanh;
+    } else {
+      EKAT_ERROR_MSG ("Error! Unsupported activation in ML correction network file.\n"
+                      " - file name : " + filename + "\n"
+                      " - activation: " + act + "\n"
+                      " - supported : linear, relu, tanh\n");
+    }
+    const int prev_nout = l==0 ? nin : m_layers.back().nout;
+    EKAT_REQUIRE_MSG (layer.nin==prev_nout,
+        "Error! Incompatible layer sizes in ML correction network file.\n"
+        " - file name : " + filename + "\n"
+        " - layer     : " + std::to_string(l) + "\n"
+        " - layer nin : " + std::to_string(layer.nin) + "\n"
+        " - expected  : " + std::to_string(prev_nout) + "\n");
+
+    layer.w = view_2d<Real>("ml_correction_w",layer.nout,layer.nin);
+    layer.b = view_1d<Real>("ml_correction_b",layer.nout);
+    auto w_h = Kokkos::create_mirror_view(layer.w);
+    auto b_h = Kokkos::create_mirror_view(layer.b);
+    read_values(in,w_h,"layer weights",filename);
+    read_values(in,b_h,"layer biases",filename);
+    Kokkos::deep_copy(layer.w,w_h);
+    Kokkos::deep_copy(layer.b,b_h);
+
+    m_max_width = std::max(m_max_width,std::max(layer.nin,layer.nout));
+    m_layers.push_back(layer);
+  }
+  EKAT_REQUIRE_MSG (m_layers.back().nout==nout,
+      "Error! Network output size does not match the size of the outputs.\n"
+      " - file name       : " + filename + "\n"
+      " - last layer nout : " + std::to_string(m_layers.back().nout) + "\n"
+      " - outputs size    : " + std::to_string(nout) + "\n");
+
+  auto read_scaling = [&](const std::string& keyword, const int n, view_1d<Real>& mean, view_1d<Real>& std) {
+    read_keyword(in,keyword,filename);
+    mean = view_1d<Real>("ml_correction_mean",n);
+    std  = view_1d<Real>("ml_correction_std",n);
+    auto mean_h = Kokkos::create_mirror_view(mean);
+    auto std_h  = Kokkos::create_mirror_view(std);
+    read_values(in,mean_h,keyword + " mean",filename);
+    read_values(in,std_h,keyword + " std",filename);
+    for (int i=0; i<n; ++i) {
+      EKAT_REQUIRE_MSG (std_h(i)!=0,
+          "Error! Zero standard deviation in ML correction network file.\n"
+          " - file name: " + filename + "\n"
+          " - scaling  : " + keyword + "\n"
+          " - index    : " + std::to_string(i) + "\n");
+    }
+    Kokkos::deep_copy(mean,mean_h);
+    Kokkos::deep_copy(std,std_h);
+  };
+  read_scaling("input_scaling",nin,m_in_mean,m_in_std);
+  read_scaling("output_scaling",nout,m_out_mean,m_out_std);
+}
+
+const MLCorrectionNetwork::Variable*
+MLCorrectionNetwork::get_input (const std::string& name) const
+{
+  for (const auto& v : m_inputs) {
+    if (v.name==name) {
+      return &v;
+    }
+  }
+  return nullptr;
+}
+
+const MLCorrectionNetwork::Variable*
+MLCorrectionNetwork::get_output (const std::string& name) const
+{
+  for (const auto& v : m_outputs) {
+    if (v.name==name) {
+      return &v;
+    }
+  }
+  return nullptr;
+}
+
+void MLCorrectionNetwork::
+evaluate (const int ncol, const view_2d<Real>& x, const view_2d<Real>& y)
+{
+  using policy2d_t = Kokkos::MDRangePolicy<KT::ExeSpace,Kokkos::Rank<2>>;
+
+  const int nin  = num_inputs();
+  const int nout = num_outputs();
+  EKAT_REQUIRE_MSG (static_cast<int>(x.extent(0))>=ncol and static_cast<int>(x.extent(1))==nin and
+                    static_cast<int>(y.extent(0))>=ncol and static_cast<int>(y.extent(1))==nout,
+      "Error! Invalid views passed to MLCorrectionNetwork::evaluate.\n"
+      " - file name: " + m_filename + "\n"
+      " - x extents: (" + std::to_string(x.extent(0)) + "," + std::to_string(x.extent(1)) + ")\n"
+      " - y extents: (" + std::to_string(y.extent(0)) + "," + std::to_string(y.extent(1)) + ")\n"
+      " - ncol, nin, nout: " + std::to_string(ncol) + ", " + std::to_string(nin) + ", " + std::to_string(nout) + "\n");
+
+  grow_work(ncol);
+
+  // Normalize inputs
+  auto in_mean = m_in_mean;
+  auto in_std  = m_in_std;
+  Kokkos::parallel_for("MLCorrectionNetwork::normalize",policy2d_t({0,0},{ncol,nin}),
+                       KOKKOS_LAMBDA(const int icol, const int i) {
+    x(icol,i) = (x(icol,i) - in_mean(i)) / in_std(i);
+  });
+
+  // Apply layers, ping-ponging between the work arrays (the last layer writes into y)
+  const int nlayers = m_layers.size();
+  for (int l=0; l<nlayers; ++l) {
+    const auto& layer = m_layers[l];
+    const auto w   = layer.w;
+    const auto b   = layer.b;
+    const auto act = layer.act;
+    const int  n   = layer.nin;
+    const auto src = l==0 ? x : m_work[(l-1)%2];
+    const auto dst = l==nlayers-1 ? y : m_work[l%2];
+    Kokkos::parallel_for("MLCorrectionNetwork::layer",policy2d_t({0,0},{ncol,layer.nout}),
+                         KOKKOS_LAMBDA(const int icol, const int o) {
+      Real acc = b(o);
+      for (int i=0; i<n; ++i) {
+        acc += w(o,i)*src(icol,i);
+      }
+      switch (act) {
+        case Activation::ReLU: acc = acc>0 ? acc : 0;  break;
+        case Activation::Tanh: acc = Kokkos::tanh(acc); break;
+        default: break;
+      }
+      dst(icol,o) = acc;
+    });
+  }
+
+  // Denormalize outputs
+  auto out_mean = m_out_mean;
+  auto out_std  = m_out_std;
+  Kokkos::parallel_for("MLCorrectionNetwork::denormalize",policy2d_t({0,0},{ncol,nout}),
+                       KOKKOS_LAMBDA(const int icol, const int o) {
+    y(icol,o) = y(icol,o)*out_std(o) + out_mean(o);
+  });
+}
+
+void MLCorrectionNetwork::grow_work (const int ncol)
+{
+  if (static_cast<int>(m_work[0].extent(0))<ncol) {
+    m_work[0] = view_2d<Real>("ml_correction_work0",ncol,m_max_width);
+    m_work[1] = view_2d<Real>("ml_correction_work1",ncol,m_max_width);
+  }
+}
+
+} // namespace scream
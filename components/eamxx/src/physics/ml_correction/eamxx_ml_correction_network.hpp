@@ -0,0 +1,104 @@
+#ifndef SCREAM_ML_CORRECTION_NETWORK_HPP
+#define SCREAM_ML_CORRECTION_NETWORK_HPP
+
+#include "share/eamxx_types.hpp"
+
+#include <string>
+#include <vector>
+
+namespace scream {
+
+/*
+ * A feed-forward network, evaluated on device for all columns at once
+ *
+ * This allows MLCorrection to evaluate its models without going through
+ * python (and host copies of the fields). Each column is evaluated independently:
+ * the inputs of a column are stacked in a single vector x (e.g., T_mid at all
+ * levels, then qv at all levels, then lat, ...), and the network computes
+ *   x_0 = (x - in_mean) / in_std
+ *   x_l = act_l (W_l x_{l-1} + b_l),   l=1,...,L
+ *   y   = x_L * out_std + out_mean
+ * where y is the stack of all outputs (e.g., dQ1 and dQ2 at all levels).
+ * Each layer is a GEMM-like kernel over (column,output) pairs.
+ *
+ * The weights are read from a text file, with whitespace-separated entries:
+ *   eamxx_mlp 1
+ *   inputs  <n>      followed by n pairs  <name> <size>
+ *   outputs <n>      followed by n pairs  <name> <size>
+ *   layers  <L>
+ *   for each layer:
+ *     <nin> <nout> <activation>   (activation: linear, relu, or tanh)
+ *     W (nout x nin, row major), then b (nout)
+ *   input_scaling   followed by in_mean and in_std (nin of first layer each)
+ *   output_scaling  followed by out_mean and out_std (nout of last layer each)
+ * The sum of the input (output) sizes must match the nin (nout) of the first (last) layer.
+ */
+
+class MLCorrectionNetwork
+{
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+  template<typename T>
+  using view_2d = typename KT::template view_2d<T>;
+
+  enum class Activation {
+    Linear,
+    ReLU,
+    Tanh
+  };
+
+  struct Variable {
+    std::string name;
+    int         size;
+    int         offset;   // Offset of the variable in the stacked input/output vector
+  };
+
+  MLCorrectionNetwork (const std::string& filename);
+  ~MLCorrectionNetwork () = default;
+
+  const std::vector<Variable>& inputs  () const { return m_inputs;  }
+  const std::vector<Variable>& outputs () const { return m_outputs; }
+
+  int num_inputs  () const { return m_layers.front().nin;   }
+  int num_outputs () const { return m_layers.back().nout;  }
+
+  // Return nullptr if the network has no input/output with this name
+  const Variable* get_input  (const std::string& name) const;
+  const Variable* get_output (const std::string& name) const;
+
+  // Compute y(icol,:) = net(x(icol,:)), for icol in [0,ncol). x is used as scratch space
+  void evaluate (const int ncol, const view_2d<Real>& x, const view_2d<Real>& y);
+
+protected:
+
+  struct Layer {
+    int           nin;
+    int           nout;
+    Activation    act;
+    view_2d<Real> w;
+    view_1d<Real> b;
+  };
+
+  // Ensure the ping-pong buffers can store ncol columns of the widest layer
+  void grow_work (const int ncol);
+
+  std::string m_filename;
+
+  std::vector<Variable> m_inputs;
+  std::vector<Variable> m_outputs;
+  std::vector<Layer>    m_layers;
+
+  view_1d<Real>   m_in_mean;
+  view_1d<Real>   m_in_std;
+  view_1d<Real>   m_out_mean;
+  view_1d<Real>   m_out_std;
+
+  int             m_max_width = 0;
+  view_2d<Real>   m_work[2];
+};
+
+} // namespace scream
+
+#endif // SCREAM_ML_CORRECTION_NETWORK_HPP
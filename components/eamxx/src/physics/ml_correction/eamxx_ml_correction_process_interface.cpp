@@ -6,6 +6,8 @@
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_within_interval_check.hpp"
 
+#include <map>
+
 namespace scream {
 // =========================================================================================
 MLCorrection::MLCorrection(const ekat::Comm &comm,
@@ -16,6 +18,13 @@ MLCorrection::MLCorrection(const ekat::Comm &comm,
   m_ML_model_path_sfc_fluxes = m_params.get<std::string>("ml_model_path_sfc_fluxes");
   m_fields_ml_output_variables = m_params.get<std::vector<std::string>>("ml_output_fields");
   m_ML_correction_unit_test = m_params.get<bool>("ml_correction_unit_test");
+
+  const auto backend = m_params.get<std::string>("ml_backend","python");
+  EKAT_REQUIRE_MSG (backend=="python" or backend=="native",
+      "Error! Invalid value for ml_backend in MLCorrection.\n"
+      " - ml_backend: " + backend + "\n"
+      " - valid values: python, native\n");
+  m_use_native_backend = backend=="native";
 }
 
 // =========================================================================================
@@ -72,18 +81,24 @@ void MLCorrection::set_grids(
 
 // =========================================================================================
 void MLCorrection::initialize_impl(const RunType /* run_type */) {
-  fpe_mask = ekat::get_enabled_fpes();
-  ekat::disable_all_fpes();  // required for importing numpy
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_use_native_backend) {
+    load_network(m_net_tq, m_ML_model_path_tq);
+    load_network(m_net_uv, m_ML_model_path_uv);
+    load_network(m_net_sfc_fluxes, m_ML_model_path_sfc_fluxes);
+  } else {
+    fpe_mask = ekat::get_enabled_fpes();
+    ekat::disable_all_fpes();  // required for importing numpy
+    if ( Py_IsInitialized() == 0 ) {
+      pybind11::initialize_interpreter();
+    }
+    pybind11::module sys = pybind11::module::import("sys");
+    sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
+    py_correction = pybind11::module::import("ml_correction");
+    ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
+    ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
+    ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
+    ekat::enable_fpes(fpe_mask);
   }
-  pybind11::module sys = pybind11::module::import("sys");
-  sys.attr("path").attr("insert")(1, ML_CORRECTION_CUSTOM_PATH);
-  py_correction = pybind11::module::import("ml_correction");
-  ML_model_tq = py_correction.attr("get_ML_model")(m_ML_model_path_tq);
-  ML_model_uv = py_correction.attr("get_ML_model")(m_ML_model_path_uv);
-  ML_model_sfc_fluxes = py_correction.attr("get_ML_model")(m_ML_model_path_sfc_fluxes);
-  ekat::enable_fpes(fpe_mask);
 
   // Enforce bounds on quantities adjusted by ML using Field Property Checks
   using LowerBound = FieldLowerBoundCheck;
@@ -98,66 +113,22 @@ void MLCorrection::initialize_impl(const RunType /* run_type */) {
 
 // =========================================================================================
 void MLCorrection::run_impl(const double dt) {
-  // use model time to infer solar zenith angle for the ML prediction
-  auto current_ts = start_of_step_ts();
-  std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
-
-  const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
-  const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();
-
-  const auto &qv              = get_field_out("qv").get_view<Real **, Host>();
-  const auto &T_mid           = get_field_out("T_mid").get_view<Real **, Host>();
-  const auto &SW_flux_dn      = get_field_out("SW_flux_dn").get_view<Real **, Host>();
-  const auto &sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real *, Host>();
-  const auto &sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real *, Host>();
-  const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
-  const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
-
   // For precipitation adjustment we need to track the change in column integrated 'qv'
   // So we clone the original qv before ML changes the state so we can back out a qv_tend
   // to use with precip adjustment.
   auto qv_src = get_field_in("qv");
   auto qv_in = qv_src.clone();
 
-  auto h_lat  = m_lat.get_view<const Real*,Host>();
-  auto h_lon  = m_lon.get_view<const Real*,Host>();
-
-  const auto& tracers = get_group_out("tracers");
-  const auto& tracers_info = tracers.m_info;
-  Int num_tracers = tracers_info->size();
-
-  ekat::disable_all_fpes();  // required for importing numpy
-  if ( Py_IsInitialized() == 0 ) {
-    pybind11::initialize_interpreter();
+  if (m_use_native_backend) {
+    // The T/qv correction is applied before the other models are evaluated, like in python
+    for (const auto& net : {m_net_tq, m_net_uv, m_net_sfc_fluxes}) {
+      if (net) {
+        run_network(*net, dt);
+      }
+    }
+  } else {
+    run_python(dt);
   }
-  // for qv, we need to stride across number of tracers
-  pybind11::object ob1     = py_correction.attr("update_fields")(
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, T_mid.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs * num_tracers, qv.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, u.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * m_num_levs, v.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, h_lat.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, h_lon.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, phis.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols * (m_num_levs+1), SW_flux_dn.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_alb_dif_vis.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_flux_sw_net.data(), pybind11::str{}),
-      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
-          m_num_cols, sfc_flux_lw_dn.data(), pybind11::str{}),
-      m_num_cols, m_num_levs, num_tracers, dt,
-      ML_model_tq, ML_model_uv, ML_model_sfc_fluxes, datetime_str);
-  pybind11::gil_scoped_release no_gil;
-  ekat::enable_fpes(fpe_mask);
 
   // Now back out the qv change abd apply it to precipitation, only if Tq ML is turned on
   if (m_ML_model_path_tq != "none") {
@@ -165,6 +136,7 @@ void MLCorrection::run_impl(const double dt) {
     using KT  = KokkosTypes<DefaultDevice>;
     using MT  = typename KT::MemberType;
     using ESU = ekat::ExeSpaceUtils<typename KT::ExeSpace>;
+    const auto &T_mid                = get_field_in("T_mid").get_view<const Real**>();
     const auto &pseudo_density       = get_field_in("pseudo_density").get_view<const Real**>();
     const auto &precip_liq_surf_mass = get_field_out("precip_liq_surf_mass").get_view<Real *>();
     const auto &precip_ice_surf_mass = get_field_out("precip_ice_surf_mass").get_view<Real *>();
@@ -227,6 +199,235 @@ void MLCorrection::run_impl(const double dt) {
   }
 }
 
+// =========================================================================================
+void MLCorrection::run_python(const double dt) {
+  // use model time to infer solar zenith angle for the ML prediction
+  auto current_ts = start_of_step_ts();
+  std::string datetime_str = current_ts.get_date_string() + " " + current_ts.get_time_string();
+
+  const auto &phis            = get_field_in("phis").get_view<const Real *, Host>();
+  const auto &sfc_alb_dif_vis = get_field_in("sfc_alb_dif_vis").get_view<const Real *, Host>();
+
+  const auto &qv              = get_field_out("qv").get_view<Real **, Host>();
+  const auto &T_mid           = get_field_out("T_mid").get_view<Real **, Host>();
+  const auto &SW_flux_dn      = get_field_out("SW_flux_dn").get_view<Real **, Host>();
+  const auto &sfc_flux_sw_net = get_field_out("sfc_flux_sw_net").get_view<Real *, Host>();
+  const auto &sfc_flux_lw_dn  = get_field_out("sfc_flux_lw_dn").get_view<Real *, Host>();
+  const auto &u               = get_field_out("horiz_winds").get_component(0).get_view<Real **, Host>();
+  const auto &v               = get_field_out("horiz_winds").get_component(1).get_view<Real **, Host>();
+
+  auto h_lat  = m_lat.get_view<const Real*,Host>();
+  auto h_lon  = m_lon.get_view<const Real*,Host>();
+
+  const auto& tracers = get_group_out("tracers");
+  const auto& tracers_info = tracers.m_info;
+  Int num_tracers = tracers_info->size();
+
+  ekat::disable_all_fpes();  // required for importing numpy
+  if ( Py_IsInitialized() == 0 ) {
+    pybind11::initialize_interpreter();
+  }
+  // for qv, we need to stride across number of tracers
+  pybind11::object ob1     = py_correction.attr("update_fields")(
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, T_mid.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs * num_tracers, qv.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, u.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * m_num_levs, v.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, h_lat.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, h_lon.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, phis.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols * (m_num_levs+1), SW_flux_dn.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_alb_dif_vis.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_flux_sw_net.data(), pybind11::str{}),
+      pybind11::array_t<Real, pybind11::array::c_style | pybind11::array::forcecast>(
+          m_num_cols, sfc_flux_lw_dn.data(), pybind11::str{}),
+      m_num_cols, m_num_levs, num_tracers, dt,
+      ML_model_tq, ML_model_uv, ML_model_sfc_fluxes, datetime_str);
+  pybind11::gil_scoped_release no_gil;
+  ekat::enable_fpes(fpe_mask);
+}
+
+// =========================================================================================
+void MLCorrection::load_network(std::shared_ptr<MLCorrectionNetwork>& net, const std::string& path) {
+  if (path=="NONE" or path=="none") {
+    return;
+  }
+  net = std::make_shared<MLCorrectionNetwork>(path);
+
+  // Supported inputs/outputs, and whether they are defined at each level (or once per column)
+  const std::map<std::string,bool> inputs = {
+    {"T_mid",true}, {"qv",true}, {"U",true}, {"V",true},
+    {"lat",false}, {"surface_geopotential",false}, {"cos_zenith_angle",false},
+    {"surface_diffused_shortwave_albedo",false},
+    {"total_sky_downward_shortwave_flux_at_top_of_atmosphere",false}
+  };
+  const std::map<std::string,bool> outputs = {
+    {"dQ1",true}, {"dQ2",true}, {"dQu",true}, {"dQv",true}, {"dQxwind",true}, {"dQywind",true},
+    {"net_shortwave_sfc_flux_via_transmissivity",false},
+    {"override_for_time_adjusted_total_sky_downward_longwave_flux_at_surface",false}
+  };
+  auto check = [&](const MLCorrectionNetwork::Variable& var, const std::map<std::string,bool>& supported) {
+    EKAT_REQUIRE_MSG (supported.count(var.name)==1,
+        "Error! Unsupported variable in ML correction network.\n"
+        " - file name: " + path + "\n"
+        " - variable : " + var.name + "\n");
+    const bool is_col = supported.at(var.name);
+    EKAT_REQUIRE_MSG (var.size == (is_col ? m_num_levs : 1),
+        "Error! Wrong variable size in ML correction network.\n"
+        " - file name: " + path + "\n"
+        " - variable : " + var.name + "\n"
+        " - size     : " + std::to_string(var.size) + "\n"
+        " - expected : " + std::to_string(is_col ? m_num_levs : 1) + "\n");
+    // In unit-test mode, only the state fields are available
+    EKAT_REQUIRE_MSG (not m_ML_correction_unit_test or is_col,
+        "Error! Variable not available in ML correction unit-test mode.\n"
+        " - file name: " + path + "\n"
+        " - variable : " + var.name + "\n");
+  };
+  for (const auto& var : net->inputs()) {
+    check(var,inputs);
+  }
+  for (const auto& var : net->outputs()) {
+    check(var,outputs);
+  }
+}
+
+// =========================================================================================
+namespace {
+
+using KT = KokkosTypes<DefaultDevice>;
+using policy2d_t = Kokkos::MDRangePolicy<KT::ExeSpace,Kokkos::Rank<2>>;
+
+// Copy the first n entries of each column of v into x(:,offset:offset+n)
+template<typename V>
+void copy_to_input (const int ncol, const V& v, const MLCorrectionNetwork::view_2d<Real>& x,
+                    const int offset, const int n)
+{
+  Kokkos::parallel_for("MLCorrection::copy_to_input",policy2d_t({0,0},{ncol,n}),
+                       KOKKOS_LAMBDA(const int icol, const int k) {
+    if constexpr (V::rank==1) {
+      x(icol,offset) = v(icol);
+    } else {
+      x(icol,offset+k) = v(icol,k);
+    }
+  });
+}
+
+// Apply the output y(:,offset:offset+n) to v. For 2d views (level fields) the output is
+// a tendency, integrated over dt; for 1d views (surface fields) it overrides v, and dt is unused
+template<typename V>
+void apply_output (const int ncol, const MLCorrectionNetwork::view_2d<Real>& y,
+                   const int offset, const int n, const Real dt, const V& v)
+{
+  Kokkos::parallel_for("MLCorrection::apply_output",policy2d_t({0,0},{ncol,n}),
+                       KOKKOS_LAMBDA(const int icol, const int k) {
+    if constexpr (V::rank==1) {
+      v(icol) = y(icol,offset);
+    } else {
+      v(icol,k) += y(icol,offset+k)*dt;
+    }
+  });
+}
+
+} // anonymous namespace
+
+void MLCorrection::run_network(MLCorrectionNetwork& net, const double dt) {
+  const int ncol = m_num_cols;
+  if (static_cast<int>(m_net_x.extent(0))<ncol or static_cast<int>(m_net_x.extent(1))!=net.num_inputs()) {
+    m_net_x = MLCorrectionNetwork::view_2d<Real>("ml_correction_x",ncol,net.num_inputs());
+  }
+  if (static_cast<int>(m_net_y.extent(0))<ncol or static_cast<int>(m_net_y.extent(1))!=net.num_outputs()) {
+    m_net_y = MLCorrectionNetwork::view_2d<Real>("ml_correction_y",ncol,net.num_outputs());
+  }
+  const auto x = m_net_x;
+  const auto y = m_net_y;
+
+  const auto& winds = get_field_out("horiz_winds");
+  const auto T_mid = get_field_out("T_mid").get_view<Real**>();
+  const auto qv    = get_field_out("qv").get_strided_view<Real**>();
+  const auto u     = winds.get_component(0).get_strided_view<Real**>();
+  const auto v     = winds.get_component(1).get_strided_view<Real**>();
+
+  // Stack the inputs
+  for (const auto& var : net.inputs()) {
+    const auto& name = var.name;
+    const int off = var.offset;
+    const int n   = var.size;
+    if (name=="T_mid") {
+      copy_to_input(ncol,T_mid,x,off,n);
+    } else if (name=="qv") {
+      copy_to_input(ncol,qv,x,off,n);
+    } else if (name=="U") {
+      copy_to_input(ncol,u,x,off,n);
+    } else if (name=="V") {
+      copy_to_input(ncol,v,x,off,n);
+    } else if (name=="lat") {
+      copy_to_input(ncol,m_lat.get_view<const Real*>(),x,off,n);
+    } else if (name=="surface_geopotential") {
+      copy_to_input(ncol,get_field_in("phis").get_view<const Real*>(),x,off,n);
+    } else if (name=="surface_diffused_shortwave_albedo") {
+      copy_to_input(ncol,get_field_in("sfc_alb_dif_vis").get_view<const Real*>(),x,off,n);
+    } else if (name=="total_sky_downward_shortwave_flux_at_top_of_atmosphere") {
+      // Copying 1 entry per column grabs the model top value
+      copy_to_input(ncol,get_field_out("SW_flux_dn").get_view<const Real**>(),x,off,n);
+    } else if (name=="cos_zenith_angle") {
+      // NOAA's approximation of the solar position (lat/lon in degrees)
+      using PC = scream::physics::Constants<Real>;
+      constexpr Real pi = PC::Pi;
+      const Real deg2rad = pi/180;
+      const auto ts = start_of_step_ts();
+      const Real gamma = 2*pi/ts.days_in_curr_year() * (ts.frac_of_year_in_days() - 0.5);
+      const Real eqtime = 229.18*(0.000075 + 0.001868*std::cos(gamma) - 0.032077*std::sin(gamma)
+                                  - 0.014615*std::cos(2*gamma) - 0.040849*std::sin(2*gamma));
+      const Real decl = 0.006918 - 0.399912*std::cos(gamma) + 0.070257*std::sin(gamma)
+                      - 0.006758*std::cos(2*gamma) + 0.000907*std::sin(2*gamma)
+                      - 0.002697*std::cos(3*gamma) + 0.00148*std::sin(3*gamma);
+      const Real minutes = ts.sec_of_day()/60.0 + eqtime;
+      const auto lat = m_lat.get_view<const Real*>();
+      const auto lon = m_lon.get_view<const Real*>();
+      Kokkos::parallel_for("MLCorrection::cos_zenith",Kokkos::RangePolicy<KT::ExeSpace>(0,ncol),
+                           KOKKOS_LAMBDA(const int icol) {
+        const Real ha  = (minutes + 4*lon(icol))/4 - 180;
+        const Real rlat = lat(icol)*deg2rad;
+        x(icol,off) = Kokkos::sin(rlat)*Kokkos::sin(decl) + Kokkos::cos(rlat)*Kokkos::cos(decl)*Kokkos::cos(ha*deg2rad);
+      });
+    }
+  }
+
+  net.evaluate(ncol,x,y);
+
+  // Apply the outputs. Tendencies are scaled by dt, while surface fluxes override the current values
+  for (const auto& var : net.outputs()) {
+    const auto& name = var.name;
+    const int off = var.offset;
+    const int n   = var.size;
+    if (name=="dQ1") {
+      apply_output(ncol,y,off,n,dt,T_mid);
+    } else if (name=="dQ2") {
+      apply_output(ncol,y,off,n,dt,qv);
+    } else if (name=="dQu" or name=="dQxwind") {
+      apply_output(ncol,y,off,n,dt,u);
+    } else if (name=="dQv" or name=="dQywind") {
+      apply_output(ncol,y,off,n,dt,v);
+    } else if (name=="net_shortwave_sfc_flux_via_transmissivity") {
+      apply_output(ncol,y,off,n,0,get_field_out("sfc_flux_sw_net").get_view<Real*>());
+    } else if (name=="override_for_time_adjusted_total_sky_downward_longwave_flux_at_surface") {
+      apply_output(ncol,y,off,n,0,get_field_out("sfc_flux_lw_dn").get_view<Real*>());
+    }
+  }
+  Kokkos::fence();
+}
+
 // =========================================================================================
 void MLCorrection::finalize_impl() {
   // Do nothing
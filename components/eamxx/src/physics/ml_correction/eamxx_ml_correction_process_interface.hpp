@@ -6,6 +6,7 @@
 #include <pybind11/pybind11.h>
 #include <array>
 #include <string>
+#include "physics/ml_correction/eamxx_ml_correction_network.hpp"
 #include "share/atm_process/atmosphere_process.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/util/ekat_lin_interp.hpp"
@@ -49,6 +50,13 @@ class MLCorrection : public AtmosphereProcess {
   void finalize_impl();
   void apply_tendency(Field& base, const Field& next, const int dt);
 
+  // Evaluate the ML models through python (ml_backend=python)
+  void run_python(const double dt);
+
+  // Evaluate the ML models natively, on device (ml_backend=native)
+  void load_network(std::shared_ptr<MLCorrectionNetwork>& net, const std::string& path);
+  void run_network(MLCorrectionNetwork& net, const double dt);
+
   std::shared_ptr<const AbstractGrid>   m_grid;
   // Keep track of field dimensions and the iteration count
   Int m_num_cols;
@@ -60,6 +68,12 @@ class MLCorrection : public AtmosphereProcess {
   std::string m_ML_model_path_sfc_fluxes;
   std::vector<std::string> m_fields_ml_output_variables;
   bool m_ML_correction_unit_test;
+  bool m_use_native_backend;
+  std::shared_ptr<MLCorrectionNetwork> m_net_tq;
+  std::shared_ptr<MLCorrectionNetwork> m_net_uv;
+  std::shared_ptr<MLCorrectionNetwork> m_net_sfc_fluxes;
+  MLCorrectionNetwork::view_2d<Real> m_net_x;
+  MLCorrectionNetwork::view_2d<Real> m_net_y;
   pybind11::module py_correction;
   pybind11::object ML_model_tq;
   pybind11::object ML_model_uv;
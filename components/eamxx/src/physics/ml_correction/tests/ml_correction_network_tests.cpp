@@ -0,0 +1,82 @@
+#include <catch2/catch.hpp>
+
+#include "physics/ml_correction/eamxx_ml_correction_network.hpp"
+
+#include <fstream>
+#include <limits>
+
+namespace {
+
+TEST_CASE("ml_correction_network") {
+  using namespace scream;
+  using Net = MLCorrectionNetwork;
+
+  // A network with inputs (a,b) and output c, with one hidden relu layer:
+  //   h = relu(W1 x + b1), c = W2 h + b2
+  // with inputs normalized as (x-1)/2, and output denormalized as 10*y+5
+  const std::string fname = "ml_correction_network_test.txt";
+  {
+    std::ofstream out(fname);
+    out << "eamxx_mlp 1\n"
+        << "inputs 2  a 1  b 1\n"
+        << "outputs 1  c 1\n"
+        << "layers 2\n"
+        << "2 2 relu\n"
+        << "  1 -1\n"
+        << "  2  1\n"
+        << "  0  0.5\n"
+        << "2 1 linear\n"
+        << "  1 -2\n"
+        << "  0.25\n"
+        << "input_scaling  1 1  2 2\n"
+        << "output_scaling 5  10\n";
+  }
+
+  Net net(fname);
+  REQUIRE (net.num_inputs()==2);
+  REQUIRE (net.num_outputs()==1);
+  REQUIRE (net.get_input("b")->offset==1);
+  REQUIRE (net.get_output("c")->size==1);
+  REQUIRE (net.get_input("c")==nullptr);
+
+  auto eval = [](const Real a, const Real b) {
+    const Real x0 = (a-1)/2;
+    const Real x1 = (b-1)/2;
+    const Real h0 = std::max(x0 - x1, Real(0));
+    const Real h1 = std::max(2*x0 + x1 + Real(0.5), Real(0));
+    return 10*(h0 - 2*h1 + Real(0.25)) + 5;
+  };
+
+  const int ncol = 5;
+  Net::view_2d<Real> x("x",ncol,2);
+  Net::view_2d<Real> y("y",ncol,1);
+  auto x_h = Kokkos::create_mirror_view(x);
+  for (int icol=0; icol<ncol; ++icol) {
+    x_h(icol,0) = icol - 2;
+    x_h(icol,1) = 3 - 2*icol;
+  }
+  Kokkos::deep_copy(x,x_h);
+
+  net.evaluate(ncol,x,y);
+
+  // The network and eval do not round the same way, so allow a few ulps of the result
+  const Real tol = 100*std::numeric_limits<Real>::epsilon();
+  auto y_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),y);
+  for (int icol=0; icol<ncol; ++icol) {
+    const Real expected = eval(icol-2,3-2*icol);
+    REQUIRE (std::abs(y_h(icol,0)-expected) <= tol*std::max(Real(1),std::abs(expected)));
+  }
+
+  // Layer sizes that do not match the inputs are caught at construction
+  {
+    std::ofstream out(fname);
+    out << "eamxx_mlp 1\n"
+        << "inputs 1  a 2\n"
+        << "outputs 1  c 1\n"
+        << "layers 1\n"
+        << "3 1 linear\n";
+  }
+  REQUIRE_THROWS (Net(fname));
+}
+
+} // anonymous namespace
@@ -22,6 +22,7 @@ Nudging::Nudging (const ekat::Comm& comm, const ekat::ParameterList& params)
   m_fields_nudge = m_params.get<std::vector<std::string>>("nudging_fields");
   m_use_weights   = m_params.get<bool>("use_nudging_weights",false);
   m_skip_vert_interpolation   = m_params.get<bool>("skip_vert_interpolation",false);
+  m_remap_on_load = m_params.get<bool>("nudging_remap_on_load",false);
   // If we are doing horizontal refine-remapping, we need to get the mapfile from user
   m_refine_remap_file = m_params.get<std::string>(
       "nudging_refine_remap_mapfile", "no-file-given");
@@ -198,6 +199,61 @@ void Nudging::apply_tendency(Field& state, const Field& nudge, const Real dt) co
   };
   Kokkos::parallel_for(policy,update);
 }
+// =========================================================================================
+void Nudging::correct_masked_values (const Field& f) const
+{
+  using KT          = KokkosTypes<DefaultDevice>;
+  using RangePolicy = typename KT::RangePolicy;
+
+  // If the input data contains "masked" values (sometimes also called "filled" values),
+  // the horiz remapping would smear them around. To prevent that, we need to "cure"
+  // these values. Masked values can only happen at top/bot of the model (with top
+  // being not common), and they must be a contiguous set of entries. So to cure them,
+  // we simply set all bot/top masked entries equal to the first non-masked value
+  // from the bot/top respectively. This corresponds to a constant extrapolation.
+  // NOTE: we need to do a tol check, since time interpolation may not return fillValue,
+  //       even if both f(t_beg)/f(t_end) are equal to fillValue (due to rounding).
+  // NOTE: if f(t_beg)==fillValue!=f(t_end), or viceversa, the time-interpolated value can
+  //       substantially differ from fillValue. Here, we assume it didn't happen.
+  //       With remap-on-load, the correction happens before time interpolation, so this
+  //       is not a concern.
+  const auto fl = f.get_header().get_identifier().get_layout();
+  const auto v  = f.get_view<Real**>();
+
+  Real var_fill_value = constants::DefaultFillValue<Real>().value;
+  // Query the helper field for the fill value, if not present use default
+  if (f.get_header().has_extra_data("mask_value")) {
+    var_fill_value = f.get_header().get_extra_data<Real>("mask_value");
+  }
+
+  const int ncols = fl.dim(0);
+  const int nlevs = fl.dim(1);
+  const auto thresh = std::abs(var_fill_value)*0.0001;
+  auto lambda = KOKKOS_LAMBDA(const int icol) {
+    int first_good = nlevs;
+    int last_good = -1;
+    for (int k=0; k<nlevs; ++k) {
+      if (std::abs(v(icol,k)-var_fill_value)>thresh) {
+        // This entry is substantially different from var_fill_value, so it's good
+        first_good = ekat::impl::min(first_good,k);
+        last_good  = ekat::impl::max(last_good,k);
+      }
+    }
+    EKAT_KERNEL_REQUIRE_MSG (first_good<nlevs and last_good>=0,
+        "[Nudging] Error! Could not locate a non-masked entry in a column.\n");
+
+    // Fix near TOM
+    for (int k=0; k<first_good; ++k) {
+      v(icol,k) = v(icol,first_good);
+    }
+    // Fix near surf
+    for (int k=last_good+1; k<nlevs; ++k) {
+      v(icol,k) = v(icol,last_good);
+    }
+  };
+
+  Kokkos::parallel_for(RangePolicy(0,ncols),lambda);
+}
 // =============================================================================================================
 void Nudging::initialize_impl (const RunType /* run_type */)
 {
@@ -228,10 +284,31 @@ void Nudging::initialize_impl (const RunType /* run_type */)
   // Now that we have the remapper, we can grab the grid where the input data lives
   auto grid_ext = m_horiz_remapper->get_src_grid();
 
-  // Initialize the time interpolator and horiz remapper
-  m_time_interp = util::TimeInterpolation(grid_ext, m_datafiles);
+  // Initialize the time interpolator. If we remap on load, data is remapped once per
+  // slice, and the time interpolation happens on the intermediate grid.
+  m_time_interp = util::TimeInterpolation(m_remap_on_load ? grid_tmp : grid_ext, m_datafiles);
   m_time_interp.set_logger(m_atm_logger,"[EAMxx::Nudging] Reading nudging data");
 
+  // Register a field read from file (ext) and its horiz-remapped version (tmp)
+  // in the time interpolator and horiz remapper
+  auto register_data_field = [&](const std::string& name, const Field& field_ext, const Field& field_tmp) {
+    if (m_remap_on_load) {
+      // The remapper tgt is just a staging area, from which the time interpolator copies
+      // the remapped slice. The time interpolator output is the tmp field.
+      Field field_ext_remapped;
+      if (m_refine_remap) {
+        field_ext_remapped = create_helper_field(name+"_ext_remapped", field_tmp.get_header().get_identifier().get_layout(), grid_tmp->name());
+      } else {
+        field_ext_remapped = field_ext.alias(name+"_ext_remapped");
+      }
+      m_horiz_remapper->register_field(field_ext.alias(name), field_ext_remapped.alias(name));
+      m_time_interp.add_field(field_tmp.alias(name), true);
+    } else {
+      m_time_interp.add_field(field_ext.alias(name), true);
+      m_horiz_remapper->register_field(field_ext, field_tmp);
+    }
+  };
+
   // NOTE: we are ASSUMING all fields are 3d and scalar!
   const auto layout_ext = grid_ext->get_3d_scalar_layout(true);
   const auto layout_tmp = grid_tmp->get_3d_scalar_layout(true);
@@ -243,20 +320,18 @@ void Nudging::initialize_impl (const RunType /* run_type */)
     // First copy of the field: what's read from file, and time-interpolated.
     auto field_ext = create_helper_field(name_ext, layout_ext, grid_ext->name());
 
-    // Second copy of the field: after horiz interp (alias "ext" if no remap)
+    // Second copy of the field: after horiz interp (alias "ext" if no remap).
+    // If we remap on load, "ext" is overwritten as data is read, so we need a separate copy.
     Field field_tmp;
-    if (m_refine_remap) {
+    if (m_refine_remap or m_remap_on_load) {
       field_tmp = create_helper_field(name_tmp, layout_tmp, grid_tmp->name());
     } else {
       field_tmp = field_ext.alias(name_tmp);
       m_helper_fields[name_tmp] = field_tmp;
     }
 
-    // Add the field to the time interpolator
-    m_time_interp.add_field(field_ext.alias(name), true);
-
-    // Register the fields with the remapper
-    m_horiz_remapper->register_field(field_ext, field_tmp);
+    // Register the fields with the time interpolator and the remapper
+    register_data_field(name, field_ext, field_tmp);
 
     if (m_timescale>0) {
       // Third copy of the field: after vert interpolation.
@@ -278,15 +353,14 @@ void Nudging::initialize_impl (const RunType /* run_type */)
   if (m_src_pres_type == TIME_DEPENDENT_3D_PROFILE && !m_skip_vert_interpolation) {
     // If the pressure profile is 3d and time-dep, we need to interpolate (in time/horiz)
     auto pmid_ext = create_helper_field("p_mid_ext", layout_ext, grid_ext->name());
-    m_time_interp.add_field(pmid_ext.alias("p_mid"),true);
     Field pmid_tmp;
-    if (m_refine_remap) {
+    if (m_refine_remap or m_remap_on_load) {
       pmid_tmp = create_helper_field("p_mid_tmp", layout_tmp, grid_tmp->name());
     } else {
       pmid_tmp = pmid_ext.alias("p_mid_tmp");
       m_helper_fields["p_mid_tmp"] = pmid_tmp;
     }
-    m_horiz_remapper->register_field(pmid_ext,pmid_tmp);
+    register_data_field("p_mid", pmid_ext, pmid_tmp);
     create_helper_field("padded_p_mid_tmp",layout_padded,"");
   } else if (m_src_pres_type == STATIC_1D_VERTICAL_PROFILE) {
     // For static 1D profile, we can read p_mid now
@@ -303,8 +377,17 @@ void Nudging::initialize_impl (const RunType /* run_type */)
   }
 
   // Close the registration
-  m_time_interp.initialize_data_from_files();
   m_horiz_remapper->registration_ends();
+  if (m_remap_on_load) {
+    // Masked values must be cured before horiz remap. Only nudged fields may be masked.
+    auto fixer = [this](const Field& f) {
+      if (ekat::contains(m_fields_nudge,f.name())) {
+        correct_masked_values(f);
+      }
+    };
+    m_time_interp.set_file_data_remapper(m_horiz_remapper,fixer);
+  }
+  m_time_interp.initialize_data_from_files();
 
   // load nudging weights from file
   // NOTE: the regional nudging use the same grid as the run, no need to
@@ -330,64 +413,17 @@ void Nudging::run_impl (const double dt)
   // Perform time interpolation
   m_time_interp.perform_time_interpolation(end_of_step_ts());
 
-  // If the input data contains "masked" values (sometimes also called "filled" values),
-  // the horiz remapping would smear them around. To prevent that, we need to "cure"
-  // these values. Masked values can only happen at top/bot of the model (with top
-  // being not common), and they must be a contiguous set of entries. So to cure them,
-  // we simply set all bot/top masked entries equal to the first non-masked value
-  // from the bot/top respectively. This corresponds to a constant extrapolation.
-  // NOTE: we need to do a tol check, since time interpolation may not return fillValue,
-  //       even if both f(t_beg)/f(t_end) are equal to fillValue (due to rounding).
-  // NOTE: if f(t_beg)==fillValue!=f(t_end), or viceversa, the time-interpolated value can
-  //       substantially differ from fillValue. Here, we assume it didn't happen.
-  auto correct_masked_values = [&](const Field f) {
-    const auto fl = f.get_header().get_identifier().get_layout();
-    const auto v  = f.get_view<Real**>();
-
-    Real var_fill_value = constants::DefaultFillValue<Real>().value;
-    // Query the helper field for the fill value, if not present use default
-    if (f.get_header().has_extra_data("mask_value")) {
-      var_fill_value = f.get_header().get_extra_data<Real>("mask_value");
+  if (not m_remap_on_load) {
+    // Correct before horiz remap
+    for (const auto& name: m_fields_nudge) {
+      const auto f  = get_helper_field(name+"_ext");
+      correct_masked_values(f);
     }
 
-    const int ncols = fl.dim(0);
-    const int nlevs = fl.dim(1);
-    const auto thresh = std::abs(var_fill_value)*0.0001;
-    auto lambda = KOKKOS_LAMBDA(const int icol) {
-      int first_good = nlevs;
-      int last_good = -1;
-      for (int k=0; k<nlevs; ++k) {
-        if (std::abs(v(icol,k)-var_fill_value)>thresh) {
-          // This entry is substantially different from var_fill_value, so it's good
-          first_good = ekat::impl::min(first_good,k);
-          last_good  = ekat::impl::max(last_good,k);
-        }
-      }
-      EKAT_KERNEL_REQUIRE_MSG (first_good<nlevs and last_good>=0,
-          "[Nudging] Error! Could not locate a non-masked entry in a column.\n");
-
-      // Fix near TOM
-      for (int k=0; k<first_good; ++k) {
-        v(icol,k) = v(icol,first_good);
-      }
-      // Fix near surf
-      for (int k=last_good+1; k<nlevs; ++k) {
-        v(icol,k) = v(icol,last_good);
-      }
-    };
-
-    Kokkos::parallel_for(RangePolicy(0,ncols),lambda);
-  };
-
-  // Correct before horiz remap
-  for (const auto& name: m_fields_nudge) {
-    const auto f  = get_helper_field(name+"_ext");
-    correct_masked_values(f);
+    // Perform horizontal remap (if needed)
+    m_horiz_remapper->remap_fwd();
   }
 
-  // Perform horizontal remap (if needed)
-  m_horiz_remapper->remap_fwd();
-
   // bypass copy_and_pad and vert_interp for skip_vert_interpolation:
   if (m_skip_vert_interpolation) {
     for (const auto& name : m_fields_nudge) {
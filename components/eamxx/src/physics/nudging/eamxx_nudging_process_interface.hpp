@@ -49,6 +49,9 @@ protected:
   // NOTE: this method will handle weighted and cutoff cases as well
   void apply_tendency (Field &state, const Field &nudge, const Real dt) const;
 
+  // Internal function to replace masked values at top/bot of each column
+  void correct_masked_values (const Field& f) const;
+
 protected:
 
   Field get_field_out_wrap(const std::string& field_name);
@@ -74,6 +77,9 @@ protected:
   int m_timescale;
   bool m_use_weights;
   bool m_skip_vert_interpolation;
+  // If true, horiz remap (and masked values correction) is done once per data slice,
+  // and time interpolation happens after horiz remap
+  bool m_remap_on_load;
   std::vector<std::string> m_datafiles;
   std::string              m_static_vertical_pressure_file;
   // add nudging weights for regional nudging update
@@ -462,6 +462,57 @@ TEST_CASE("nudging_tests") {
     root_print (msg + (ok ? " PASS\n" : " FAIL\n"));
   }
 
+  SECTION ("remap-on-load") {
+    std::string msg = " -> Testing remap on load ...............................";
+    root_print (msg + "\n");
+    bool ok = true;
+
+    // Remapping each data slice when it is loaded must give the same results as
+    // remapping the time-interpolated data at every step. Since nudging runs at the
+    // data time points, and the remap weights are 1 or 1/2, results must be BFB.
+    auto run_and_compare = [&](const std::string& data_file,
+                               const std::string& map,
+                               const std::shared_ptr<GridsManager>& gm) {
+      auto grid = gm->get_grid("point_grid");
+
+      std::vector<std::shared_ptr<FieldManager>> fms;
+      std::vector<std::shared_ptr<Nudging>> nudgings;
+      for (bool remap_on_load : {false,true}) {
+        ekat::ParameterList params;
+        params.set<strvec_t>("nudging_filenames_patterns",{data_file});
+        params.set<std::string>("source_pressure_type","TIME_DEPENDENT_3D_PROFILE");
+        if (map!="") {
+          params.set<std::string>("nudging_refine_remap_mapfile",map);
+        }
+        params.set<strvec_t>("nudging_fields",{"U"});
+        params.set<bool>("nudging_remap_on_load",remap_on_load);
+        params.get<std::string>("log_level","warn");
+
+        // Create fm. Init p_mid, which is the same for both runs
+        auto fm = create_fm(grid);
+        compute_field(fm->get_field("p_mid"),get_t0(),comm,0);
+        fms.push_back(fm);
+
+        // Create and init nudging process
+        nudgings.push_back(create_nudging(comm,params,fm,gm,get_t0()));
+      }
+
+      for (int n=0; ok and n<nsteps_data; ++n) {
+        // Run nudging
+        for (auto& nudging : nudgings) {
+          nudging->run(dt_data);
+        }
+
+        CHECK (views_are_equal(fms[0]->get_field("U"),fms[1]->get_field("U")));
+        ok &= catch_capture.lastAssertionPassed();
+      }
+    };
+
+    run_and_compare(nudging_data,map_file,gm_fine_h);
+    run_and_compare(nudging_data_filled,"",gm_data);
+    root_print (msg + (ok ? " PASS\n" : " FAIL\n"));
+  }
+
   // Clean up scorpio
   scorpio::finalize_subsystem();
 }
@@ -15,7 +15,14 @@ namespace scream
 P3Microphysics::P3Microphysics(const ekat::Comm& comm, const ekat::ParameterList& params)
   : AtmosphereProcess(comm, params)
 {
-  // Nothing to do here
+  // Monolithic or small kernels. The default is set at configure time, but it can be
+  // overridden here, or chosen by timing both modes during the first steps ('auto')
+  const auto kernel_mode = m_params.get<std::string>("kernel_mode","default");
+  if (kernel_mode=="default") {
+    m_kernel_mode = P3F::default_small_kernels ? physics::KernelMode::Small : physics::KernelMode::Monolithic;
+  } else {
+    m_kernel_mode = physics::str2kernel_mode(kernel_mode);
+  }
 }
 
 // =========================================================================================
@@ -169,7 +176,7 @@ size_t P3Microphysics::requested_buffer_size_in_bytes() const
   const Int nk_pack_p1 = ekat::npack<Spack>(m_num_levs+1);
 
   // Number of Reals needed by local views in the interface
-  const size_t interface_request =
+  size_t interface_request =
       // 1d view scalar, size (ncol)
       Buffer::num_1d_scalar*m_num_cols*sizeof(Real) +
       // 2d view packed, size (ncol, nlev_packs)
@@ -177,6 +184,9 @@ size_t P3Microphysics::requested_buffer_size_in_bytes() const
       Buffer::num_2dp1_vector*m_num_cols*nk_pack_p1*sizeof(Spack) +
       // 2d view scalar, size (ncol, 3)
       m_num_cols*3*sizeof(Real);
+  if (m_kernel_mode==physics::KernelMode::Small) {
+    interface_request += Buffer::num_2d_vector_sk*m_num_cols*nk_pack*sizeof(Spack);
+  }
 
   // Number of Reals needed by the WorkspaceManager passed to p3_main
   const auto policy       = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nk_pack);
@@ -216,8 +226,22 @@ void P3Microphysics::init_buffers(const ATMBufferManager &buffer_manager)
   spack_2d_view_t* _2d_spack_mid_view_ptrs[Buffer::num_2d_vector] = {
     &m_buffer.inv_exner, &m_buffer.th_atm, &m_buffer.cld_frac_l, &m_buffer.cld_frac_i,
     &m_buffer.dz, &m_buffer.qv2qi_depos_tend, &m_buffer.rho_qi, &m_buffer.unused
-#ifdef SCREAM_P3_SMALL_KERNELS
-    , &m_buffer.mu_r, &m_buffer.T_atm, &m_buffer.lamr, &m_buffer.logn0r, &m_buffer.nu,
+  };
+  for (int i=0; i<Buffer::num_2d_vector; ++i) {
+    *_2d_spack_mid_view_ptrs[i] = spack_2d_view_t(s_mem, m_num_cols, nk_pack);
+    s_mem += _2d_spack_mid_view_ptrs[i]->size();
+  }
+
+  // Temporaries for small kernels. If small kernels are selected, they live in the buffer manager.
+  // While autotuning, they get their own allocation, which is released if monolithic
+  // kernels are selected (see run_impl).
+  Spack* sk_mem = s_mem;
+  if (m_kernel_mode==physics::KernelMode::Auto) {
+    m_sk_temporaries_mem = decltype(m_sk_temporaries_mem)("p3_sk_temporaries",Buffer::num_2d_vector_sk*m_num_cols*nk_pack);
+    sk_mem = m_sk_temporaries_mem.data();
+  }
+  spack_2d_view_t* _2d_spack_mid_sk_view_ptrs[Buffer::num_2d_vector_sk] = {
+    &m_buffer.mu_r, &m_buffer.T_atm, &m_buffer.lamr, &m_buffer.logn0r, &m_buffer.nu,
     &m_buffer.cdist, &m_buffer.cdist1, &m_buffer.cdistr, &m_buffer.inv_cld_frac_i,
     &m_buffer.inv_cld_frac_l, &m_buffer.inv_cld_frac_r, &m_buffer.qc_incld, &m_buffer.qr_incld,
     &m_buffer.qi_incld, &m_buffer.qm_incld, &m_buffer.nc_incld, &m_buffer.nr_incld,
@@ -230,11 +254,14 @@ void P3Microphysics::init_buffers(const ATMBufferManager &buffer_manager)
     &m_buffer.v_nc, &m_buffer.flux_qx, &m_buffer.flux_nx, &m_buffer.v_qit, &m_buffer.v_nit,
     &m_buffer.flux_nit, &m_buffer.flux_bir, &m_buffer.flux_qir, &m_buffer.flux_qit, &m_buffer.v_qr,
     &m_buffer.v_nr
-#endif
   };
-  for (int i=0; i<Buffer::num_2d_vector; ++i) {
-    *_2d_spack_mid_view_ptrs[i] = spack_2d_view_t(s_mem, m_num_cols, nk_pack);
-    s_mem += _2d_spack_mid_view_ptrs[i]->size();
+  const bool alloc_sk = m_kernel_mode!=physics::KernelMode::Monolithic;
+  for (int i=0; alloc_sk and i<Buffer::num_2d_vector_sk; ++i) {
+    *_2d_spack_mid_sk_view_ptrs[i] = spack_2d_view_t(sk_mem, m_num_cols, nk_pack);
+    sk_mem += _2d_spack_mid_sk_view_ptrs[i]->size();
+  }
+  if (m_kernel_mode==physics::KernelMode::Small) {
+    s_mem = sk_mem;
   }
 
   spack_2d_view_t* _2d_spack_int_view_ptrs[Buffer::num_2dp1_vector] = {
@@ -283,8 +310,7 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   add_postcondition_check<FieldWithinIntervalCheck>(get_field_out("eff_radius_qr"),m_grid,0.0,5.0e3,false);
 
   // Initialize p3
-  lookup_tables = P3F::p3_init(/* write_tables = */ false,
-                               this->get_comm().am_i_root());
+  lookup_tables = P3F::p3_init(this->get_comm());
 
   // Initialize all of the structures that are passed to p3_main in run_impl.
   // Note: Some variables in the structures are not stored in the field manager.  For these
@@ -433,8 +459,7 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
     history_only.qc_sed = m_buffer.unused;
     history_only.qi_sed = m_buffer.unused;
   }
-#ifdef SCREAM_P3_SMALL_KERNELS
-  // Temporaries
+  // Temporaries for small kernels (unallocated if kernel_mode=monolithic)
   temporaries.mu_r                    = m_buffer.mu_r;
   temporaries.T_atm                   = m_buffer.T_atm;
   temporaries.lamr                    = m_buffer.lamr;
@@ -490,7 +515,8 @@ void P3Microphysics::initialize_impl (const RunType /* run_type */)
   temporaries.flux_qit                = m_buffer.flux_qit;
   temporaries.v_qr                    = m_buffer.v_qr;
   temporaries.v_nr                    = m_buffer.v_nr;
-#endif
+
+  m_kernel_mode_tuner = physics::KernelModeTuner(get_comm(),m_kernel_mode);
 
   // -- Set values for the post-amble structure
   p3_postproc.set_variables(m_num_cols,nk_pack,
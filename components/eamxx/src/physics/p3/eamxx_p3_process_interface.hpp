@@ -4,6 +4,7 @@
 #include "share/atm_process/atmosphere_process.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 #include "physics/p3/p3_functions.hpp"
+#include "physics/share/eamxx_kernel_mode_tuner.hpp"
 #include "share/util/eamxx_common_physics_functions.hpp"
 
 #include <string>
@@ -390,12 +391,10 @@ public:
     // 1d view scalar, size (ncol)
     static constexpr int num_1d_scalar = 2; //no 2d vars now, but keeping 1d struct for future expansion
     // 2d view packed, size (ncol, nlev_packs)
-#ifdef SCREAM_P3_SMALL_KERNELS
-    static constexpr int num_2d_vector = 63;
-#else
     static constexpr int num_2d_vector = 8;
-#endif
     static constexpr int num_2dp1_vector = 2;
+    // Temporaries for small kernels, only allocated if small kernels may be used
+    static constexpr int num_2d_vector_sk = 55;
 
     uview_1d precip_liq_surf_flux;
     uview_1d precip_ice_surf_flux;
@@ -410,7 +409,6 @@ public:
     uview_2d precip_ice_flux; //nlev+1
     uview_2d unused;
 
-#ifdef SCREAM_P3_SMALL_KERNELS
     uview_2d
       mu_r, T_atm, lamr, logn0r, nu, cdist, cdist1, cdistr,
       inv_cld_frac_i, inv_cld_frac_l, inv_cld_frac_r,
@@ -423,7 +421,6 @@ public:
       mu_c, lamc, qr_evap_tend, v_qc, v_nc, flux_qx, flux_nx,
       v_qit, v_nit, flux_nit, flux_bir, flux_qir, flux_qit,
       v_qr, v_nr;
-#endif
 
     suview_2d col_location;
 
@@ -458,14 +455,19 @@ protected:
   P3F::P3DiagnosticOutputs diag_outputs;
   P3F::P3HistoryOnly       history_only;
   P3F::P3LookupTables      lookup_tables;
-#ifdef SCREAM_P3_SMALL_KERNELS
   P3F::P3Temporaries       temporaries;
-#endif
   P3F::P3Infrastructure    infrastructure;
   P3F::P3Runtime           runtime_options;
   p3_preamble              p3_preproc;
   p3_postamble             p3_postproc;
 
+  // Monolithic vs small kernels (possibly autotuned during the first steps)
+  physics::KernelMode       m_kernel_mode;
+  physics::KernelModeTuner  m_kernel_mode_tuner;
+
+  // Memory for the small kernels temporaries while autotuning (see init_buffers)
+  typename P3F::view_1d<Spack> m_sk_temporaries_mem;
+
   // WSM for internal local variables
   ekat::WorkspaceManager<Spack, KT::Device> workspace_mgr;
 
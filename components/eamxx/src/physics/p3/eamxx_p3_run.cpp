@@ -51,12 +51,23 @@ void P3Microphysics::run_impl (const double dt)
     get_field_out("qi_sed").deep_copy(0.0);
   }
 
-  P3F::p3_main(runtime_options, prog_state, diag_inputs, diag_outputs, infrastructure,
-               history_only, lookup_tables,
-#ifdef SCREAM_P3_SMALL_KERNELS
-               temporaries,
-#endif
-               workspace_mgr, m_num_cols, m_num_levs);
+  runtime_options.small_kernels = m_kernel_mode_tuner.use_small_kernels();
+  const auto elapsed_microsec = P3F::p3_main(runtime_options, prog_state, diag_inputs, diag_outputs, infrastructure,
+                                             history_only, lookup_tables, temporaries,
+                                             workspace_mgr, m_num_cols, m_num_levs);
+  if (m_kernel_mode_tuner.record(elapsed_microsec)) {
+    this->log(LogLevel::info,
+        "P3 kernel mode autotuning:\n"
+        "  - avg time (monolithic): " + std::to_string(m_kernel_mode_tuner.avg_time_monolithic()) + " us\n"
+        "  - avg time (small)     : " + std::to_string(m_kernel_mode_tuner.avg_time_small()) + " us\n"
+        "  - selected mode        : " + physics::e2str(m_kernel_mode_tuner.mode()) + "\n");
+    if (m_kernel_mode_tuner.mode()==physics::KernelMode::Monolithic) {
+      // The small kernels temporaries are no longer needed.
+      // NOTE: the corresponding m_buffer views are only used in initialize_impl.
+      temporaries = P3F::P3Temporaries();
+      m_sk_temporaries_mem = decltype(m_sk_temporaries_mem)();
+    }
+  }
 
   // Conduct the post-processing of the p3_main output.
   Kokkos::parallel_for(
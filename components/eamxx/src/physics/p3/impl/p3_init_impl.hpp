@@ -10,28 +10,96 @@ namespace p3 {
 
 namespace {
 
-template <typename S, typename IceT, typename CollT>
-void read_ice_lookup_tables(const bool masterproc, const char* p3_lookup_base, const char* p3_version, IceT& ice_table_vals, CollT& collect_table_vals, int densize, int rimsize, int isize, int rcollsize)
+// If a comm is provided, only its root rank reads table files, and the
+// other ranks receive the data via broadcast. Otherwise, every rank reads.
+inline bool is_table_reader (const ekat::Comm* comm)
 {
-  using DeviceIcetable = typename IceT::non_const_type;
-  using DeviceColtable = typename CollT::non_const_type;
+  return comm==nullptr or comm->am_i_root();
+}
 
-  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
-  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
+template <typename HostView>
+void broadcast_table (const ekat::Comm* comm, const HostView& table_h)
+{
+  if (comm!=nullptr and comm->size()>1) {
+    comm->broadcast(table_h.data(),table_h.size(),comm->root_rank());
+  }
+}
 
-  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
-  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
+inline std::string table_file_extension ()
+{
+#ifdef SCREAM_DOUBLE_PRECISION
+  return "8";
+#else
+  return "4";
+#endif
+}
 
-  //
-  // read in ice microphysics table into host views. We always read these as doubles.
-  //
+// Binary copy of the ice/collect tables, as stored in the views (i.e., after the
+// conversions done while parsing the ascii file). The header stores the table
+// version, the table dims, and the size of the scalar type, so that a stale or
+// incompatible file is detected (and ignored).
+inline std::string ice_table_cache_filename (const char* dir, const char* p3_version)
+{
+  return std::string(dir) + "/p3_ice_tables_v" + p3_version + ".dat" + table_file_extension();
+}
+
+template <typename S, typename IceH, typename CollH>
+bool read_ice_table_cache(const std::string& filename, const char* p3_version, const IceH& ice_table_vals_h, const CollH& collect_table_vals_h, int densize, int rimsize, int isize, int rcollsize)
+{
+  std::ifstream in(filename, std::ios::binary);
+  if (not in.good()) {
+    return false;
+  }
+
+  const std::string expected_version(p3_version);
+  int version_len = 0;
+  in.read(reinterpret_cast<char*>(&version_len),sizeof(int));
+  if (not in.good() or version_len!=static_cast<int>(expected_version.size())) {
+    return false;
+  }
+  std::string version(version_len,' ');
+  in.read(&version[0],version_len);
+
+  int dims[5];
+  in.read(reinterpret_cast<char*>(dims),sizeof(dims));
+  if (not in.good() or version!=expected_version or
+      dims[0]!=densize or dims[1]!=rimsize or dims[2]!=isize or dims[3]!=rcollsize or
+      dims[4]!=static_cast<int>(sizeof(S))) {
+    return false;
+  }
 
-  std::string filename = std::string(p3_lookup_base) + std::string(p3_version);
+  in.read(reinterpret_cast<char*>(ice_table_vals_h.data()),sizeof(S)*ice_table_vals_h.size());
+  in.read(reinterpret_cast<char*>(collect_table_vals_h.data()),sizeof(S)*collect_table_vals_h.size());
+  return in.good();
+}
 
+template <typename S, typename IceT, typename CollT>
+void write_ice_table_cache(const bool masterproc, const char* dir, const char* p3_version, const IceT& ice_table_vals, const CollT& collect_table_vals, int densize, int rimsize, int isize, int rcollsize)
+{
+  const auto filename = ice_table_cache_filename(dir,p3_version);
   if (masterproc) {
-    std::cout << "Reading ice lookup tables in file: " << filename << std::endl;
+    std::cout << "Writing binary ice lookup tables in file: " << filename << std::endl;
   }
 
+  const auto ice_table_vals_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),ice_table_vals);
+  const auto collect_table_vals_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),collect_table_vals);
+
+  const std::string version(p3_version);
+  const int version_len = version.size();
+  const int dims[5] = {densize, rimsize, isize, rcollsize, static_cast<int>(sizeof(S))};
+
+  std::ofstream out(filename, std::ios::binary);
+  out.write(reinterpret_cast<const char*>(&version_len),sizeof(int));
+  out.write(version.data(),version_len);
+  out.write(reinterpret_cast<const char*>(dims),sizeof(dims));
+  out.write(reinterpret_cast<const char*>(ice_table_vals_h.data()),sizeof(S)*ice_table_vals_h.size());
+  out.write(reinterpret_cast<const char*>(collect_table_vals_h.data()),sizeof(S)*collect_table_vals_h.size());
+  EKAT_REQUIRE_MSG(out.good(), "Error! Could not write binary ice lookup tables in file " << filename);
+}
+
+template <typename S, typename IceH, typename CollH>
+void parse_ice_lookup_tables(const std::string& filename, const char* p3_version, const IceH& ice_table_vals_h, const CollH& collect_table_vals_h, int densize, int rimsize, int isize, int rcollsize)
+{
   std::ifstream in(filename);
 
   // read header
@@ -69,6 +137,41 @@ void read_ice_lookup_tables(const bool masterproc, const char* p3_lookup_base, c
       }
     }
   }
+}
+
+template <typename S, typename IceT, typename CollT>
+void read_ice_lookup_tables(const ekat::Comm* comm, const bool masterproc, const char* p3_lookup_base, const char* p3_version, const char* dir, const bool use_cache, IceT& ice_table_vals, CollT& collect_table_vals, int densize, int rimsize, int isize, int rcollsize)
+{
+  using DeviceIcetable = typename IceT::non_const_type;
+  using DeviceColtable = typename CollT::non_const_type;
+
+  const auto ice_table_vals_d     = DeviceIcetable("ice_table_vals");
+  const auto collect_table_vals_d = DeviceColtable("collect_table_vals");
+
+  const auto ice_table_vals_h    = Kokkos::create_mirror_view(ice_table_vals_d);
+  const auto collect_table_vals_h = Kokkos::create_mirror_view(collect_table_vals_d);
+
+  //
+  // read in ice microphysics table into host views. Parsing the ascii file is
+  // slow, so use the binary copy (if present and valid) instead.
+  //
+
+  if (is_table_reader(comm)) {
+    const auto cache_filename = ice_table_cache_filename(dir,p3_version);
+    if (use_cache and read_ice_table_cache<S>(cache_filename, p3_version, ice_table_vals_h, collect_table_vals_h, densize, rimsize, isize, rcollsize)) {
+      if (masterproc) {
+        std::cout << "Read binary ice lookup tables in file: " << cache_filename << std::endl;
+      }
+    } else {
+      std::string filename = std::string(p3_lookup_base) + std::string(p3_version);
+      if (masterproc) {
+        std::cout << "Reading ice lookup tables in file: " << filename << std::endl;
+      }
+      parse_ice_lookup_tables<S>(filename, p3_version, ice_table_vals_h, collect_table_vals_h, densize, rimsize, isize, rcollsize);
+    }
+  }
+  broadcast_table(comm, ice_table_vals_h);
+  broadcast_table(comm, collect_table_vals_h);
 
   // deep copy to device
   Kokkos::deep_copy(ice_table_vals_d, ice_table_vals_h);
@@ -211,19 +314,13 @@ static void action(StreamT& stream, S* data, const size_t size)
 }
 
 template <bool IsRead, typename MuRT, typename VNT, typename VMT, typename RevapT>
-void io_impl(const bool masterproc, const char* dir, MuRT& mu_r_table_vals, VNT& vn_table_vals, VMT& vm_table_vals, RevapT& revap_table_vals)
+void io_impl(const ekat::Comm* comm, const bool masterproc, const char* dir, MuRT& mu_r_table_vals, VNT& vn_table_vals, VMT& vm_table_vals, RevapT& revap_table_vals)
 {
   if (masterproc) {
     std::cout << (IsRead ? "Reading" : "Writing") << " lookup (non-ice) tables in dir " << dir << std::endl;
   }
 
-  std::string extension =
-#ifdef SCREAM_DOUBLE_PRECISION
-    "8"
-#else
-    "4"
-#endif
-    ;
+  const std::string extension = table_file_extension();
 
   // Get host views
   auto mu_r_table_vals_h  = Kokkos::create_mirror_view(mu_r_table_vals);
@@ -240,19 +337,26 @@ void io_impl(const bool masterproc, const char* dir, MuRT& mu_r_table_vals, VNT&
 
   using stream_t = std::conditional_t<IsRead,std::ifstream,std::ofstream>;
 
-  stream_t mu_r_file(mu_r_filename.c_str(), std::ios::binary);
-  stream_t revap_file(revap_filename.c_str(), std::ios::binary);
-  stream_t vn_file(vn_filename.c_str(), std::ios::binary);
-  stream_t vm_file(vm_filename, std::ios::binary);
-
-  // Read files
-  action(mu_r_file, mu_r_table_vals_h.data(), mu_r_table_vals.size());
-  action(revap_file, revap_table_vals_h.data(), revap_table_vals.size());
-  action(vn_file, vn_table_vals_h.data(), vn_table_vals.size());
-  action(vm_file, vm_table_vals_h.data(), vm_table_vals.size());
+  if (is_table_reader(comm)) {
+    stream_t mu_r_file(mu_r_filename.c_str(), std::ios::binary);
+    stream_t revap_file(revap_filename.c_str(), std::ios::binary);
+    stream_t vn_file(vn_filename.c_str(), std::ios::binary);
+    stream_t vm_file(vm_filename, std::ios::binary);
+
+    // Read files
+    action(mu_r_file, mu_r_table_vals_h.data(), mu_r_table_vals.size());
+    action(revap_file, revap_table_vals_h.data(), revap_table_vals.size());
+    action(vn_file, vn_table_vals_h.data(), vn_table_vals.size());
+    action(vm_file, vm_table_vals_h.data(), vm_table_vals.size());
+  }
 
   // Copy back to device
   if constexpr (IsRead) {
+    broadcast_table(comm, mu_r_table_vals_h);
+    broadcast_table(comm, revap_table_vals_h);
+    broadcast_table(comm, vn_table_vals_h);
+    broadcast_table(comm, vm_table_vals_h);
+
     Kokkos::deep_copy(mu_r_table_vals, mu_r_table_vals_h);
     Kokkos::deep_copy(revap_table_vals, revap_table_vals_h);
     Kokkos::deep_copy(vn_table_vals, vn_table_vals_h);
@@ -261,7 +365,7 @@ void io_impl(const bool masterproc, const char* dir, MuRT& mu_r_table_vals, VNT&
 }
 
 template <typename MuRT, typename VNT, typename VMT, typename RevapT>
-void read_computed_tables(const bool masterproc, const char* dir, MuRT& mu_r_table_vals, VNT& vn_table_vals, VMT& vm_table_vals, RevapT& revap_table_vals)
+void read_computed_tables(const ekat::Comm* comm, const bool masterproc, const char* dir, MuRT& mu_r_table_vals, VNT& vn_table_vals, VMT& vm_table_vals, RevapT& revap_table_vals)
 {
   using MuRT_NC   = typename MuRT::non_const_type;
   using VNT_NC    = typename VNT::non_const_type;
@@ -273,7 +377,7 @@ void read_computed_tables(const bool masterproc, const char* dir, MuRT& mu_r_tab
   VMT_NC    vm_table_vals_nc("vm_table_vals");
   RevapT_NC revap_table_vals_nc("revap_table_vals");
 
-  io_impl<true>(masterproc, dir, mu_r_table_vals_nc, vn_table_vals_nc, vm_table_vals_nc, revap_table_vals_nc);
+  io_impl<true>(comm, masterproc, dir, mu_r_table_vals_nc, vn_table_vals_nc, vm_table_vals_nc, revap_table_vals_nc);
 
   mu_r_table_vals = mu_r_table_vals_nc;
   vn_table_vals = vn_table_vals_nc;
@@ -284,7 +388,7 @@ void read_computed_tables(const bool masterproc, const char* dir, MuRT& mu_r_tab
 template <typename MuRT, typename VNT, typename VMT, typename RevapT>
 void write_computed_tables(const bool masterproc, const char* dir, const MuRT& mu_r_table_vals, const VNT& vn_table_vals, const VMT& vm_table_vals, const RevapT& revap_table_vals)
 {
-  io_impl<false>(masterproc, dir, mu_r_table_vals, vn_table_vals, vm_table_vals, revap_table_vals);
+  io_impl<false>(nullptr, masterproc, dir, mu_r_table_vals, vn_table_vals, vm_table_vals, revap_table_vals);
 }
 
 template <typename S, typename DnuT>
@@ -312,32 +416,46 @@ void compute_dnu(DnuT& dnu_table_vals)
   dnu_table_vals = DnuT(dnu_table_vals_non_const);
 }
 
-}
-
-/*
- * Implementation of p3 init. Clients should NOT #include
- * this file, #include p3_functions.hpp instead.
- */
-template <typename S, typename D>
-typename Functions<S,D>::P3LookupTables Functions<S,D>
-::p3_init (const bool write_tables, const bool masterproc) {
-  P3LookupTables lookup_tables; // This struct could be our global singleton
+template <typename S, typename P3C, typename TablesT>
+void init_lookup_tables(const ekat::Comm* comm, const bool write_tables, const bool masterproc, TablesT& lookup_tables)
+{
   auto version = P3C::p3_version;
   auto p3_lookup_base = P3C::p3_lookup_base;
   static const char* dir = SCREAM_DATA_DIR "/tables";
   // p3_init_a (reads ice_table, collect_table)
-  read_ice_lookup_tables<S>(masterproc, p3_lookup_base, version, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals, P3C::densize, P3C::rimsize, P3C::isize, P3C::rcollsize);
+  read_ice_lookup_tables<S>(comm, masterproc, p3_lookup_base, version, dir, /* use_cache = */ not write_tables, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals, P3C::densize, P3C::rimsize, P3C::isize, P3C::rcollsize);
   if (write_tables) {
+    write_ice_table_cache<S>(masterproc, dir, version, lookup_tables.ice_table_vals, lookup_tables.collect_table_vals, P3C::densize, P3C::rimsize, P3C::isize, P3C::rcollsize);
     //p3_init_b (computes tables mu_r_table, revap_table, vn_table, vm_table)
     compute_tables<S, P3C>(masterproc, lookup_tables.mu_r_table_vals, lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, lookup_tables.revap_table_vals);
     write_computed_tables(masterproc, dir, lookup_tables.mu_r_table_vals, lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, lookup_tables.revap_table_vals);
   }
   else {
-    read_computed_tables(masterproc, dir, lookup_tables.mu_r_table_vals, lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, lookup_tables.revap_table_vals);
+    read_computed_tables(comm, masterproc, dir, lookup_tables.mu_r_table_vals, lookup_tables.vn_table_vals, lookup_tables.vm_table_vals, lookup_tables.revap_table_vals);
   }
   // dnu is always computed/hardcoded
   compute_dnu<S>(lookup_tables.dnu_table_vals);
+}
 
+}
+
+/*
+ * Implementation of p3 init. Clients should NOT #include
+ * this file, #include p3_functions.hpp instead.
+ */
+template <typename S, typename D>
+typename Functions<S,D>::P3LookupTables Functions<S,D>
+::p3_init (const bool write_tables, const bool masterproc) {
+  P3LookupTables lookup_tables; // This struct could be our global singleton
+  init_lookup_tables<S, P3C>(nullptr, write_tables, masterproc, lookup_tables);
+  return lookup_tables;
+}
+
+template <typename S, typename D>
+typename Functions<S,D>::P3LookupTables Functions<S,D>
+::p3_init (const ekat::Comm& comm, const bool write_tables) {
+  P3LookupTables lookup_tables;
+  init_lookup_tables<S, P3C>(&comm, write_tables, comm.am_i_root(), lookup_tables);
   return lookup_tables;
 }
 
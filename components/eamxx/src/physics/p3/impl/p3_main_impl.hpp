@@ -364,25 +364,28 @@ Int Functions<S,D>
   const P3Infrastructure& infrastructure,
   const P3HistoryOnly& history_only,
   const P3LookupTables& lookup_tables,
-#ifdef SCREAM_P3_SMALL_KERNELS
   const P3Temporaries& temporaries,
-#endif
   const WorkspaceManager& workspace_mgr,
   Int nj,
   Int nk)
 {
-#ifdef SCREAM_P3_SMALL_KERNELS
-  return p3_main_internal_disp(runtime_options,
-                               prognostic_state,
-                               diagnostic_inputs,
-                               diagnostic_outputs,
-                               infrastructure,
-                               history_only,
-                               lookup_tables,
-                               temporaries,
-                               workspace_mgr,
-                               nj, nk);
-#else
+  if (runtime_options.small_kernels) {
+    EKAT_REQUIRE_MSG (temporaries.mu_r.extent_int(0)>=nj and temporaries.v_nr.extent_int(0)>=nj,
+        "Error! P3 small kernels require temporaries for all columns.\n"
+        " - nj: " + std::to_string(nj) + "\n");
+
+    return p3_main_internal_disp(runtime_options,
+                                 prognostic_state,
+                                 diagnostic_inputs,
+                                 diagnostic_outputs,
+                                 infrastructure,
+                                 history_only,
+                                 lookup_tables,
+                                 temporaries,
+                                 workspace_mgr,
+                                 nj, nk);
+  }
+
   return p3_main_internal(runtime_options,
                           prognostic_state,
                           diagnostic_inputs,
@@ -392,7 +395,6 @@ Int Functions<S,D>
                           lookup_tables,
                           workspace_mgr,
                           nj, nk);
-#endif
 }
 } // namespace p3
 } // namespace scream
@@ -8,6 +8,7 @@
 #include "ekat/ekat_pack_kokkos.hpp"
 #include "ekat/ekat_workspace.hpp"
 #include "ekat/ekat_parameter_list.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
 
 namespace scream {
 namespace p3 {
@@ -108,6 +109,14 @@ struct Functions
   using WorkspaceManager = typename ekat::WorkspaceManager<Spack, Device>;
   using Workspace        = typename WorkspaceManager::Workspace;
 
+  // Whether p3_main uses small kernels by default. Both the monolithic and the small
+  // kernels are always built, so this can be overridden at runtime (see P3Runtime).
+#ifdef SCREAM_P3_SMALL_KERNELS
+  static constexpr bool default_small_kernels = true;
+#else
+  static constexpr bool default_small_kernels = false;
+#endif
+
   // Structure to store p3 runtime options
   struct P3Runtime {
 
@@ -138,6 +147,8 @@ struct Functions
     bool use_hetfrz_classnuc = false;
     bool use_separate_ice_liq_frac = false;
     bool extra_p3_diags = false;
+    // Run p3_main as a sequence of small kernels (requires P3Temporaries)
+    bool small_kernels = default_small_kernels;
 
     void load_runtime_options_from_file(ekat::ParameterList& params) {
       max_total_ni = params.get<double>("max_total_ni", max_total_ni);
@@ -327,7 +338,6 @@ struct Functions
     view_dnu_table dnu_table_vals;
   };
 
-#ifdef SCREAM_P3_SMALL_KERNELS
   struct P3Temporaries {
     P3Temporaries() = default;
     // shape parameter of rain
@@ -364,7 +374,6 @@ struct Functions
     // rain sedimentation
     view_2d<Spack> v_qr, v_nr;
   };
-#endif
 
   // -- Table3 --
 
@@ -398,6 +407,11 @@ struct Functions
   static P3LookupTables p3_init(const bool write_tables = false,
                                 const bool masterproc = false);
 
+  // Same as above, but only the root rank of comm reads the table files,
+  // and broadcasts the tables to the other ranks.
+  static P3LookupTables p3_init(const ekat::Comm& comm,
+                                const bool write_tables = false);
+
   // Map (mu_r, lamr) to Table3 data.
   KOKKOS_FUNCTION
   static void lookup(const Spack& mu_r, const Spack& lamr,
@@ -544,7 +558,6 @@ struct Functions
     const uview_1d<Spack>& nc_tend,
     Scalar& precip_liq_surf);
 
-#ifdef SCREAM_P3_SMALL_KERNELS
   static void cloud_sedimentation_disp(
     const uview_2d<Spack>& qc_incld,
     const uview_2d<const Spack>& rho,
@@ -566,7 +579,6 @@ struct Functions
     const uview_1d<Scalar>& precip_liq_surf,
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present);
-#endif
 
   // TODO: comment
   KOKKOS_FUNCTION
@@ -592,7 +604,6 @@ struct Functions
     Scalar& precip_liq_surf,
     const P3Runtime& runtime_options);
 
-#ifdef SCREAM_P3_SMALL_KERNELS
   static void rain_sedimentation_disp(
     const uview_2d<const Spack>& rho,
     const uview_2d<const Spack>& inv_rho,
@@ -615,7 +626,6 @@ struct Functions
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present,
     const P3Runtime& runtime_options);
-#endif
 
   // TODO: comment
   KOKKOS_FUNCTION
@@ -642,7 +652,6 @@ struct Functions
     Scalar& precip_ice_surf,
     const P3Runtime& runtime_options);
 
-#ifdef SCREAM_P3_SMALL_KERNELS
   static void ice_sedimentation_disp(
     const uview_2d<const Spack>& rho,
     const uview_2d<const Spack>& inv_rho,
@@ -666,7 +675,6 @@ struct Functions
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present,
     const P3Runtime& runtime_options);
-#endif
 
   // homogeneous freezing of cloud and rain
   KOKKOS_FUNCTION
@@ -685,7 +693,6 @@ struct Functions
     const uview_1d<Spack>& bm,
     const uview_1d<Spack>& th_atm);
 
-#ifdef SCREAM_P3_SMALL_KERNELS
   static void homogeneous_freezing_disp(
     const uview_2d<const Spack>& T_atm,
     const uview_2d<const Spack>& inv_exner,
@@ -701,7 +708,6 @@ struct Functions
     const uview_2d<Spack>& th_atm,
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present);
-#endif
 
   // -- Find layers
 
@@ -1000,11 +1006,9 @@ struct Functions
                            const Int& timestepcount, const bool& force_abort, const Int& source_ind, const MemberType& team,
                            const uview_1d<const Scalar>& col_loc);
 
-#ifdef SCREAM_P3_SMALL_KERNELS
   static void check_values_disp(const uview_2d<const Spack>& qv, const uview_2d<const Spack>& temp, const Int& ktop, const Int& kbot,
                            const Int& timestepcount, const bool& force_abort, const Int& source_ind,
                            const uview_2d<const Scalar>& col_loc, const Int& nj, const Int& nk);
-#endif
 
   KOKKOS_FUNCTION
   static void calculate_incloud_mixingratios(
@@ -1046,7 +1050,6 @@ struct Functions
     Scalar& precip_ice_surf,
     view_1d_ptr_array<Spack, 36>& zero_init);
 
-#ifdef SCREAM_P3_SMALL_KERNELS
   static void p3_main_init_disp(
     const Int& nj,const Int& nk_pack,
     const uview_2d<const Spack>& cld_frac_i, const uview_2d<const Spack>& cld_frac_l,
@@ -1067,7 +1070,6 @@ struct Functions
     const uview_2d<Spack>& qv_supersat_i, const uview_2d<Spack>& qtend_ignore, const uview_2d<Spack>& ntend_ignore, const uview_2d<Spack>& mu_c,
     const uview_2d<Spack>& lamc, const uview_2d<Spack>& rho_qi, const uview_2d<Spack>& qv2qi_depos_tend, const uview_2d<Spack>& precip_total_tend,
     const uview_2d<Spack>& nevapr, const uview_2d<Spack>& precip_liq_flux, const uview_2d<Spack>& precip_ice_flux);
-#endif
 
   KOKKOS_FUNCTION
   static void p3_main_part1(
@@ -1117,7 +1119,6 @@ struct Functions
     bool& is_hydromet_present,
     const P3Runtime& runtime_options);
 
-#ifdef SCREAM_P3_SMALL_KERNELS
   static void p3_main_part1_disp(
     const Int& nj,
     const Int& nk,
@@ -1164,7 +1165,6 @@ struct Functions
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present,
     const P3Runtime& runtime_options);
-#endif
 
   KOKKOS_FUNCTION
   static void p3_main_part2(
@@ -1259,7 +1259,6 @@ struct Functions
     const Int& nk,
     const P3Runtime& runtime_options);
 
-#ifdef SCREAM_P3_SMALL_KERNELS
   static void p3_main_part2_disp(
     const Int& nj,
     const Int& nk,
@@ -1351,7 +1350,6 @@ struct Functions
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present,
     const P3Runtime& runtime_options);
-#endif
 
   KOKKOS_FUNCTION
   static void p3_main_part3(
@@ -1394,7 +1392,6 @@ struct Functions
     const uview_1d<Spack>& diag_eff_radius_qr,
     const P3Runtime& runtime_options);
 
-#ifdef SCREAM_P3_SMALL_KERNELS
   static void p3_main_part3_disp(
     const Int& nj,
     const Int& nk_pack,
@@ -1436,7 +1433,6 @@ struct Functions
     const uview_1d<bool>& is_nucleat_possible,
     const uview_1d<bool>& is_hydromet_present,
     const P3Runtime& runtime_options);
-#endif
 
   // Return microseconds elapsed
   static Int p3_main(
@@ -1447,9 +1443,7 @@ struct Functions
     const P3Infrastructure& infrastructure,
     const P3HistoryOnly& history_only,
     const P3LookupTables& lookup_tables,
-#ifdef SCREAM_P3_SMALL_KERNELS
     const P3Temporaries& temporaries,
-#endif
     const WorkspaceManager& workspace_mgr,
     Int nj, // number of columns
     Int nk); // number of vertical cells per column
@@ -1466,7 +1460,6 @@ struct Functions
     Int nj, // number of columns
     Int nk); // number of vertical cells per column
 
-#ifdef SCREAM_P3_SMALL_KERNELS
   static Int p3_main_internal_disp(
     const P3Runtime& runtime_options,
     const P3PrognosticState& prognostic_state,
@@ -1479,7 +1472,6 @@ struct Functions
     const WorkspaceManager& workspace_mgr,
     Int nj, // number of columns
     Int nk); // number of vertical cells per column
-#endif
 
   KOKKOS_FUNCTION
   static void ice_supersat_conservation(Spack& qidep, Spack& qinuc, Spack& qinuc_cnt, const Spack& cld_frac_i, const Spack& qv, const Spack& qv_sat_i, const Spack& t_atm, const Real& dt, const Spack& qi2qv_sublim_tend, const Spack& qr2qv_evap_tend, const bool& use_hetfrz_classnuc, const Smask& context = Smask(true));
@@ -3,6 +3,7 @@
 #include "share/eamxx_types.hpp"
 #include "ekat/ekat_pack.hpp"
 #include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/mpi/ekat_comm.hpp"
 #include "p3_functions.hpp"
 #include "p3_test_data.hpp"
 
@@ -284,6 +285,29 @@ struct UnitWrap::UnitTest<D>::TestTableIce : public UnitWrap::UnitTest<D>::Base
     }
   }
 
+  // Tables read by the root rank and broadcast must match the ones read by every rank
+  void run_comm()
+  {
+    ekat::Comm comm(MPI_COMM_WORLD);
+    const auto tables      = Functions::p3_init();
+    const auto tables_comm = Functions::p3_init(comm);
+
+    const auto check = [](const auto& v, const auto& v_comm) {
+      const auto v_h      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),v);
+      const auto v_comm_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),v_comm);
+      REQUIRE (v_h.size()==v_comm_h.size());
+      for (size_t i=0; i<v_h.size(); ++i) {
+        REQUIRE (v_h.data()[i]==v_comm_h.data()[i]);
+      }
+    };
+    check(tables.ice_table_vals,     tables_comm.ice_table_vals);
+    check(tables.collect_table_vals, tables_comm.collect_table_vals);
+    check(tables.mu_r_table_vals,    tables_comm.mu_r_table_vals);
+    check(tables.revap_table_vals,   tables_comm.revap_table_vals);
+    check(tables.vn_table_vals,      tables_comm.vn_table_vals);
+    check(tables.vm_table_vals,      tables_comm.vm_table_vals);
+  }
+
   void run_phys()
   {
 #if 0
@@ -338,6 +362,7 @@ TEST_CASE("p3_ice_tables", "[p3_functions]")
   T t;
   t.run_phys();
   t.run_bfb();
+  t.run_comm();
 }
 
 }
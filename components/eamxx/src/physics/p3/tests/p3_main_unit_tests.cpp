@@ -453,6 +453,14 @@ void run_bfb_p3_main()
     }
   }
 
+  // The p3_sk_tests executable is built with P3_TEST_SMALL_KERNELS, to exercise
+  // the small kernels regardless of the default kernel mode
+#ifdef P3_TEST_SMALL_KERNELS
+  constexpr bool small_kernels = true;
+#else
+  constexpr bool small_kernels = Functions::default_small_kernels;
+#endif
+
   // Get data from cxx
   for (auto& d : isds_cxx) {
     p3_main_host(
@@ -461,7 +469,8 @@ void run_bfb_p3_main()
       d.precip_ice_surf, d.its, d.ite, d.kts, d.kte, d.diag_eff_radius_qc, d.diag_eff_radius_qi, d.diag_eff_radius_qr,
       d.rho_qi, d.do_predict_nc, d.do_prescribed_CCN, d.use_hetfrz_classnuc, d.dpres, d.inv_exner, d.qv2qi_depos_tend,
       d.precip_liq_flux, d.precip_ice_flux, d.cld_frac_r, d.cld_frac_l, d.cld_frac_i,
-      d.liq_ice_exchange, d.vap_liq_exchange, d.vap_ice_exchange, d.qv_prev, d.t_prev);
+      d.liq_ice_exchange, d.vap_liq_exchange, d.vap_ice_exchange, d.qv_prev, d.t_prev,
+      small_kernels);
   }
 
   if (SCREAM_BFB_TESTING && this->m_baseline_action == COMPARE) {
@@ -16,6 +16,7 @@
 #include "rrtmgp_utils.hpp"
 
 #include "physics/share/physics_constants.hpp"
+#include "share/util/eamxx_column_compaction.hpp"
 
 #include "ekat/mpi/ekat_comm.hpp"
 #include "ekat/logging/ekat_logger.hpp"
@@ -239,6 +240,10 @@ static void compute_broadband_surface_fluxes(
  * Main driver code to run RRTMGP.
  * The input logger is in charge of outputing info to
  * screen and/or to file (or neither), depending on how it was set up.
+ * The SW and LW solves can be skipped with do_sw/do_lw (e.g., if the SW solve
+ * is done separately, on a different set of columns). Cloud optical properties
+ * are always computed for SW, since they are used for diagnostics, while all
+ * LW inputs and outputs are left untouched if do_lw=false.
  */
 static void rrtmgp_main(
   const int ncol, const int nlay,
@@ -261,7 +266,8 @@ static void rrtmgp_main(
   const real3dk &lw_bnd_flux_up, const real3dk &lw_bnd_flux_dn,
   const Real tsi_scaling,
   const std::shared_ptr<spdlog::logger>& logger,
-  const bool extra_clnclrsky_diag = false, const bool extra_clnsky_diag = false)
+  const bool extra_clnclrsky_diag = false, const bool extra_clnsky_diag = false,
+  const bool do_sw = true, const bool do_lw = true)
 {
   const int sw_nband = k_dist_sw_k->get_nband();
   const int lw_nband = k_dist_lw_k->get_nband();
@@ -371,9 +377,11 @@ static void rrtmgp_main(
   ));
   aerosol_lw.init_no_alloc(k_dist_lw_k->get_band_lims_wavenumber(), lw_band2gpt_mem, lw_gpt2band_mem);
   aerosol_lw.alloc_1scl_no_alloc(ncol, nlay, lw_tau_mem);
-  TIMED_KERNEL(FLATTEN_MD_KERNEL3(ncol,nlay,nlwbands, icol, ilay, ibnd,
-    aerosol_lw.tau(icol,ilay,ibnd) = aer_tau_lw(icol,ilay,ibnd);
-  ));
+  if (do_lw) {
+    TIMED_KERNEL(FLATTEN_MD_KERNEL3(ncol,nlay,nlwbands, icol, ilay, ibnd,
+      aerosol_lw.tau(icol,ilay,ibnd) = aer_tau_lw(icol,ilay,ibnd);
+    ));
+  }
 
 #ifdef SCREAM_RRTMGP_DEBUG
   // Check aerosol optical properties
@@ -382,14 +390,19 @@ static void rrtmgp_main(
   check_range_k(aerosol_sw.tau,  0, 1e3, "rrtmgp_main:aerosol_sw.tau");
   check_range_k(aerosol_sw.ssa,  0,   1, "rrtmgp_main:aerosol_sw.ssa"); //, "aerosol_optics_sw.ssa");
   check_range_k(aerosol_sw.g  , -1,   1, "rrtmgp_main:aerosol_sw.g  "); //, "aerosol_optics_sw.g"  );
-  check_range_k(aerosol_lw.tau,  0, 1e3, "rrtmgp_main:aerosol_lw.tau");
+  if (do_lw) {
+    check_range_k(aerosol_lw.tau,  0, 1e3, "rrtmgp_main:aerosol_lw.tau");
+  }
 #endif
 
   // Convert cloud physical properties to optical properties for input to RRTMGP
   optical_props2_t clouds_sw = get_cloud_optics_sw(ncol, nlay, *cloud_optics_sw_k, *k_dist_sw_k, lwp, iwp, rel, rei, sw_cloud_band2gpt_mem, sw_cloud_gpt2band_mem, sw_cloud_tau_mem, sw_cloud_ssa_mem, sw_cloud_g_mem);
-  optical_props1_t clouds_lw = get_cloud_optics_lw(ncol, nlay, *cloud_optics_lw_k, *k_dist_lw_k, lwp, iwp, rel, rei, lw_cloud_band2gpt_mem, lw_cloud_gpt2band_mem, lw_cloud_tau_mem);
   Kokkos::deep_copy(cld_tau_sw_bnd, clouds_sw.tau);
-  Kokkos::deep_copy(cld_tau_lw_bnd, clouds_lw.tau);
+  optical_props1_t clouds_lw;
+  if (do_lw) {
+    clouds_lw = get_cloud_optics_lw(ncol, nlay, *cloud_optics_lw_k, *k_dist_lw_k, lwp, iwp, rel, rei, lw_cloud_band2gpt_mem, lw_cloud_gpt2band_mem, lw_cloud_tau_mem);
+    Kokkos::deep_copy(cld_tau_lw_bnd, clouds_lw.tau);
+  }
 
   // Do subcolumn sampling to map bands -> gpoints based on cloud fraction and overlap assumption;
   // This implements the Monte Carlo Independing Column Approximation by mapping only a single
@@ -399,16 +412,21 @@ static void rrtmgp_main(
 
   // Longwave
   auto nlwgpts = k_dist_lw_k->get_ngpt();
-  auto clouds_lw_gpt = get_subsampled_clouds(ncol, nlay, nlwbands, nlwgpts, clouds_lw, *k_dist_lw_k, cldfrac, p_lay, lw_subcloud_band2gpt_mem, lw_subcloud_gpt2band_mem, lw_subcloud_tau_mem);
+  optical_props1_t clouds_lw_gpt;
+  if (do_lw) {
+    clouds_lw_gpt = get_subsampled_clouds(ncol, nlay, nlwbands, nlwgpts, clouds_lw, *k_dist_lw_k, cldfrac, p_lay, lw_subcloud_band2gpt_mem, lw_subcloud_gpt2band_mem, lw_subcloud_tau_mem);
+  }
 
   // Copy cloud properties to outputs (is this needed, or can we just use pointers?)
   // Alternatively, just compute and output a subcolumn cloud mask
   TIMED_KERNEL(FLATTEN_MD_KERNEL3(ncol, nlay, nswgpts, icol, ilay, igpt,
     cld_tau_sw_gpt(icol,ilay,igpt) = clouds_sw_gpt.tau(icol,ilay,igpt);
   ));
-  TIMED_KERNEL(FLATTEN_MD_KERNEL3(ncol, nlay, nlwgpts, icol, ilay, igpt,
-    cld_tau_lw_gpt(icol,ilay,igpt) = clouds_lw_gpt.tau(icol,ilay,igpt);
-  ));
+  if (do_lw) {
+    TIMED_KERNEL(FLATTEN_MD_KERNEL3(ncol, nlay, nlwgpts, icol, ilay, igpt,
+      cld_tau_lw_gpt(icol,ilay,igpt) = clouds_lw_gpt.tau(icol,ilay,igpt);
+    ));
+  }
 
 #ifdef SCREAM_RRTMGP_DEBUG
   // Perform checks on optics; these would be caught by RRTMGP_EXPENSIVE_CHECKS in the RRTMGP code,
@@ -424,23 +442,27 @@ static void rrtmgp_main(
 #endif
 
   // Do shortwave
-  rrtmgp_sw(
-    ncol, nlay,
-    *k_dist_sw_k, p_lay, t_lay, p_lev, t_lev, gas_concs,
-    sfc_alb_dir, sfc_alb_dif, mu0, aerosol_sw, clouds_sw_gpt,
-    fluxes_sw, clnclrsky_fluxes_sw, clrsky_fluxes_sw, clnsky_fluxes_sw,
-    tsi_scaling, logger,
-    extra_clnclrsky_diag, extra_clnsky_diag
-            );
+  if (do_sw) {
+    rrtmgp_sw(
+      ncol, nlay,
+      *k_dist_sw_k, p_lay, t_lay, p_lev, t_lev, gas_concs,
+      sfc_alb_dir, sfc_alb_dif, mu0, aerosol_sw, clouds_sw_gpt,
+      fluxes_sw, clnclrsky_fluxes_sw, clrsky_fluxes_sw, clnsky_fluxes_sw,
+      tsi_scaling, logger,
+      extra_clnclrsky_diag, extra_clnsky_diag
+              );
+  }
 
   // Do longwave
-  rrtmgp_lw(
-    ncol, nlay,
-    *k_dist_lw_k, p_lay, t_lay, p_lev, t_lev, gas_concs,
-    aerosol_lw, clouds_lw_gpt,
-    fluxes_lw, clnclrsky_fluxes_lw, clrsky_fluxes_lw, clnsky_fluxes_lw,
-    extra_clnclrsky_diag, extra_clnsky_diag
-            );
+  if (do_lw) {
+    rrtmgp_lw(
+      ncol, nlay,
+      *k_dist_lw_k, p_lay, t_lay, p_lev, t_lev, gas_concs,
+      aerosol_lw, clouds_lw_gpt,
+      fluxes_lw, clnclrsky_fluxes_lw, clrsky_fluxes_lw, clnsky_fluxes_lw,
+      extra_clnclrsky_diag, extra_clnsky_diag
+              );
+  }
 
   pool_t::dealloc(sw_band2gpt_mem);
   pool_t::dealloc(sw_gpt2band_mem);
@@ -548,19 +570,9 @@ static void rrtmgp_sw(
     bnd_flux_dn_dir(icol,ilev,ibnd) = 0;
   ));
 
-  // Get daytime indices
+  // Get daytime indices (in increasing order)
   auto dayIndices = pool_t::template alloc<int>(ncol);
-  Kokkos::deep_copy(dayIndices, -1);
-
-  int nday = 0;
-  // Serialized for now.
-  Kokkos::parallel_reduce(1, KOKKOS_LAMBDA(int, int& nday_inner) {
-    for (int icol = 0; icol < ncol; ++icol) {
-      if (mu0(icol) > 0) {
-        dayIndices(nday_inner++) = icol;
-      }
-    }
-  }, Kokkos::Sum<int>(nday));
+  const int nday = compact_indices(ncol, KOKKOS_LAMBDA(const int icol) { return mu0(icol) > 0; }, dayIndices);
 
   if (nday == 0) {
     // No daytime columns in this chunk, skip the rest of this routine
@@ -622,19 +634,11 @@ static void rrtmgp_sw(
   auto sw_noaero_gpt2band_mem = pool_t::template alloc<int>(   ngpt);
 
   // Subset mu0
-  TIMED_KERNEL(Kokkos::parallel_for(nday, KOKKOS_LAMBDA(int iday) {
-    mu0_day(iday) = mu0(dayIndices(iday));
-  }));
+  TIMED_KERNEL(gather_selected(dayIndices, nday, std::array{mu0}, std::array{mu0_day}));
 
   // subset state variables
-  TIMED_KERNEL(FLATTEN_MD_KERNEL2(nday, nlay, iday, ilay,
-    p_lay_day(iday,ilay) = p_lay(dayIndices(iday),ilay);
-    t_lay_day(iday,ilay) = t_lay(dayIndices(iday),ilay);
-  ));
-  TIMED_KERNEL(FLATTEN_MD_KERNEL2(nday, nlay+1, iday, ilev,
-    p_lev_day(iday,ilev) = p_lev(dayIndices(iday),ilev);
-    t_lev_day(iday,ilev) = t_lev(dayIndices(iday),ilev);
-  ));
+  TIMED_KERNEL(gather_selected(dayIndices, nday, std::array{p_lay, t_lay}, std::array{p_lay_day, t_lay_day}));
+  TIMED_KERNEL(gather_selected(dayIndices, nday, std::array{p_lev, t_lev}, std::array{p_lev_day, t_lev_day}));
 
   // Subset gases
   auto gas_names = gas_concs.get_gas_names();
@@ -642,9 +646,7 @@ static void rrtmgp_sw(
   gas_concs_day.init_no_alloc(gas_names, nday, nlay, concs_mem);
   for (int igas = 0; igas < ngas; igas++) {
     gas_concs.get_vmr(gas_names[igas], vmr);
-    TIMED_KERNEL(FLATTEN_MD_KERNEL2(nday, nlay, iday, ilay,
-      vmr_day(iday,ilay) = vmr(dayIndices(iday),ilay);
-    ));
+    TIMED_KERNEL(gather_selected(dayIndices, nday, std::array{vmr}, std::array{vmr_day}));
     gas_concs_day.set_vmr(gas_names[igas], vmr_day);
   }
 
@@ -652,22 +654,18 @@ static void rrtmgp_sw(
   optical_props2_t aerosol_day;
   aerosol_day.init_no_alloc(k_dist.get_band_lims_wavenumber(), sw_aero_band2gpt_mem, sw_aero_gpt2band_mem);
   aerosol_day.alloc_2str_no_alloc(nday, nlay, sw_aero_tau_mem, sw_aero_ssa_mem, sw_aero_g_mem);
-  TIMED_KERNEL(FLATTEN_MD_KERNEL3(nday,nlay,nbnd, iday, ilay, ibnd,
-    aerosol_day.tau(iday,ilay,ibnd) = aerosol.tau(dayIndices(iday),ilay,ibnd);
-    aerosol_day.ssa(iday,ilay,ibnd) = aerosol.ssa(dayIndices(iday),ilay,ibnd);
-    aerosol_day.g  (iday,ilay,ibnd) = aerosol.g  (dayIndices(iday),ilay,ibnd);
-  ));
+  TIMED_KERNEL(gather_selected(dayIndices, nday,
+                               std::array{aerosol.tau, aerosol.ssa, aerosol.g},
+                               std::array{aerosol_day.tau, aerosol_day.ssa, aerosol_day.g}));
 
   // Subset cloud optics
   // TODO: nbnd -> ngpt once we pass sub-sampled cloud state
   optical_props2_t clouds_day;
   clouds_day.init_no_alloc(k_dist.get_band_lims_wavenumber(), k_dist.get_band_lims_gpoint(), sw_cloud_band2gpt_mem, sw_cloud_gpt2band_mem);
   clouds_day.alloc_2str_no_alloc(nday, nlay, sw_cloud_tau_mem, sw_cloud_ssa_mem, sw_cloud_g_mem);
-  TIMED_KERNEL(FLATTEN_MD_KERNEL3(nday,nlay,ngpt, iday, ilay, igpt,
-    clouds_day.tau(iday,ilay,igpt) = clouds.tau(dayIndices(iday),ilay,igpt);
-    clouds_day.ssa(iday,ilay,igpt) = clouds.ssa(dayIndices(iday),ilay,igpt);
-    clouds_day.g  (iday,ilay,igpt) = clouds.g  (dayIndices(iday),ilay,igpt);
-  ));
+  TIMED_KERNEL(gather_selected(dayIndices, nday,
+                               std::array{clouds.tau, clouds.ssa, clouds.g},
+                               std::array{clouds_day.tau, clouds_day.ssa, clouds_day.g}));
 
   // RRTMGP assumes surface albedos have a screwy dimension ordering
   // for some strange reason, so we need to transpose these; also do
@@ -726,12 +724,9 @@ static void rrtmgp_sw(
     // Compute clear-clean-sky (just gas) fluxes on daytime columns
     rte_sw(optics, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
     // Expand daytime fluxes to all columns
-    TIMED_KERNEL(FLATTEN_MD_KERNEL2(nday, nlay+1, iday, ilev,
-      const int icol = dayIndices(iday);
-      clnclrsky_flux_up    (icol,ilev) = flux_up_day    (iday,ilev);
-      clnclrsky_flux_dn    (icol,ilev) = flux_dn_day    (iday,ilev);
-      clnclrsky_flux_dn_dir(icol,ilev) = flux_dn_dir_day(iday,ilev);
-    ));
+    TIMED_KERNEL(scatter_selected(dayIndices, nday,
+                                  std::array{flux_up_day, flux_dn_day, flux_dn_dir_day},
+                                  std::array{clnclrsky_flux_up, clnclrsky_flux_dn, clnclrsky_flux_dn_dir}));
   }
 
   // Combine gas and aerosol optics
@@ -742,12 +737,9 @@ static void rrtmgp_sw(
   rte_sw(optics, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
 
   // Expand daytime fluxes to all columns
-  TIMED_KERNEL(FLATTEN_MD_KERNEL2(nday, nlay+1, iday, ilev,
-    const int icol = dayIndices(iday);
-    clrsky_flux_up    (icol,ilev) = flux_up_day    (iday,ilev);
-    clrsky_flux_dn    (icol,ilev) = flux_dn_day    (iday,ilev);
-    clrsky_flux_dn_dir(icol,ilev) = flux_dn_dir_day(iday,ilev);
-  ));
+  TIMED_KERNEL(scatter_selected(dayIndices, nday,
+                                std::array{flux_up_day, flux_dn_day, flux_dn_dir_day},
+                                std::array{clrsky_flux_up, clrsky_flux_dn, clrsky_flux_dn_dir}));
 
   // Now merge in cloud optics and do allsky calculations
 
@@ -757,18 +749,12 @@ static void rrtmgp_sw(
   // Compute fluxes on daytime columns
   rte_sw(optics, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
   // Expand daytime fluxes to all columns
-  TIMED_KERNEL(FLATTEN_MD_KERNEL2(nday, nlay+1, iday, ilev,
-    const int icol = dayIndices(iday);
-    flux_up    (icol,ilev) = flux_up_day    (iday,ilev);
-    flux_dn    (icol,ilev) = flux_dn_day    (iday,ilev);
-    flux_dn_dir(icol,ilev) = flux_dn_dir_day(iday,ilev);
-  ));
-  TIMED_KERNEL(FLATTEN_MD_KERNEL3(nday, nlay+1, nbnd, iday, ilev, ibnd,
-    const int icol = dayIndices(iday);
-    bnd_flux_up    (icol,ilev,ibnd) = bnd_flux_up_day    (iday,ilev,ibnd);
-    bnd_flux_dn    (icol,ilev,ibnd) = bnd_flux_dn_day    (iday,ilev,ibnd);
-    bnd_flux_dn_dir(icol,ilev,ibnd) = bnd_flux_dn_dir_day(iday,ilev,ibnd);
-  ));
+  TIMED_KERNEL(scatter_selected(dayIndices, nday,
+                                std::array{flux_up_day, flux_dn_day, flux_dn_dir_day},
+                                std::array{flux_up, flux_dn, flux_dn_dir}));
+  TIMED_KERNEL(scatter_selected(dayIndices, nday,
+                                std::array{bnd_flux_up_day, bnd_flux_dn_day, bnd_flux_dn_dir_day},
+                                std::array{bnd_flux_up, bnd_flux_dn, bnd_flux_dn_dir}));
 
   if (extra_clnsky_diag) {
     // First increment clouds in optics_no_aerosols
@@ -776,12 +762,9 @@ static void rrtmgp_sw(
     // Compute cleansky (gas + clouds) fluxes on daytime columns
     rte_sw(optics_no_aerosols, top_at_1, mu0_day, toa_flux, sfc_alb_dir_T, sfc_alb_dif_T, fluxes_day);
     // Expand daytime fluxes to all columns
-    TIMED_KERNEL(FLATTEN_MD_KERNEL2(nday, nlay+1, iday, ilev,
-      const int icol = dayIndices(iday);
-      clnsky_flux_up    (icol,ilev) = flux_up_day    (iday,ilev);
-      clnsky_flux_dn    (icol,ilev) = flux_dn_day    (iday,ilev);
-      clnsky_flux_dn_dir(icol,ilev) = flux_dn_dir_day(iday,ilev);
-    ));
+    TIMED_KERNEL(scatter_selected(dayIndices, nday,
+                                  std::array{flux_up_day, flux_dn_day, flux_dn_dir_day},
+                                  std::array{clnsky_flux_up, clnsky_flux_dn, clnsky_flux_dn_dir}));
   }
 
   pool_t::dealloc(dayIndices);
@@ -127,6 +127,15 @@ void RRTMGPRadiation::set_grids(const std::shared_ptr<const GridsManager> grids_
             "  - Chunk size: " + std::to_string(m_col_chunk_size) + "\n"
             "  - Number of chunks: " + std::to_string(m_num_col_chunks) + "\n");
 
+  // Whether to redistribute daytime columns across ranks for the SW solve.
+  // The exchange involves all the local columns, so we cannot chunk them.
+  m_balance_sw_daylight = m_params.get<bool>("balance_sw_daylight",false);
+  EKAT_REQUIRE_MSG (not m_balance_sw_daylight or m_num_col_chunks==1,
+      "Error! Option balance_sw_daylight requires a single column chunk on each rank.\n"
+      "  Set column_chunk_size to (at least) the max number of local columns.\n"
+      "  - Num local cols: " + std::to_string(m_ncol) + "\n"
+      "  - Number of chunks: " + std::to_string(m_num_col_chunks) + "\n");
+
   // Set up dimension layouts
   m_nswgpts = m_params.get<int>("nswgpts",112);
   m_nlwgpts = m_params.get<int>("nlwgpts",128);
@@ -466,6 +475,82 @@ void RRTMGPRadiation::init_buffers(const ATMBufferManager &buffer_manager)
   EKAT_REQUIRE_MSG(used_mem==requested_buffer_size_in_bytes(), "Error! Used memory != requested memory for RRTMGPRadiation.");
 } // RRTMGPRadiation::init_buffers
 
+int RRTMGPRadiation::sw_work_size () const
+{
+  // A rank never gets more work columns than local columns (see SWDaylightBalancer)
+  const int ncol = m_ncol;
+  const int nlay = m_nlay;
+  const int nbnd = m_nswbands;
+
+  // Inputs: p_lay, t_lay, p_lev, t_lev, vmrs, sfc albedos, mu0, lwp, iwp, rel, rei, cldfrac, aero optics.
+  // Outputs: 12 broadband fluxes, 3 band-by-band fluxes
+  const int nin  = 7*nlay + 2*(nlay+1) + m_ngas*nlay + 2*nbnd + 1 + 3*nlay*nbnd;
+  const int nout = 12*(nlay+1) + 3*(nlay+1)*nbnd;
+
+  // The unpacked inputs (except the vmrs, which go in m_gas_concs_sw_k), the cloud
+  // optics, the unpacked outputs, and the packed inputs/outputs on local and work columns.
+  return ncol*(nin - m_ngas*nlay) + ncol*nlay*(nbnd+m_nswgpts) + ncol*nout + 2*ncol*(nin+nout);
+}
+
+void RRTMGPRadiation::init_sw_work (Real* mem)
+{
+  const int ncol = m_ncol;
+  const int nlay = m_nlay;
+  const int nbnd = m_nswbands;
+  const Real* mem_beg = mem;
+
+  auto& w = m_sw_work;
+  ureal2dk* _2d_nlay_ptrs[] = {&w.p_lay, &w.t_lay, &w.lwp, &w.iwp, &w.rel, &w.rei, &w.cldfrac};
+  for (auto v : _2d_nlay_ptrs) {
+    *v = ureal2dk(mem,ncol,nlay);
+    mem += v->size();
+  }
+  ureal2dk* _2d_nlay_p1_ptrs[] = {
+    &w.p_lev, &w.t_lev,
+    &w.flux_up, &w.flux_dn, &w.flux_dn_dir,
+    &w.clnclrsky_flux_up, &w.clnclrsky_flux_dn, &w.clnclrsky_flux_dn_dir,
+    &w.clrsky_flux_up, &w.clrsky_flux_dn, &w.clrsky_flux_dn_dir,
+    &w.clnsky_flux_up, &w.clnsky_flux_dn, &w.clnsky_flux_dn_dir};
+  for (auto v : _2d_nlay_p1_ptrs) {
+    *v = ureal2dk(mem,ncol,nlay+1);
+    mem += v->size();
+  }
+  ureal2dk* _2d_nbnd_ptrs[] = {&w.sfc_alb_dir, &w.sfc_alb_dif};
+  for (auto v : _2d_nbnd_ptrs) {
+    *v = ureal2dk(mem,ncol,nbnd);
+    mem += v->size();
+  }
+  w.mu0 = ureal1dk(mem,ncol);
+  mem += w.mu0.size();
+  ureal3dk* _3d_nlay_nbnd_ptrs[] = {&w.aero_tau, &w.aero_ssa, &w.aero_g, &w.cld_tau_bnd};
+  for (auto v : _3d_nlay_nbnd_ptrs) {
+    *v = ureal3dk(mem,ncol,nlay,nbnd);
+    mem += v->size();
+  }
+  w.cld_tau_gpt = ureal3dk(mem,ncol,nlay,m_nswgpts);
+  mem += w.cld_tau_gpt.size();
+  ureal3dk* _3d_nlay_p1_nbnd_ptrs[] = {&w.bnd_flux_up, &w.bnd_flux_dn, &w.bnd_flux_dn_dir};
+  for (auto v : _3d_nlay_p1_nbnd_ptrs) {
+    *v = ureal3dk(mem,ncol,nlay+1,nbnd);
+    mem += v->size();
+  }
+
+  // Packed inputs/outputs (see sw_work_size)
+  const int nin  = 7*nlay + 2*(nlay+1) + m_ngas*nlay + 2*nbnd + 1 + 3*nlay*nbnd;
+  const int nout = 12*(nlay+1) + 3*(nlay+1)*nbnd;
+  w.in_local = ulrreal2dk(mem,ncol,nin);
+  mem += w.in_local.size();
+  w.in_work = ulrreal2dk(mem,ncol,nin);
+  mem += w.in_work.size();
+  w.out_local = ulrreal2dk(mem,ncol,nout);
+  mem += w.out_local.size();
+  w.out_work = ulrreal2dk(mem,ncol,nout);
+  mem += w.out_work.size();
+
+  EKAT_REQUIRE_MSG(mem-mem_beg==sw_work_size(),
+      "Error! Used memory != requested memory for the SW balancing work views.\n");
+}
+
 void RRTMGPRadiation::initialize_impl(const RunType run_type) {
   using PC = scream::physics::Constants<Real>;
 
@@ -529,6 +614,10 @@ void RRTMGPRadiation::initialize_impl(const RunType run_type) {
           m_atm_logger,
           multiplier
   );
+  if (m_balance_sw_daylight) {
+    m_gas_concs_sw_k.init(gas_names_offset,m_col_chunk_size,m_nlay);
+    m_sw_balancer = std::make_shared<SWDaylightBalancer>(m_comm,m_ncol);
+  }
 
   // Set property checks for fields in this process
   add_invariant_check<FieldWithinIntervalCheck>(get_field_out("T_mid"),m_grid,100.0, 500.0,false);
@@ -1042,10 +1131,146 @@ void RRTMGPRadiation::run_impl (const double dt) {
         lw_clnsky_flux_up_k, lw_clnsky_flux_dn_k,
         sw_bnd_flux_up_k, sw_bnd_flux_dn_k, sw_bnd_flux_dir_k, lw_bnd_flux_up_k, lw_bnd_flux_dn_k,
         eccf, m_atm_logger,
-        m_extra_clnclrsky_diag, m_extra_clnsky_diag
+        m_extra_clnclrsky_diag, m_extra_clnsky_diag,
+        not m_balance_sw_daylight, true
       );
                    );
 
+      // Move daytime columns across ranks, so that all ranks have a similar amount
+      // of SW work, do the SW solve, and bring the SW fluxes back to their owners.
+      if (m_balance_sw_daylight) {
+        using SWB = SWDaylightBalancer;
+
+        // The work views are only needed here, so carve them from the rrtmgp pool
+        auto sw_work_mem = interface_t::pool_t::alloc<Real>(sw_work_size());
+        init_sw_work(sw_work_mem.data());
+        auto& w = m_sw_work;
+
+        m_sw_balancer->setup(mu0_k);
+        const int nwork = m_sw_balancer->num_work_cols();
+
+        int offset = 0;
+        auto pack_in = [&](const auto& v) { offset = SWB::pack_columns(ncol,v,w.in_local,offset); };
+        pack_in(p_lay_k);
+        pack_in(t_lay_k);
+        pack_in(p_lev_k);
+        pack_in(t_lev_k);
+        pack_in(m_gas_concs_k.concs);
+        pack_in(sfc_alb_dir_k);
+        pack_in(sfc_alb_dif_k);
+        pack_in(mu0_k);
+        pack_in(lwp_k);
+        pack_in(iwp_k);
+        pack_in(rel_k);
+        pack_in(rei_k);
+        pack_in(cldfrac_tot_k);
+        pack_in(aero_tau_sw_k);
+        pack_in(aero_ssa_sw_k);
+        pack_in(aero_g_sw_k);
+        EKAT_REQUIRE_MSG (offset==static_cast<int>(w.in_local.extent(1)),
+            "Error! Unexpected size of packed SW inputs.\n");
+
+        m_sw_balancer->to_work(w.in_local,w.in_work);
+
+        // Work columns are all daytime columns, so skip the solve if there are none
+        if (nwork>0) {
+          auto gas_concs_sw_k = m_gas_concs_sw_k.concs;
+          ConvertToRrtmgpSubview wconv = {0, nwork};
+          m_gas_concs_sw_k.ncol = nwork;
+          m_gas_concs_sw_k.concs = wconv.subview3d(gas_concs_sw_k);
+
+          offset = 0;
+          auto unpack_in = [&](const auto& v) { offset = SWB::unpack_columns(nwork,w.in_work,offset,v); };
+          unpack_in(w.p_lay);
+          unpack_in(w.t_lay);
+          unpack_in(w.p_lev);
+          unpack_in(w.t_lev);
+          unpack_in(m_gas_concs_sw_k.concs);
+          unpack_in(w.sfc_alb_dir);
+          unpack_in(w.sfc_alb_dif);
+          unpack_in(w.mu0);
+          unpack_in(w.lwp);
+          unpack_in(w.iwp);
+          unpack_in(w.rel);
+          unpack_in(w.rei);
+          unpack_in(w.cldfrac);
+          unpack_in(w.aero_tau);
+          unpack_in(w.aero_ssa);
+          unpack_in(w.aero_g);
+
+          // Trim the work views to nwork columns. The LW arguments are not used.
+          auto sub2 = [&](const ureal2dk& v) { return wconv.subview2d_impl(v, v.extent(1)); };
+          auto sub3 = [&](const ureal3dk& v) { return wconv.subview3d(v); };
+          TIMED_KERNEL(
+          interface_t::rrtmgp_main(
+            nwork, m_nlay,
+            sub2(w.p_lay), sub2(w.t_lay), sub2(w.p_lev), sub2(w.t_lev),
+            m_gas_concs_sw_k,
+            sub2(w.sfc_alb_dir), sub2(w.sfc_alb_dif), wconv.subview1d(w.mu0),
+            sub2(w.lwp), sub2(w.iwp), sub2(w.rel), sub2(w.rei), sub2(w.cldfrac),
+            sub3(w.aero_tau), sub3(w.aero_ssa), sub3(w.aero_g), aero_tau_lw_k,
+            sub3(w.cld_tau_bnd), cld_tau_lw_bnd_k,
+            sub3(w.cld_tau_gpt), cld_tau_lw_gpt_k,
+            sub2(w.flux_up), sub2(w.flux_dn), sub2(w.flux_dn_dir), lw_flux_up_k, lw_flux_dn_k,
+            sub2(w.clnclrsky_flux_up), sub2(w.clnclrsky_flux_dn), sub2(w.clnclrsky_flux_dn_dir),
+            sub2(w.clrsky_flux_up), sub2(w.clrsky_flux_dn), sub2(w.clrsky_flux_dn_dir),
+            sub2(w.clnsky_flux_up), sub2(w.clnsky_flux_dn), sub2(w.clnsky_flux_dn_dir),
+            lw_clnclrsky_flux_up_k, lw_clnclrsky_flux_dn_k,
+            lw_clrsky_flux_up_k, lw_clrsky_flux_dn_k,
+            lw_clnsky_flux_up_k, lw_clnsky_flux_dn_k,
+            sub3(w.bnd_flux_up), sub3(w.bnd_flux_dn), sub3(w.bnd_flux_dn_dir), lw_bnd_flux_up_k, lw_bnd_flux_dn_k,
+            eccf, m_atm_logger,
+            m_extra_clnclrsky_diag, m_extra_clnsky_diag,
+            true, false
+          );
+                       );
+
+          m_gas_concs_sw_k.concs = gas_concs_sw_k;
+
+          offset = 0;
+          auto pack_out = [&](const auto& v) { offset = SWB::pack_columns(nwork,v,w.out_work,offset); };
+          pack_out(w.flux_up);
+          pack_out(w.flux_dn);
+          pack_out(w.flux_dn_dir);
+          pack_out(w.clnclrsky_flux_up);
+          pack_out(w.clnclrsky_flux_dn);
+          pack_out(w.clnclrsky_flux_dn_dir);
+          pack_out(w.clrsky_flux_up);
+          pack_out(w.clrsky_flux_dn);
+          pack_out(w.clrsky_flux_dn_dir);
+          pack_out(w.clnsky_flux_up);
+          pack_out(w.clnsky_flux_dn);
+          pack_out(w.clnsky_flux_dn_dir);
+          pack_out(w.bnd_flux_up);
+          pack_out(w.bnd_flux_dn);
+          pack_out(w.bnd_flux_dn_dir);
+        }
+
+        // from_work only sets daytime columns, and SW fluxes are zero at night
+        Kokkos::deep_copy(w.out_local,0);
+        m_sw_balancer->from_work(w.out_work,w.out_local);
+
+        offset = 0;
+        auto unpack_out = [&](const auto& v) { offset = SWB::unpack_columns(ncol,w.out_local,offset,v); };
+        unpack_out(sw_flux_up_k);
+        unpack_out(sw_flux_dn_k);
+        unpack_out(sw_flux_dn_dir_k);
+        unpack_out(sw_clnclrsky_flux_up_k);
+        unpack_out(sw_clnclrsky_flux_dn_k);
+        unpack_out(sw_clnclrsky_flux_dn_dir_k);
+        unpack_out(sw_clrsky_flux_up_k);
+        unpack_out(sw_clrsky_flux_dn_k);
+        unpack_out(sw_clrsky_flux_dn_dir_k);
+        unpack_out(sw_clnsky_flux_up_k);
+        unpack_out(sw_clnsky_flux_dn_k);
+        unpack_out(sw_clnsky_flux_dn_dir_k);
+        unpack_out(sw_bnd_flux_up_k);
+        unpack_out(sw_bnd_flux_dn_k);
+        unpack_out(sw_bnd_flux_dir_k);
+
+        interface_t::pool_t::dealloc(sw_work_mem);
+      }
+
       // Update heating tendency
       TIMED_INLINE_KERNEL(heating_tendency,
       auto sw_heating_k  = m_buffer.sw_heating_k;
@@ -1237,6 +1462,9 @@ void RRTMGPRadiation::run_impl (const double dt) {
 
 void RRTMGPRadiation::finalize_impl  () {
   m_gas_concs_k.reset();
+  if (m_balance_sw_daylight) {
+    m_gas_concs_sw_k.reset();
+  }
   // Finalize the interface, passing a bool for rank 0
   // to print info about memory stats on that rank
   interface_t::rrtmgp_finalize(m_comm.am_i_root());
@@ -3,6 +3,7 @@
 
 #include "cpp/rrtmgp/mo_gas_concentrations.h"
 #include "physics/rrtmgp/eamxx_rrtmgp_interface.hpp"
+#include "physics/rrtmgp/eamxx_rrtmgp_sw_balancer.hpp"
 #include "share/atm_process/atmosphere_process.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/util/ekat_string_utils.hpp"
@@ -130,6 +131,34 @@ public:
   // Whether or not to do subcolumn sampling of cloud state for MCICA
   bool m_do_subcol_sampling;
 
+  // If true, daytime columns are redistributed across ranks for the SW solve
+  // (see SWDaylightBalancer). Requires a single column chunk.
+  bool m_balance_sw_daylight;
+  std::shared_ptr<SWDaylightBalancer>      m_sw_balancer;
+  GasConcsK<Real, layout_t, DefaultDevice> m_gas_concs_sw_k;
+
+  // Views for the SW solve on the work columns of the SW balancer.
+  // All views have m_ncol columns, the max number of work columns. At every
+  // radiation step, they are carved from the rrtmgp pool (see init_sw_work).
+  struct SWWork {
+    ureal2dk p_lay, t_lay, p_lev, t_lev;
+    ureal2dk sfc_alb_dir, sfc_alb_dif;
+    ureal1dk mu0;
+    ureal2dk lwp, iwp, rel, rei, cldfrac;
+    ureal3dk aero_tau, aero_ssa, aero_g;
+    ureal3dk cld_tau_bnd, cld_tau_gpt;
+    ureal2dk flux_up, flux_dn, flux_dn_dir;
+    ureal2dk clnclrsky_flux_up, clnclrsky_flux_dn, clnclrsky_flux_dn_dir;
+    ureal2dk clrsky_flux_up, clrsky_flux_dn, clrsky_flux_dn_dir;
+    ureal2dk clnsky_flux_up, clnsky_flux_dn, clnsky_flux_dn_dir;
+    ureal3dk bnd_flux_up, bnd_flux_dn, bnd_flux_dn_dir;
+
+    // Packed inputs/outputs of all columns, on local and work columns
+    ulrreal2dk in_local, in_work;
+    ulrreal2dk out_local, out_work;
+  };
+  SWWork m_sw_work;
+
   // Structure for storing local variables initialized using the ATMBufferManager
   struct Buffer {
     static constexpr int num_1d_ncol        = 8;
@@ -234,6 +263,12 @@ protected:
   // the ATMBufferManager
   void init_buffers(const ATMBufferManager &buffer_manager);
 
+  // Number of Reals needed by the views used by the SW solve on balanced daytime columns
+  int sw_work_size () const;
+
+  // Set the views used by the SW solve on balanced daytime columns, using the given memory
+  void init_sw_work (Real* mem);
+
   std::shared_ptr<const AbstractGrid>   m_grid;
 
   // Struct which contains local variables
@@ -0,0 +1,245 @@
+#include "physics/rrtmgp/eamxx_rrtmgp_sw_balancer.hpp"
+
+#include "share/util/eamxx_column_compaction.hpp"
+#include "share/util/eamxx_utils.hpp"  // For check_mpi_call
+
+#include "eamxx_config.h"
+
+#include <algorithm>
+
+namespace scream {
+
+SWDaylightBalancer::
+SWDaylightBalancer (const ekat::Comm& comm, const int ncol)
+ : m_comm (comm)
+ , m_ncol (ncol)
+{
+  EKAT_REQUIRE_MSG (ncol>=0,
+      "Error! Invalid number of columns for SWDaylightBalancer.\n"
+      " - ncol: " + std::to_string(ncol) + "\n");
+
+  m_day_lids = view_1d<int>("sw_balancer_day_lids",m_ncol);
+
+  // The number of columns does not change, so gather it once
+  m_ncol_per_pid.resize(m_comm.size());
+  check_mpi_call(MPI_Allgather(&m_ncol,1,MPI_INT,m_ncol_per_pid.data(),1,MPI_INT,m_comm.mpi_comm()),
+                 "SWDaylightBalancer::SWDaylightBalancer, MPI_Allgather");
+}
+
+void SWDaylightBalancer::
+setup (const view_1d<const Real>& mu0)
+{
+  // The plan covers all local columns, so they must be processed in a single chunk
+  EKAT_REQUIRE_MSG (static_cast<int>(mu0.extent(0))==m_ncol,
+      "Error! SWDaylightBalancer requires all local columns in a single column chunk.\n"
+      " - mu0 extent: " + std::to_string(mu0.extent(0)) + "\n"
+      " - num cols  : " + std::to_string(m_ncol) + "\n");
+
+  // Same criterion used in rrtmgp_sw to skip nighttime columns
+  m_num_day = compact_indices(m_ncol, KOKKOS_LAMBDA(const int icol) { return mu0(icol) > 0; }, m_day_lids);
+
+  const int nranks = m_comm.size();
+  const int me     = m_comm.rank();
+  std::vector<int> nday (nranks);
+  check_mpi_call(MPI_Allgather(&m_num_day,1,MPI_INT,nday.data(),1,MPI_INT,m_comm.mpi_comm()),
+                 "SWDaylightBalancer::setup, MPI_Allgather");
+
+  // Each rank's share of daytime columns is proportional to its number of columns.
+  // Distribute the remainder (less than nranks) one column at a time, in rank order,
+  // among ranks that still have room.
+  long long total_day = 0, total_col = 0;
+  for (int pid=0; pid<nranks; ++pid) {
+    total_day += nday[pid];
+    total_col += m_ncol_per_pid[pid];
+  }
+  std::vector<int> target (nranks,0);
+  long long remainder = total_day;
+  for (int pid=0; pid<nranks and total_col>0; ++pid) {
+    target[pid] = (total_day*m_ncol_per_pid[pid]) / total_col;
+    remainder -= target[pid];
+  }
+  while (remainder>0) {
+    for (int pid=0; pid<nranks and remainder>0; ++pid) {
+      if (target[pid]<m_ncol_per_pid[pid]) {
+        ++target[pid];
+        --remainder;
+      }
+    }
+  }
+
+  // Match ranks with a surplus to ranks with a deficit, in rank order.
+  // Since the surpluses and deficits sum up to the same number, both
+  // lists are exhausted at the same time.
+  m_export_pids.clear();
+  m_export_counts.clear();
+  m_import_pids.clear();
+  m_import_counts.clear();
+  std::vector<int> excess (nranks);
+  for (int pid=0; pid<nranks; ++pid) {
+    excess[pid] = nday[pid] - target[pid];
+  }
+  int src = 0, dst = 0;
+  while (true) {
+    while (src<nranks and excess[src]<=0) ++src;
+    while (dst<nranks and excess[dst]>=0) ++dst;
+    if (src==nranks or dst==nranks) {
+      break;
+    }
+    const int n = std::min(excess[src],-excess[dst]);
+    if (src==me) {
+      m_export_pids.push_back(dst);
+      m_export_counts.push_back(n);
+    }
+    if (dst==me) {
+      m_import_pids.push_back(src);
+      m_import_counts.push_back(n);
+    }
+    excess[src] -= n;
+    excess[dst] += n;
+  }
+
+  m_num_keep = std::min(m_num_day,target[me]);
+  m_num_work = target[me];
+}
+
+void SWDaylightBalancer::
+to_work (const view_2d<const Real>& local, const view_2d<Real>& work)
+{
+  const int nvals = local.extent(1);
+  check_views(local.extent(0),work.extent(0),nvals,work.extent(1));
+
+  const int nkeep = m_num_keep;
+  const int nexp  = num_exports();
+  const int nimp  = num_imports();
+  grow(m_send_buf,m_send_buf_h,std::max(nexp,nimp)*nvals);
+  grow(m_recv_buf,m_recv_buf_h,std::max(nexp,nimp)*nvals);
+
+  // Copy kept columns directly into the work array, and pack the exported ones
+  auto day  = m_day_lids;
+  auto send = m_send_buf;
+  Kokkos::parallel_for("SWDaylightBalancer::to_work",
+                       Kokkos::RangePolicy<KT::ExeSpace>(0,(nkeep+nexp)*nvals),
+                       KOKKOS_LAMBDA(const int k) {
+    const int i = k / nvals;
+    const int j = k % nvals;
+    if (i<nkeep) {
+      work(i,j) = local(day(i),j);
+    } else {
+      send((i-nkeep)*nvals+j) = local(day(i),j);
+    }
+  });
+
+  // Imported columns are stored after the kept ones
+#if SCREAM_MPI_ON_DEVICE
+  // MPI reads the send buffer directly, so the packing must be done
+  Kokkos::fence();
+  exchange(m_send_buf.data(),m_export_pids,m_export_counts,
+           work.data()+nkeep*nvals,m_import_pids,m_import_counts,nvals);
+#else
+  Kokkos::deep_copy(m_send_buf_h,m_send_buf);
+  exchange(m_send_buf_h.data(),m_export_pids,m_export_counts,
+           m_recv_buf_h.data(),m_import_pids,m_import_counts,nvals);
+  using dev_view_t  = Kokkos::View<Real*,KT::ExeSpace::memory_space,Kokkos::MemoryUnmanaged>;
+  using host_view_t = Kokkos::View<const Real*,Kokkos::HostSpace,Kokkos::MemoryUnmanaged>;
+  Kokkos::deep_copy(dev_view_t(work.data()+nkeep*nvals,nimp*nvals),
+                    host_view_t(m_recv_buf_h.data(),nimp*nvals));
+#endif
+}
+
+void SWDaylightBalancer::
+from_work (const view_2d<const Real>& work, const view_2d<Real>& local)
+{
+  const int nvals = work.extent(1);
+  check_views(local.extent(0),work.extent(0),local.extent(1),nvals);
+
+  const int nkeep = m_num_keep;
+  const int nexp  = num_exports();
+  const int nimp  = num_imports();
+  grow(m_send_buf,m_send_buf_h,std::max(nexp,nimp)*nvals);
+  grow(m_recv_buf,m_recv_buf_h,std::max(nexp,nimp)*nvals);
+
+  // Send the imported columns back to their owners (reverse of to_work)
+#if SCREAM_MPI_ON_DEVICE
+  // MPI reads the work view directly, so any pending kernel writing it must be done
+  Kokkos::fence();
+  exchange(work.data()+nkeep*nvals,m_import_pids,m_import_counts,
+           m_recv_buf.data(),m_export_pids,m_export_counts,nvals);
+#else
+  using dev_view_t  = Kokkos::View<const Real*,KT::ExeSpace::memory_space,Kokkos::MemoryUnmanaged>;
+  using host_view_t = Kokkos::View<Real*,Kokkos::HostSpace,Kokkos::MemoryUnmanaged>;
+  Kokkos::deep_copy(host_view_t(m_send_buf_h.data(),nimp*nvals),
+                    dev_view_t(work.data()+nkeep*nvals,nimp*nvals));
+  exchange(m_send_buf_h.data(),m_import_pids,m_import_counts,
+           m_recv_buf_h.data(),m_export_pids,m_export_counts,nvals);
+  Kokkos::deep_copy(m_recv_buf,m_recv_buf_h);
+#endif
+
+  auto day  = m_day_lids;
+  auto recv = m_recv_buf;
+  Kokkos::parallel_for("SWDaylightBalancer::from_work",
+                       Kokkos::RangePolicy<KT::ExeSpace>(0,(nkeep+nexp)*nvals),
+                       KOKKOS_LAMBDA(const int k) {
+    const int i = k / nvals;
+    const int j = k % nvals;
+    if (i<nkeep) {
+      local(day(i),j) = work(i,j);
+    } else {
+      local(day(i),j) = recv((i-nkeep)*nvals+j);
+    }
+  });
+}
+
+void SWDaylightBalancer::
+check_views (const int nlocal, const int nwork, const int nvals_local, const int nvals_work) const
+{
+  EKAT_REQUIRE_MSG (nlocal==m_ncol,
+      "Error! SWDaylightBalancer requires all local columns in a single column chunk.\n"
+      " - local extent: " + std::to_string(nlocal) + "\n"
+      " - num cols    : " + std::to_string(m_ncol) + "\n");
+  EKAT_REQUIRE_MSG (nwork>=m_num_work,
+      "Error! Work view passed to SWDaylightBalancer is too small.\n"
+      " - work extent  : " + std::to_string(nwork) + "\n"
+      " - num work cols: " + std::to_string(m_num_work) + "\n");
+  EKAT_REQUIRE_MSG (nvals_local==nvals_work,
+      "Error! Local and work views passed to SWDaylightBalancer have different number of values per column.\n"
+      " - local: " + std::to_string(nvals_local) + "\n"
+      " - work : " + std::to_string(nvals_work) + "\n");
+}
+
+void SWDaylightBalancer::
+exchange (const Real* send, const std::vector<int>& send_pids, const std::vector<int>& send_counts,
+                Real* recv, const std::vector<int>& recv_pids, const std::vector<int>& recv_counts,
+          const int nvals) const
+{
+  const auto mpi_real = ekat::get_mpi_type<Real>();
+  const auto mpi_comm = m_comm.mpi_comm();
+  const int tag = 0;
+
+  std::vector<MPI_Request> reqs (send_pids.size()+recv_pids.size());
+  int ireq = 0;
+  int offset = 0;
+  for (size_t i=0; i<recv_pids.size(); ++i) {
+    check_mpi_call(MPI_Irecv(recv+offset,recv_counts[i]*nvals,mpi_real,recv_pids[i],tag,mpi_comm,&reqs[ireq++]),
+                   "SWDaylightBalancer::exchange, MPI_Irecv");
+    offset += recv_counts[i]*nvals;
+  }
+  offset = 0;
+  for (size_t i=0; i<send_pids.size(); ++i) {
+    check_mpi_call(MPI_Isend(send+offset,send_counts[i]*nvals,mpi_real,send_pids[i],tag,mpi_comm,&reqs[ireq++]),
+                   "SWDaylightBalancer::exchange, MPI_Isend");
+    offset += send_counts[i]*nvals;
+  }
+  check_mpi_call(MPI_Waitall(reqs.size(),reqs.data(),MPI_STATUSES_IGNORE),
+                 "SWDaylightBalancer::exchange, MPI_Waitall");
+}
+
+void SWDaylightBalancer::
+grow (view_1d<Real>& buf, typename view_1d<Real>::HostMirror& buf_h, const int size)
+{
+  if (static_cast<int>(buf.size())<size) {
+    buf   = view_1d<Real>("sw_balancer_buf",size);
+    buf_h = Kokkos::create_mirror_view(buf);
+  }
+}
+
+} // namespace scream
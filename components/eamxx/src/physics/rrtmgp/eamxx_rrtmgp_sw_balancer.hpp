@@ -0,0 +1,170 @@
+#ifndef SCREAM_RRTMGP_SW_BALANCER_HPP
+#define SCREAM_RRTMGP_SW_BALANCER_HPP
+
+#include "share/eamxx_types.hpp"
+
+#include <ekat/mpi/ekat_comm.hpp>
+#include <ekat/ekat_assert.hpp>
+
+#include <mpi.h>
+#include <vector>
+
+namespace scream {
+
+/*
+ * Redistribute daytime columns across ranks for the shortwave solve
+ *
+ * rrtmgp_sw skips nighttime columns, so at any given time roughly half of the
+ * ranks have little or no SW work, and the slowest rank sets the pace. This class
+ * builds a plan to move daytime columns from ranks with more than their share
+ * to ranks with less, so that each rank solves a number of daytime columns
+ * proportional to its number of local columns (hence never more than that).
+ *
+ * The plan must be rebuilt whenever mu0 changes (i.e., at every radiation step),
+ * so it is kept cheap: a single allgather of the daytime column counts. The
+ * matching of surplus to deficit ranks is deterministic (in rank order), so
+ * every rank computes the same plan, and there is no need to exchange gids.
+ *
+ * On each rank, the "work" columns are the local daytime columns that are kept,
+ * followed by the columns received from other ranks (grouped by source rank, in
+ * increasing rank order). Like in GridImportExport, the columns exported to
+ * other ranks are stored sorted by pid. Data is exchanged as 2d arrays, with
+ * all the per-column values of a column stored contiguously:
+ *  - to_work:   (ncol,nvals)  -> (nwork,nvals)
+ *  - from_work: (nwork,nvals) -> (ncol,nvals), only rows of daytime columns are written.
+ * The pack_columns/unpack_columns utilities can be used to (un)pack rrtmgp views
+ * into such arrays.
+ */
+
+class SWDaylightBalancer
+{
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+  template<typename T>
+  using view_2d = typename KT::template view_2d<T>;
+
+  SWDaylightBalancer (const ekat::Comm& comm, const int ncol);
+  ~SWDaylightBalancer () = default;
+
+  // Rebuild the plan, based on the cosine of the zenith angle of the local columns.
+  // This is a collective call. The local views (mu0 included) must span all the
+  // local columns, since the balancer cannot work on column chunks.
+  void setup (const view_1d<const Real>& mu0);
+
+  int num_day_cols  () const { return m_num_day; }
+  int num_work_cols () const { return m_num_work; }
+
+  // Number of daytime columns sent to/received from other ranks
+  int num_exports () const { return m_num_day - m_num_keep; }
+  int num_imports () const { return m_num_work - m_num_keep; }
+
+  // Move per-column data from local columns to work columns, and back
+  void to_work   (const view_2d<const Real>& local, const view_2d<Real>& work);
+  void from_work (const view_2d<const Real>& work,  const view_2d<Real>& local);
+
+  // Copy v(icol,...) into buf(icol,offset:offset+n), where n is the product of
+  // v's extents (except the first), and return offset+n. And vice versa.
+  template<typename V>
+  static int pack_columns   (const int ncol, const V& v, const view_2d<Real>& buf, const int offset);
+  template<typename V>
+  static int unpack_columns (const int ncol, const view_2d<const Real>& buf, const int offset, const V& v);
+
+protected:
+
+  void check_views (const int nlocal, const int nwork, const int nvals_local, const int nvals_work) const;
+
+  void exchange (const Real* send, const std::vector<int>& send_pids, const std::vector<int>& send_counts,
+                       Real* recv, const std::vector<int>& recv_pids, const std::vector<int>& recv_counts,
+                 const int nvals) const;
+
+  // Ensure that a buffer has at least the given size
+  void grow (view_1d<Real>& buf, typename view_1d<Real>::HostMirror& buf_h, const int size);
+
+  ekat::Comm  m_comm;
+
+  int m_ncol;
+  std::vector<int> m_ncol_per_pid;
+
+  // The local daytime columns (the first m_num_keep are kept, the rest are exported)
+  view_1d<int>  m_day_lids;
+  int           m_num_day  = 0;
+  int           m_num_keep = 0;
+  int           m_num_work = 0;
+
+  // Number of columns exported to/imported from each remote pid (sorted by pid)
+  std::vector<int>  m_export_pids;
+  std::vector<int>  m_export_counts;
+  std::vector<int>  m_import_pids;
+  std::vector<int>  m_import_counts;
+
+  view_1d<Real>               m_send_buf;
+  view_1d<Real>               m_recv_buf;
+  view_1d<Real>::HostMirror   m_send_buf_h;
+  view_1d<Real>::HostMirror   m_recv_buf_h;
+};
+
+// --------------------- IMPLEMENTATION ------------------------ //
+
+template<typename V>
+int SWDaylightBalancer::
+pack_columns (const int ncol, const V& v, const view_2d<Real>& buf, const int offset)
+{
+  constexpr int rank = V::rank;
+  static_assert (rank>=1 and rank<=3, "Error! Only views of rank 1, 2, or 3 are supported.\n");
+
+  const int n1 = rank>1 ? v.extent(1) : 1;
+  const int n2 = rank>2 ? v.extent(2) : 1;
+  EKAT_REQUIRE_MSG (offset+n1*n2<=static_cast<int>(buf.extent(1)) and ncol<=static_cast<int>(buf.extent(0)),
+      "Error! Buffer too small in SWDaylightBalancer::pack_columns.\n");
+
+  Kokkos::parallel_for("SWDaylightBalancer::pack_columns",
+                       Kokkos::RangePolicy<KT::ExeSpace>(0,ncol*n1*n2),
+                       KOKKOS_LAMBDA(const int k) {
+    const int i = k / (n1*n2);
+    const int j = (k / n2) % n1;
+    const int l = k % n2;
+    if constexpr (rank==1) {
+      buf(i,offset) = v(i);
+    } else if constexpr (rank==2) {
+      buf(i,offset+j) = v(i,j);
+    } else {
+      buf(i,offset+j*n2+l) = v(i,j,l);
+    }
+  });
+  return offset + n1*n2;
+}
+
+template<typename V>
+int SWDaylightBalancer::
+unpack_columns (const int ncol, const view_2d<const Real>& buf, const int offset, const V& v)
+{
+  constexpr int rank = V::rank;
+  static_assert (rank>=1 and rank<=3, "Error! Only views of rank 1, 2, or 3 are supported.\n");
+
+  const int n1 = rank>1 ? v.extent(1) : 1;
+  const int n2 = rank>2 ? v.extent(2) : 1;
+  EKAT_REQUIRE_MSG (offset+n1*n2<=static_cast<int>(buf.extent(1)) and ncol<=static_cast<int>(buf.extent(0)),
+      "Error! Buffer too small in SWDaylightBalancer::unpack_columns.\n");
+
+  Kokkos::parallel_for("SWDaylightBalancer::unpack_columns",
+                       Kokkos::RangePolicy<KT::ExeSpace>(0,ncol*n1*n2),
+                       KOKKOS_LAMBDA(const int k) {
+    const int i = k / (n1*n2);
+    const int j = (k / n2) % n1;
+    const int l = k % n2;
+    if constexpr (rank==1) {
+      v(i) = buf(i,offset);
+    } else if constexpr (rank==2) {
+      v(i,j) = buf(i,offset+j);
+    } else {
+      v(i,j,l) = buf(i,offset+j*n2+l);
+    }
+  });
+  return offset + n1*n2;
+}
+
+} // namespace scream
+
+#endif // SCREAM_RRTMGP_SW_BALANCER_HPP
@@ -1,6 +1,7 @@
 #include "catch2/catch.hpp"
 #include "physics/rrtmgp/rrtmgp_utils.hpp"
 #include "physics/rrtmgp/eamxx_rrtmgp_interface.hpp"
+#include "physics/rrtmgp/eamxx_rrtmgp_sw_balancer.hpp"
 #include "physics/share/physics_constants.hpp"
 #include "physics/rrtmgp/shr_orb_mod_c2f.hpp"
 #include "mo_load_coefficients.h"
@@ -803,4 +804,89 @@ TEST_CASE("rrtmgp_aerocom_cloudtop_k") {
   scream::finalize_kls();
 }
 
+TEST_CASE("rrtmgp_sw_daylight_balancer") {
+  using namespace scream;
+  using SWB = SWDaylightBalancer;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  // Uneven number of columns per rank. On rank 0 all columns are daytime,
+  // while on other ranks only one every three columns is.
+  const int rank = comm.rank();
+  const int ncol = 6 + rank%3;
+  const int nvals = 3;
+  int gid_offset = 0;
+  for (int pid=0; pid<rank; ++pid) {
+    gid_offset += 6 + pid%3;
+  }
+  auto is_day = [](const int gid, const int pid) { return pid==0 or gid%3==0; };
+
+  SWB::view_1d<Real> mu0 ("mu0",ncol);
+  SWB::view_2d<Real> local ("local",ncol,nvals);
+  auto mu0_h   = Kokkos::create_mirror_view(mu0);
+  auto local_h = Kokkos::create_mirror_view(local);
+  int nday = 0;
+  for (int i=0; i<ncol; ++i) {
+    const int gid = gid_offset + i;
+    mu0_h(i) = is_day(gid,rank) ? 0.5 : -0.5;
+    nday += mu0_h(i)>0;
+    for (int j=0; j<nvals; ++j) {
+      local_h(i,j) = 10*gid + j;
+    }
+  }
+  Kokkos::deep_copy(mu0,mu0_h);
+  Kokkos::deep_copy(local,local_h);
+
+  SWB balancer(comm,ncol);
+  balancer.setup(mu0);
+  REQUIRE (balancer.num_day_cols()==nday);
+
+  // Work is never larger than the number of local columns, and no column is lost
+  const int nwork = balancer.num_work_cols();
+  REQUIRE (nwork<=ncol);
+  int nday_global, nwork_global;
+  comm.all_reduce(&nday,&nday_global,1,MPI_SUM);
+  comm.all_reduce(&nwork,&nwork_global,1,MPI_SUM);
+  REQUIRE (nwork_global==nday_global);
+
+  // Work columns must all be daytime columns
+  SWB::view_2d<Real> work ("work",ncol,nvals);
+  balancer.to_work(local,work);
+  auto work_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),work);
+  for (int i=0; i<nwork; ++i) {
+    const int gid = static_cast<int>(work_h(i,0)) / 10;
+    REQUIRE (work_h(i,1)==work_h(i,0)+1);
+    REQUIRE (work_h(i,2)==work_h(i,0)+2);
+    REQUIRE ((gid%3==0 or gid<6));
+  }
+
+  // Results go back to the owners, and only daytime columns are set
+  Kokkos::parallel_for(Kokkos::RangePolicy<SWB::KT::ExeSpace>(0,nwork*nvals),
+                       KOKKOS_LAMBDA(const int k) {
+    work(k/nvals,k%nvals) *= 2;
+  });
+  SWB::view_2d<Real> result ("result",ncol,nvals);
+  balancer.from_work(work,result);
+  auto result_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),result);
+  for (int i=0; i<ncol; ++i) {
+    for (int j=0; j<nvals; ++j) {
+      const Real expected = mu0_h(i)>0 ? 2*local_h(i,j) : 0;
+      REQUIRE (result_h(i,j)==expected);
+    }
+  }
+
+  // Packing utilities
+  SWB::view_2d<Real> buf ("buf",ncol,1+nvals);
+  int offset = SWB::pack_columns(ncol,mu0,buf,0);
+  offset = SWB::pack_columns(ncol,local,buf,offset);
+  REQUIRE (offset==1+nvals);
+  SWB::view_1d<Real> mu0_copy ("mu0_copy",ncol);
+  offset = SWB::unpack_columns(ncol,buf,0,mu0_copy);
+  REQUIRE (offset==1);
+  auto mu0_copy_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),mu0_copy);
+  for (int i=0; i<ncol; ++i) {
+    REQUIRE (mu0_copy_h(i)==mu0_h(i));
+  }
+}
+
 }
@@ -0,0 +1,83 @@
+#include "eamxx_kernel_mode_tuner.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+namespace scream {
+namespace physics {
+
+KernelMode str2kernel_mode (const std::string& s)
+{
+  KernelMode mode = KernelMode::Monolithic;
+  if (s=="monolithic") {
+    mode = KernelMode::Monolithic;
+  } else if (s=="small") {
+    mode = KernelMode::Small;
+  } else if (s=="auto") {
+    mode = KernelMode::Auto;
+  } else {
+    EKAT_ERROR_MSG ("Error! Invalid kernel mode.\n"
+                    " - input value : " + s + "\n"
+                    " - valid values: monolithic, small, auto\n");
+  }
+  return mode;
+}
+
+std::string e2str (const KernelMode mode)
+{
+  std::string s;
+  switch (mode) {
+    case KernelMode::Monolithic: s = "monolithic"; break;
+    case KernelMode::Small:      s = "small";      break;
+    case KernelMode::Auto:       s = "auto";       break;
+  }
+  return s;
+}
+
+KernelModeTuner::
+KernelModeTuner (const ekat::Comm& comm, const KernelMode mode, const int num_trials)
+ : m_comm (comm)
+ , m_mode (mode)
+ , m_num_trials (num_trials)
+{
+  EKAT_REQUIRE_MSG (mode!=KernelMode::Auto or num_trials>0,
+      "Error! Kernel mode autotuning requires a positive number of trials.\n"
+      " - num trials: " + std::to_string(num_trials) + "\n");
+}
+
+bool KernelModeTuner::use_small_kernels () const
+{
+  if (m_mode==KernelMode::Auto) {
+    // Alternate between the two modes, starting with monolithic
+    return m_num_calls%2==1;
+  }
+  return m_mode==KernelMode::Small;
+}
+
+bool KernelModeTuner::record (const long long elapsed_microsec)
+{
+  if (not tuning()) {
+    return false;
+  }
+
+  // The first call of each mode is a warmup
+  const int imode = m_num_calls%2;
+  if (m_num_calls>=2) {
+    m_time[imode] += elapsed_microsec;
+  }
+  ++m_num_calls;
+
+  if (m_num_calls<2*(m_num_trials+1)) {
+    return false;
+  }
+
+  m_comm.all_reduce(m_time,m_avg_time,2,MPI_MAX);
+  m_avg_time[0] /= m_num_trials;
+  m_avg_time[1] /= m_num_trials;
+
+  // In case of a tie, prefer the monolithic kernel
+  m_mode = m_avg_time[1]<m_avg_time[0] ? KernelMode::Small : KernelMode::Monolithic;
+  return true;
+}
+
+} // namespace physics
+} // namespace scream
@@ -0,0 +1,77 @@
+#ifndef SCREAM_KERNEL_MODE_TUNER_HPP
+#define SCREAM_KERNEL_MODE_TUNER_HPP
+
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <string>
+
+namespace scream {
+namespace physics {
+
+/*
+ * Runtime selection of monolithic vs small kernels
+ *
+ * Some parameterizations (P3, SHOC) can run their main routine either as one
+ * monolithic kernel (one team per column, doing all the work), or as a sequence
+ * of small kernels. Which one is faster depends on the architecture, the number
+ * of columns per rank, and the compiler, so the choice is made at runtime:
+ *  - monolithic/small: always use that mode
+ *  - auto: time both modes during the first calls, then stick with the faster one
+ *
+ * In auto mode, the calls alternate between the two modes. The first call of each
+ * mode is considered a warmup (e.g., on GPU it includes one-time allocations), and
+ * is not counted. After num_trials timed calls per mode, the time of each mode is
+ * max-reduced across ranks (the slowest rank sets the pace), and the faster mode is
+ * selected on all ranks. Hence, record must be called by all ranks the same number
+ * of times. Since both modes give the same answers, tuning does not change results.
+ */
+
+enum class KernelMode {
+  Monolithic,
+  Small,
+  Auto
+};
+
+// Parse "monolithic", "small", or "auto"
+KernelMode str2kernel_mode (const std::string& s);
+std::string e2str (const KernelMode mode);
+
+class KernelModeTuner
+{
+public:
+  KernelModeTuner () = default;
+  KernelModeTuner (const ekat::Comm& comm, const KernelMode mode, const int num_trials = 3);
+
+  // Whether the next call should use small kernels
+  bool use_small_kernels () const;
+
+  // Whether the mode is still being tuned
+  bool tuning () const { return m_mode==KernelMode::Auto; }
+
+  // Record the elapsed time of the last call. Once all trials are done, the faster
+  // mode is selected, and true is returned (only once). This is a collective call
+  // on the last trial.
+  bool record (const long long elapsed_microsec);
+
+  // The selected mode (Auto while tuning)
+  KernelMode mode () const { return m_mode; }
+
+  // Average time per call of each mode during tuning (max over ranks)
+  double avg_time_monolithic () const { return m_avg_time[0]; }
+  double avg_time_small      () const { return m_avg_time[1]; }
+
+protected:
+
+  ekat::Comm  m_comm;
+  KernelMode  m_mode       = KernelMode::Monolithic;
+  int         m_num_trials = 0;
+  int         m_num_calls  = 0;
+
+  double      m_time[2]     = {0,0};
+  double      m_avg_time[2] = {0,0};
+};
+
+} // namespace physics
+} // namespace scream
+
+#endif // SCREAM_KERNEL_MODE_TUNER_HPP
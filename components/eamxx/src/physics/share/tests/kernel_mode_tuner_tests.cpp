@@ -0,0 +1,56 @@
+#include "catch2/catch.hpp"
+
+#include "physics/share/eamxx_kernel_mode_tuner.hpp"
+
+namespace scream {
+namespace physics {
+
+TEST_CASE("kernel_mode_tuner")
+{
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  SECTION ("parse") {
+    for (auto m : {KernelMode::Monolithic, KernelMode::Small, KernelMode::Auto}) {
+      REQUIRE (str2kernel_mode(e2str(m))==m);
+    }
+    REQUIRE_THROWS (str2kernel_mode("medium"));
+  }
+
+  SECTION ("fixed") {
+    KernelModeTuner mono(comm,KernelMode::Monolithic);
+    KernelModeTuner small(comm,KernelMode::Small);
+    for (int i=0; i<10; ++i) {
+      REQUIRE (not mono.use_small_kernels());
+      REQUIRE (small.use_small_kernels());
+      REQUIRE (not mono.record(1));
+      REQUIRE (not small.record(1));
+    }
+  }
+
+  SECTION ("auto") {
+    const int num_trials = 2;
+    for (bool small_is_faster : {true, false}) {
+      KernelModeTuner tuner(comm,KernelMode::Auto,num_trials);
+      const long long t_mono  = small_is_faster ? 20 : 10;
+      const long long t_small = small_is_faster ? 10 : 20;
+
+      // Warmup calls are slow, and must not be counted
+      for (int i=0; i<2*(num_trials+1); ++i) {
+        REQUIRE (tuner.tuning());
+        const bool small = tuner.use_small_kernels();
+        REQUIRE (small==(i%2==1));
+        const bool done = tuner.record(i<2 ? 1000 : (small ? t_small : t_mono));
+        REQUIRE (done==(i==2*num_trials+1));
+      }
+
+      REQUIRE (not tuner.tuning());
+      REQUIRE (tuner.use_small_kernels()==small_is_faster);
+      REQUIRE (tuner.avg_time_monolithic()==t_mono);
+      REQUIRE (tuner.avg_time_small()==t_small);
+      REQUIRE (not tuner.record(1));
+    }
+  }
+}
+
+} // namespace physics
+} // namespace scream
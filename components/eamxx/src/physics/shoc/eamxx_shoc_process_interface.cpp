@@ -16,6 +16,15 @@ SHOCMacrophysics::SHOCMacrophysics (const ekat::Comm& comm,const ekat::Parameter
   /* Anything that can be initialized without grid information can be initialized here.
    * Like universal constants, shoc options.
    */
+
+  // Monolithic or small kernels. The default is set at configure time, but it can be
+  // overridden here, or chosen by timing both modes during the first steps ('auto')
+  const auto kernel_mode = m_params.get<std::string>("kernel_mode","default");
+  if (kernel_mode=="default") {
+    m_kernel_mode = SHF::default_small_kernels ? physics::KernelMode::Small : physics::KernelMode::Monolithic;
+  } else {
+    m_kernel_mode = physics::str2kernel_mode(kernel_mode);
+  }
 }
 
 // =========================================================================================
@@ -151,11 +160,16 @@ size_t SHOCMacrophysics::requested_buffer_size_in_bytes() const
   const int num_tracer_packs = ekat::npack<Spack>(m_num_tracers);
 
   // Number of Reals needed by local views in the interface
-  const size_t interface_request = Buffer::num_1d_scalar_ncol*m_num_cols*sizeof(Real) +
-                                   Buffer::num_1d_scalar_nlev*nlev_packs*sizeof(Spack) +
-                                   Buffer::num_2d_vector_mid*m_num_cols*nlev_packs*sizeof(Spack) +
-                                   Buffer::num_2d_vector_int*m_num_cols*nlevi_packs*sizeof(Spack) +
-                                   Buffer::num_2d_vector_tr*m_num_cols*num_tracer_packs*sizeof(Spack);
+  size_t interface_request = Buffer::num_1d_scalar_ncol*m_num_cols*sizeof(Real) +
+                             Buffer::num_1d_scalar_nlev*nlev_packs*sizeof(Spack) +
+                             Buffer::num_2d_vector_mid*m_num_cols*nlev_packs*sizeof(Spack) +
+                             Buffer::num_2d_vector_int*m_num_cols*nlevi_packs*sizeof(Spack) +
+                             Buffer::num_2d_vector_tr*m_num_cols*num_tracer_packs*sizeof(Spack);
+  if (m_kernel_mode==physics::KernelMode::Small) {
+    interface_request += Buffer::num_1d_scalar_ncol_sk*m_num_cols*sizeof(Real) +
+                         Buffer::num_2d_vector_mid_sk*m_num_cols*nlev_packs*sizeof(Spack) +
+                         Buffer::num_2d_vector_int_sk*m_num_cols*nlevi_packs*sizeof(Spack);
+  }
 
   // Number of Reals needed by the WorkspaceManager passed to shoc_main
   const auto policy       = ekat::ExeSpaceUtils<KT::ExeSpace>::get_default_team_policy(m_num_cols, nlev_packs);
@@ -176,18 +190,33 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
   // 1d scalar views
   using scalar_view_t = decltype(m_buffer.wpthlp_sfc);
   scalar_view_t* _1d_scalar_view_ptrs[Buffer::num_1d_scalar_ncol] =
-    {&m_buffer.wpthlp_sfc, &m_buffer.wprtp_sfc, &m_buffer.upwp_sfc, &m_buffer.vpwp_sfc
-#ifdef SCREAM_SHOC_SMALL_KERNELS
-     , &m_buffer.se_b, &m_buffer.ke_b, &m_buffer.wv_b, &m_buffer.wl_b
-     , &m_buffer.se_a, &m_buffer.ke_a, &m_buffer.wv_a, &m_buffer.wl_a
-     , &m_buffer.kbfs, &m_buffer.ustar2, &m_buffer.wstar
-#endif
-    };
+    {&m_buffer.wpthlp_sfc, &m_buffer.wprtp_sfc, &m_buffer.upwp_sfc, &m_buffer.vpwp_sfc};
   for (int i = 0; i < Buffer::num_1d_scalar_ncol; ++i) {
     *_1d_scalar_view_ptrs[i] = scalar_view_t(mem, m_num_cols);
     mem += _1d_scalar_view_ptrs[i]->size();
   }
 
+  // Temporaries for small kernels. If small kernels are selected, they live in the buffer manager.
+  // While autotuning, they get their own allocation, which is released if monolithic
+  // kernels are selected (see run_impl).
+  const bool alloc_sk = m_kernel_mode!=physics::KernelMode::Monolithic;
+  Real* sk_mem = mem;
+  if (m_kernel_mode==physics::KernelMode::Auto) {
+    m_sk_scalar_mem = decltype(m_sk_scalar_mem)("shoc_sk_scalar_temporaries",Buffer::num_1d_scalar_ncol_sk*m_num_cols);
+    sk_mem = m_sk_scalar_mem.data();
+  }
+  scalar_view_t* _1d_scalar_sk_view_ptrs[Buffer::num_1d_scalar_ncol_sk] =
+    {&m_buffer.se_b, &m_buffer.ke_b, &m_buffer.wv_b, &m_buffer.wl_b,
+     &m_buffer.se_a, &m_buffer.ke_a, &m_buffer.wv_a, &m_buffer.wl_a,
+     &m_buffer.kbfs, &m_buffer.ustar2, &m_buffer.wstar};
+  for (int i = 0; alloc_sk and i < Buffer::num_1d_scalar_ncol_sk; ++i) {
+    *_1d_scalar_sk_view_ptrs[i] = scalar_view_t(sk_mem, m_num_cols);
+    sk_mem += _1d_scalar_sk_view_ptrs[i]->size();
+  }
+  if (m_kernel_mode==physics::KernelMode::Small) {
+    mem = sk_mem;
+  }
+
   Spack* s_mem = reinterpret_cast<Spack*>(mem);
 
   // 2d packed views
@@ -203,18 +232,20 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
     &m_buffer.z_mid, &m_buffer.rrho, &m_buffer.thv, &m_buffer.dz, &m_buffer.zt_grid, &m_buffer.wm_zt, &m_buffer.unused,
     &m_buffer.inv_exner, &m_buffer.thlm, &m_buffer.qw, &m_buffer.dse, &m_buffer.tke_copy, &m_buffer.qc_copy,
     &m_buffer.shoc_ql2, &m_buffer.shoc_mix, &m_buffer.isotropy, &m_buffer.w_sec, &m_buffer.wqls_sec, &m_buffer.brunt
-#ifdef SCREAM_SHOC_SMALL_KERNELS
-    , &m_buffer.rho_zt, &m_buffer.shoc_qv, &m_buffer.tabs, &m_buffer.dz_zt
-#endif
   };
 
   spack_2d_view_t* _2d_spack_int_view_ptrs[Buffer::num_2d_vector_int] = {
     &m_buffer.z_int, &m_buffer.rrho_i, &m_buffer.zi_grid, &m_buffer.thl_sec, &m_buffer.qw_sec,
     &m_buffer.qwthl_sec, &m_buffer.wthl_sec, &m_buffer.wqw_sec, &m_buffer.wtke_sec, &m_buffer.uw_sec,
     &m_buffer.vw_sec, &m_buffer.w3
-#ifdef SCREAM_SHOC_SMALL_KERNELS
-    , &m_buffer.dz_zi
-#endif
+  };
+
+  spack_2d_view_t* _2d_spack_mid_sk_view_ptrs[Buffer::num_2d_vector_mid_sk] = {
+    &m_buffer.rho_zt, &m_buffer.shoc_qv, &m_buffer.tabs, &m_buffer.dz_zt
+  };
+
+  spack_2d_view_t* _2d_spack_int_sk_view_ptrs[Buffer::num_2d_vector_int_sk] = {
+    &m_buffer.dz_zi
   };
 
   for (int i = 0; i < Buffer::num_2d_vector_mid; ++i) {
@@ -226,6 +257,27 @@ void SHOCMacrophysics::init_buffers(const ATMBufferManager &buffer_manager)
     *_2d_spack_int_view_ptrs[i] = spack_2d_view_t(s_mem, m_num_cols, nlevi_packs);
     s_mem += _2d_spack_int_view_ptrs[i]->size();
   }
+
+  Spack* sk_s_mem = s_mem;
+  if (m_kernel_mode==physics::KernelMode::Auto) {
+    m_sk_spack_mem = decltype(m_sk_spack_mem)("shoc_sk_spack_temporaries",
+                                              Buffer::num_2d_vector_mid_sk*m_num_cols*nlev_packs +
+                                              Buffer::num_2d_vector_int_sk*m_num_cols*nlevi_packs);
+    sk_s_mem = m_sk_spack_mem.data();
+  }
+
+  for (int i = 0; alloc_sk and i < Buffer::num_2d_vector_mid_sk; ++i) {
+    *_2d_spack_mid_sk_view_ptrs[i] = spack_2d_view_t(sk_s_mem, m_num_cols, nlev_packs);
+    sk_s_mem += _2d_spack_mid_sk_view_ptrs[i]->size();
+  }
+
+  for (int i = 0; alloc_sk and i < Buffer::num_2d_vector_int_sk; ++i) {
+    *_2d_spack_int_sk_view_ptrs[i] = spack_2d_view_t(sk_s_mem, m_num_cols, nlevi_packs);
+    sk_s_mem += _2d_spack_int_sk_view_ptrs[i]->size();
+  }
+  if (m_kernel_mode==physics::KernelMode::Small) {
+    s_mem = sk_s_mem;
+  }
   m_buffer.wtracer_sfc = decltype(m_buffer.wtracer_sfc)(s_mem, m_num_cols, num_tracer_packs);
   s_mem += m_buffer.wtracer_sfc.size();
 
@@ -383,7 +435,7 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   history_output.wqls_sec  = m_buffer.wqls_sec;
   history_output.brunt     = m_buffer.brunt;
 
-#ifdef SCREAM_SHOC_SMALL_KERNELS
+  // Temporaries for small kernels (unallocated if kernel_mode=monolithic)
   temporaries.se_b = m_buffer.se_b;
   temporaries.ke_b = m_buffer.ke_b;
   temporaries.wv_b = m_buffer.wv_b;
@@ -401,7 +453,8 @@ void SHOCMacrophysics::initialize_impl (const RunType run_type)
   temporaries.tabs = m_buffer.tabs;
   temporaries.dz_zt = m_buffer.dz_zt;
   temporaries.dz_zi = m_buffer.dz_zi;
-#endif
+
+  m_kernel_mode_tuner = physics::KernelModeTuner(get_comm(),m_kernel_mode);
 
   shoc_postprocess.set_variables(m_num_cols,m_num_levs,
                                  rrho,qv,qw,qc,qc_copy,tke,tke_copy,qtracers,shoc_ql2,
@@ -516,12 +569,24 @@ void SHOCMacrophysics::run_impl (const double dt)
   workspace_mgr.reset_internals();
 
   // Run shoc main
-  SHF::shoc_main(m_num_cols, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, dt,
-                 workspace_mgr,runtime_options,input,input_output,output,history_output
-#ifdef SCREAM_SHOC_SMALL_KERNELS
-                 , temporaries
-#endif
-                 );
+  runtime_options.small_kernels = m_kernel_mode_tuner.use_small_kernels();
+  const auto elapsed_microsec = SHF::shoc_main(m_num_cols, m_num_levs, m_num_levs+1, m_npbl, m_nadv, m_num_tracers, dt,
+                                               workspace_mgr,runtime_options,input,input_output,output,history_output,
+                                               temporaries);
+  if (m_kernel_mode_tuner.record(elapsed_microsec)) {
+    this->log(LogLevel::info,
+        "SHOC kernel mode autotuning:\n"
+        "  - avg time (monolithic): " + std::to_string(m_kernel_mode_tuner.avg_time_monolithic()) + " us\n"
+        "  - avg time (small)     : " + std::to_string(m_kernel_mode_tuner.avg_time_small()) + " us\n"
+        "  - selected mode        : " + physics::e2str(m_kernel_mode_tuner.mode()) + "\n");
+    if (m_kernel_mode_tuner.mode()==physics::KernelMode::Monolithic) {
+      // The small kernels temporaries are no longer needed.
+      // NOTE: the corresponding m_buffer views are only used in initialize_impl.
+      temporaries = SHF::SHOCTemporaries();
+      m_sk_scalar_mem = decltype(m_sk_scalar_mem)();
+      m_sk_spack_mem  = decltype(m_sk_spack_mem)();
+    }
+  }
 
   // Postprocessing of SHOC outputs
   Kokkos::parallel_for("shoc_postprocess",
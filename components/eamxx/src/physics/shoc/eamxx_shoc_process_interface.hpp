@@ -4,6 +4,7 @@
 #include "share/atm_process/atmosphere_process.hpp"
 #include "ekat/ekat_parameter_list.hpp"
 #include "physics/shoc/shoc_functions.hpp"
+#include "physics/share/eamxx_kernel_mode_tuner.hpp"
 #include "share/util/eamxx_common_physics_functions.hpp"
 #include "share/atm_process/ATMBufferManager.hpp"
 
@@ -377,26 +378,21 @@ public:
 
   // Structure for storing local variables initialized using the ATMBufferManager
   struct Buffer {
-#ifndef SCREAM_SHOC_SMALL_KERNELS
     static constexpr int num_1d_scalar_ncol = 4;
-#else
-    static constexpr int num_1d_scalar_ncol = 15;
-#endif
     static constexpr int num_1d_scalar_nlev = 1;
-#ifndef SCREAM_SHOC_SMALL_KERNELS
     static constexpr int num_2d_vector_mid  = 19;
     static constexpr int num_2d_vector_int  = 12;
-#else
-    static constexpr int num_2d_vector_mid  = 23;
-    static constexpr int num_2d_vector_int  = 13;
-#endif
     static constexpr int num_2d_vector_tr   = 1;
 
+    // Temporaries for small kernels, only allocated if small kernels may be used
+    static constexpr int num_1d_scalar_ncol_sk = 11;
+    static constexpr int num_2d_vector_mid_sk  = 4;
+    static constexpr int num_2d_vector_int_sk  = 1;
+
     uview_1d<Real> wpthlp_sfc;
     uview_1d<Real> wprtp_sfc;
     uview_1d<Real> upwp_sfc;
     uview_1d<Real> vpwp_sfc;
-#ifdef SCREAM_SHOC_SMALL_KERNELS
     uview_1d<Real> se_b;
     uview_1d<Real> ke_b;
     uview_1d<Real> wv_b;
@@ -408,7 +404,6 @@ public:
     uview_1d<Real> kbfs;
     uview_1d<Real> ustar2;
     uview_1d<Real> wstar;
-#endif
 
     uview_1d<Spack> pref_mid;
 
@@ -444,14 +439,12 @@ public:
     uview_2d<Spack> w3;
     uview_2d<Spack> wqls_sec;
     uview_2d<Spack> brunt;
-#ifdef SCREAM_SHOC_SMALL_KERNELS
     uview_2d<Spack> rho_zt;
     uview_2d<Spack> shoc_qv;
     uview_2d<Spack> tabs;
     uview_2d<Spack> dz_zt;
     uview_2d<Spack> dz_zi;
     uview_2d<Spack> tkh;
-#endif
 
     Spack* wsm_data;
   };
@@ -502,9 +495,15 @@ protected:
   SHF::SHOCOutput output;
   SHF::SHOCHistoryOutput history_output;
   SHF::SHOCRuntime runtime_options;
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   SHF::SHOCTemporaries temporaries;
-#endif
+
+  // Monolithic vs small kernels (possibly autotuned during the first steps)
+  physics::KernelMode       m_kernel_mode;
+  physics::KernelModeTuner  m_kernel_mode_tuner;
+
+  // Memory for the small kernels temporaries while autotuning (see init_buffers)
+  view_1d                       m_sk_scalar_mem;
+  typename SHF::view_1d<Spack>  m_sk_spack_mem;
 
   // Structures which compute pre/post process
   SHOCPreprocess shoc_preprocess;
@@ -77,6 +77,14 @@ struct Functions
   using WorkspaceMgr = typename ekat::WorkspaceManager<Spack,  Device>;
   using Workspace    = typename WorkspaceMgr::Workspace;
 
+  // Whether shoc_main uses small kernels by default. Both the monolithic and the small
+  // kernels are always built, so this can be overridden at runtime (see SHOCRuntime).
+#ifdef SCREAM_SHOC_SMALL_KERNELS
+  static constexpr bool default_small_kernels = true;
+#else
+  static constexpr bool default_small_kernels = false;
+#endif
+
   // This struct stores runtime options for shoc_main
  struct SHOCRuntime {
    SHOCRuntime() = default;
@@ -95,6 +103,8 @@ struct Functions
    Scalar Ckm;
    bool shoc_1p5tke;
    bool extra_diags;
+   // Run shoc_main as a sequence of small kernels (requires SHOCTemporaries)
+   bool small_kernels = default_small_kernels;
  };
 
   // This struct stores input views for shoc_main.
@@ -217,7 +227,6 @@ struct Functions
     view_2d<Spack>  shoc_evap;
   };
 
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   struct SHOCTemporaries {
     SHOCTemporaries() = default;
 
@@ -240,7 +249,6 @@ struct Functions
     view_2d<Spack> dz_zi;
     view_2d<Spack> tkh;
   };
-#endif
 
   //
   // --------- Functions ---------
@@ -286,7 +294,6 @@ struct Functions
     const uview_1d<const Spack>& zt_grid,
     const Scalar& phis,
     const uview_1d<Spack>& host_dse);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void update_host_dse_disp(
     const Int& shcol,
     const Int& nlev,
@@ -296,7 +303,6 @@ struct Functions
     const view_2d<const Spack>& zt_grid,
     const view_1d<const Scalar>& phis,
     const view_2d<Spack>& host_dse);
-#endif
 
   KOKKOS_FUNCTION
   static void compute_diag_third_shoc_moment(
@@ -342,12 +348,10 @@ struct Functions
     const MemberType& team,
     const Int& nlev,
     const uview_1d<Spack>& tke);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void check_tke_disp(
     const Int& schol,
     const Int& nlev,
     const view_2d<Spack>& tke);
-#endif
 
   KOKKOS_FUNCTION
   static void clipping_diag_third_shoc_moments(
@@ -381,7 +385,6 @@ struct Functions
     Scalar&                      ke_int,
     Scalar&                      wv_int,
     Scalar&                      wl_int);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void shoc_energy_integrals_disp(
     const Int&                   shcol,
     const Int&                   nlev,
@@ -395,7 +398,6 @@ struct Functions
     const view_1d<Scalar>& ke_b_slot,
     const view_1d<Scalar>& wv_b_slot,
     const view_1d<Scalar>& wl_b_slot);
-#endif
 
   KOKKOS_FUNCTION
   static void shoc_diag_second_moments_lbycond(
@@ -427,7 +429,6 @@ struct Functions
      const Workspace& workspace, const uview_1d<Spack>& thl_sec,
      const uview_1d<Spack>& qw_sec, const uview_1d<Spack>& wthl_sec, const uview_1d<Spack>& wqw_sec, const uview_1d<Spack>& qwthl_sec,
      const uview_1d<Spack>& uw_sec, const uview_1d<Spack>& vw_sec, const uview_1d<Spack>& wtke_sec, const uview_1d<Spack>& w_sec);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void diag_second_shoc_moments_disp(
     const Int& shcol, const Int& nlev, const Int& nlevi,
     const Scalar& thl2tune,
@@ -463,7 +464,6 @@ struct Functions
     const view_2d<Spack>& vw_sec,
     const view_2d<Spack>& wtke_sec,
     const view_2d<Spack>& w_sec);
-#endif
 
   KOKKOS_FUNCTION
   static void compute_brunt_shoc_length(
@@ -504,7 +504,6 @@ struct Functions
     Scalar&       ustar,
     Scalar&       kbfs,
     Scalar&       obklen);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void shoc_diag_obklen_disp(
     const Int&                   shcol,
     const Int&                   nlev,
@@ -518,7 +517,6 @@ struct Functions
     const view_1d<Scalar>&       ustar,
     const view_1d<Scalar>&       kbfs,
     const view_1d<Scalar>&       obklen);
-#endif
 
   KOKKOS_FUNCTION
   static void shoc_pblintd_cldcheck(
@@ -543,7 +541,6 @@ struct Functions
     const Workspace&             workspace,
     const uview_1d<Spack>&       brunt,
     const uview_1d<Spack>&       shoc_mix);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void shoc_length_disp(
     const Int&                   shcol,
     const Int&                   nlev,
@@ -561,7 +558,6 @@ struct Functions
     const WorkspaceMgr&          workspace_mgr,
     const view_2d<Spack>&        brunt,
     const view_2d<Spack>&        shoc_mix);
-#endif
 
   KOKKOS_FUNCTION
   static void shoc_energy_fixer(
@@ -587,7 +583,6 @@ struct Functions
     const uview_1d<const Spack>& pint,
     const Workspace&             workspace,
     const uview_1d<Spack>&       host_dse);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void shoc_energy_fixer_disp(
     const Int&                   shcol,
     const Int&                   nlev,
@@ -611,7 +606,6 @@ struct Functions
     const view_2d<const Spack>&  pint,
     const WorkspaceMgr&          workspace_mgr,
     const view_2d<Spack>&        host_dse);
-#endif
 
   KOKKOS_FUNCTION
   static void compute_shoc_vapor(
@@ -620,14 +614,12 @@ struct Functions
     const uview_1d<const Spack>& qw,
     const uview_1d<const Spack>& ql,
     const uview_1d<Spack>&       qv);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void compute_shoc_vapor_disp(
     const Int&                  shcol,
     const Int&                  nlev,
     const view_2d<const Spack>& qw,
     const view_2d<const Spack>& ql,
     const view_2d<Spack>&       qv);
-#endif
 
   KOKKOS_FUNCTION
   static void compute_shoc_temperature(
@@ -637,7 +629,6 @@ struct Functions
     const uview_1d<const Spack>& ql,
     const uview_1d<const Spack>& inv_exner,
     const uview_1d<Spack>&       tabs);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void compute_shoc_temperature_disp(
     const Int&                  shcol,
     const Int&                  nlev,
@@ -645,7 +636,6 @@ struct Functions
     const view_2d<const Spack>& ql,
     const view_2d<const Spack>& inv_exner,
     const view_2d<Spack>&       tabs);
-#endif
 
   KOKKOS_FUNCTION
   static void update_prognostics_implicit(
@@ -673,7 +663,6 @@ struct Functions
     const uview_1d<Spack>&       tke,
     const uview_1d<Spack>&       u_wind,
     const uview_1d<Spack>&       v_wind);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void update_prognostics_implicit_disp(
     const Int&                   shcol,
     const Int&                   nlev,
@@ -699,7 +688,6 @@ struct Functions
     const view_2d<Spack>&        tke,
     const view_2d<Spack>&        u_wind,
     const view_2d<Spack>&        v_wind);
-#endif
 
   KOKKOS_FUNCTION
   static void diag_third_shoc_moments(
@@ -721,7 +709,6 @@ struct Functions
     const uview_1d<const Spack>& zi_grid,
     const Workspace&             workspace,
     const uview_1d<Spack>&       w3);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void diag_third_shoc_moments_disp(
     const Int&                  shcol,
     const Int&                  nlev,
@@ -741,7 +728,6 @@ struct Functions
     const view_2d<const Spack>& zi_grid,
     const WorkspaceMgr&         workspace_mgr,
     const view_2d<Spack>&       w3);
-#endif
 
   KOKKOS_FUNCTION
   static void adv_sgs_tke(
@@ -785,7 +771,6 @@ struct Functions
     const uview_1d<Spack>&       wqls,
     const uview_1d<Spack>&       wthv_sec,
     const uview_1d<Spack>&       shoc_ql2);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void shoc_assumed_pdf_disp(
     const Int&                  shcol,
     const Int&                  nlev,
@@ -813,7 +798,6 @@ struct Functions
     const view_2d<Spack>&       wqls,
     const view_2d<Spack>&       wthv_sec,
     const view_2d<Spack>&       shoc_ql2);
-#endif
 
   KOKKOS_INLINE_FUNCTION
   static void shoc_assumed_pdf_compute_buoyancy_flux(
@@ -1018,7 +1002,6 @@ struct Functions
     const Int&                  ntop_shoc,
     const view_1d<const Spack>& pref_mid);
 
-#ifndef SCREAM_SHOC_SMALL_KERNELS
   KOKKOS_FUNCTION
   static void shoc_main_internal(
     const MemberType&            team,
@@ -1097,7 +1080,6 @@ struct Functions
     const uview_1d<Spack>&       wqls_sec,
     const uview_1d<Spack>&       brunt,
     const uview_1d<Spack>&       isotropy);
-#else
   static void shoc_main_internal(
     const Int&                   shcol,        // Number of columns
     const Int&                   nlev,         // Number of levels
@@ -1192,7 +1174,6 @@ struct Functions
     const view_2d<Spack>& tabs,
     const view_2d<Spack>& dz_zt,
     const view_2d<Spack>& dz_zi);
-#endif
 
   // Return microseconds elapsed
   static Int shoc_main(
@@ -1209,9 +1190,7 @@ struct Functions
     const SHOCInputOutput&   shoc_input_output,    // Input/Output
     const SHOCOutput&        shoc_output,          // Output
     const SHOCHistoryOutput& shoc_history_output   // Output (diagnostic)
-#ifdef SCREAM_SHOC_SMALL_KERNELS
-    , const SHOCTemporaries& shoc_temporaries      // Temporaries for small kernels
-#endif
+    , const SHOCTemporaries& shoc_temporaries = {} // Temporaries (only needed for small kernels)
                        );
 
   KOKKOS_FUNCTION
@@ -1280,7 +1259,6 @@ struct Functions
     const uview_1d<const Spack>& cldn,
     const Workspace&             workspace,
     Scalar&                      pblh);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void pblintd_disp(
     const Int&                   shcol,
     const Int&                   nlev,
@@ -1299,7 +1277,6 @@ struct Functions
     const view_2d<const Spack>&  cldn,
     const WorkspaceMgr&          workspace_mgr,
     const view_1d<Scalar>&       pblh);
-#endif
 
   KOKKOS_FUNCTION
   static void shoc_grid(
@@ -1312,7 +1289,6 @@ struct Functions
     const uview_1d<Spack>&       dz_zt,
     const uview_1d<Spack>&       dz_zi,
     const uview_1d<Spack>&       rho_zt);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void shoc_grid_disp(
     const Int&                  shcol,
     const Int&                  nlev,
@@ -1323,7 +1299,6 @@ struct Functions
     const view_2d<Spack>&       dz_zt,
     const view_2d<Spack>&       dz_zi,
     const view_2d<Spack>&       rho_zt);
-#endif
 
   KOKKOS_FUNCTION
   static void eddy_diffusivities(
@@ -1372,7 +1347,6 @@ struct Functions
     const uview_1d<Spack>&       tk,
     const uview_1d<Spack>&       tkh,
     const uview_1d<Spack>&       isotropy);
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   static void shoc_tke_disp(
     const Int&                   shcol,
     const Int&                   nlev,
@@ -1402,7 +1376,6 @@ struct Functions
     const view_2d<Spack>&        tk,
     const view_2d<Spack>&        tkh,
     const view_2d<Spack>&        isotropy);
-#endif
 }; // struct Functions
 
 } // namespace shoc
@@ -265,7 +265,7 @@ void update_prognostics_implicit(UpdatePrognosticsImplicitData& d)
                                    d.wtracer_sfc, d.thetal, d.qw, d.tracer, d.tke, d.u_wind, d.v_wind);
 }
 
-void shoc_main(ShocMainData& d)
+void shoc_main(ShocMainData& d, bool small_kernels)
 {
   const int npbl = shoc_init_host(d.nlev, d.pref_mid, d.nbot_shoc, d.ntop_shoc);
   d.elapsed_s = shoc_main_host(d.shcol, d.nlev, d.nlevi, d.dtime, d.nadv, npbl, d.host_dx, d.host_dy, d.thv, d.zt_grid, d.zi_grid,
@@ -273,7 +273,7 @@ void shoc_main(ShocMainData& d)
               d.num_qtracers, d.w_field, d.inv_exner, d.phis, d.host_dse, d.tke, d.thetal, d.qw,
               d.u_wind, d.v_wind, d.qtracers, d.wthv_sec, d.tkh, d.tk, d.shoc_ql, d.shoc_cldfrac, d.pblh,
               d.shoc_mix, d.isotropy, d.w_sec, d.thl_sec, d.qw_sec, d.qwthl_sec, d.wthl_sec, d.wqw_sec,
-              d.wtke_sec, d.uw_sec, d.vw_sec, d.w3, d.wqls_sec, d.brunt, d.shoc_ql2);
+              d.wtke_sec, d.uw_sec, d.vw_sec, d.w3, d.wqls_sec, d.brunt, d.shoc_ql2, small_kernels);
 }
 
 void pblintd_height(PblintdHeightData& d)
@@ -2230,7 +2230,7 @@ Int shoc_main_host(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npb
                 Real* thetal, Real* qw, Real* u_wind, Real* v_wind, Real* qtracers, Real* wthv_sec, Real* tkh, Real* tk,
                 Real* shoc_ql, Real* shoc_cldfrac, Real* pblh, Real* shoc_mix, Real* isotropy, Real* w_sec, Real* thl_sec,
                 Real* qw_sec, Real* qwthl_sec, Real* wthl_sec, Real* wqw_sec, Real* wtke_sec, Real* uw_sec, Real* vw_sec,
-                Real* w3, Real* wqls_sec, Real* brunt, Real* shoc_ql2)
+                Real* w3, Real* wqls_sec, Real* brunt, Real* shoc_ql2, bool small_kernels)
 {
 
   using SHF  = Functions<Real, DefaultDevice>;
@@ -2380,10 +2380,10 @@ Int shoc_main_host(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npb
                                              uw_sec_d,    vw_sec_d,   w3_d,      wqls_sec_d,
                                              brunt_d,     isotropy_d, shoc_cond_d, shoc_evap_d};
   SHF::SHOCRuntime shoc_runtime_options{0.001,0.04,2.65,0.02,1.0,1.0,1.0,1.0,0.5,7.0,0.1,0.1};
+  shoc_runtime_options.small_kernels = small_kernels;
 
   const auto nlevi_packs = ekat::npack<Spack>(nlevi);
 
-#ifdef SCREAM_SHOC_SMALL_KERNELS
   view_1d
     se_b   ("se_b", shcol),
     ke_b   ("ke_b", shcol),
@@ -2407,7 +2407,6 @@ Int shoc_main_host(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npb
   SHF::SHOCTemporaries shoc_temporaries{
     se_b, ke_b, wv_b, wl_b, se_a, ke_a, wv_a, wl_a, kbfs, ustar2, wstar,
     rho_zt, shoc_qv, tabs, dz_zt, dz_zi};
-#endif
 
   // Create local workspace
   const int n_wind_slots = ekat::npack<Spack>(2)*Spack::n;
@@ -2416,11 +2415,8 @@ Int shoc_main_host(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npb
 
   const auto elapsed_microsec = SHF::shoc_main(shcol, nlev, nlevi, npbl, nadv, num_qtracers, dtime,
                                                workspace_mgr, shoc_runtime_options,
-                                               shoc_input, shoc_input_output, shoc_output, shoc_history_output
-#ifdef SCREAM_SHOC_SMALL_KERNELS
-                                               , shoc_temporaries
-#endif
-                                               );
+                                               shoc_input, shoc_input_output, shoc_output, shoc_history_output,
+                                               shoc_temporaries);
 
   // Copy wind back into separate views and
   // Transpose tracers
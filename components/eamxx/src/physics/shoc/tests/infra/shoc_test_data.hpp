@@ -989,7 +989,7 @@ void diag_second_moments                            (DiagSecondMomentsData& d);
 void diag_second_shoc_moments                       (DiagSecondShocMomentsData& d);
 void compute_shoc_vapor                             (ComputeShocVaporData& d);
 void update_prognostics_implicit                    (UpdatePrognosticsImplicitData& d);
-void shoc_main                                      (ShocMainData& d);
+void shoc_main                                      (ShocMainData& d, bool small_kernels = Functions<Real, DefaultDevice>::default_small_kernels);
 void pblintd_height                                 (PblintdHeightData& d);
 void vd_shoc_decomp_and_solve                       (VdShocDecompandSolveData& d);
 void pblintd_surf_temp(PblintdSurfTempData& d);
@@ -1084,7 +1084,8 @@ Int shoc_main_host(Int shcol, Int nlev, Int nlevi, Real dtime, Int nadv, Int npb
                 Real* qtracers, Real* wthv_sec, Real* tkh, Real* tk, Real* shoc_ql, Real* shoc_cldfrac, Real* pblh,
                 Real* shoc_mix, Real* isotropy, Real* w_sec, Real* thl_sec, Real* qw_sec, Real* qwthl_sec,
                 Real* wthl_sec, Real* wqw_sec, Real* wtke_sec, Real* uw_sec, Real* vw_sec, Real* w3, Real* wqls_sec,
-                Real* brunt, Real* shoc_ql2);
+                Real* brunt, Real* shoc_ql2,
+                bool small_kernels = Functions<Real, DefaultDevice>::default_small_kernels);
 
 void pblintd_height_host(Int shcol, Int nlev, Int npbl, Real* z, Real* u, Real* v, Real* ustar, Real* thv, Real* thv_ref, Real* pblh, Real* rino, bool* check);
 
@@ -381,9 +381,17 @@ struct UnitWrap::UnitTest<D>::TestShocMain : public UnitWrap::UnitTest<D>::Base
       }
     }
 
+    // The shoc_sk_tests executable is built with SHOC_TEST_SMALL_KERNELS, to exercise
+    // the small kernels regardless of the default kernel mode
+#ifdef SHOC_TEST_SMALL_KERNELS
+    constexpr bool small_kernels = true;
+#else
+    constexpr bool small_kernels = Functions::default_small_kernels;
+#endif
+
     // Get data from cxx
     for (auto& d : cxx_data) {
-      shoc_main(d);
+      shoc_main(d, small_kernels);
     }
 
     // Verify BFB results, all data should be in C layout
@@ -89,6 +89,10 @@ void ZMDeepConvection::run_impl (const double dt)
   const auto& phis     = get_field_in("phis").get_view<const Real*>();
   
   // Run ZM
+  // TODO: only the CAPE column routines (find_mse_max, compute_dilute_parcel,
+  //       compute_cape_from_parcel, entropy/ientropy) are ported to zm::Functions.
+  //       The plume and closure kernels are not, so ZM does not run here yet, and
+  //       there is no compaction of the triggered columns.
   
   // Update output fields
   
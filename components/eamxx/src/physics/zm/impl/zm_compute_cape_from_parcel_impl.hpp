@@ -0,0 +1,95 @@
+#ifndef ZM_COMPUTE_CAPE_FROM_PARCEL_IMPL_HPP
+#define ZM_COMPUTE_CAPE_FROM_PARCEL_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm compute_cape_from_parcel. Clients should NOT
+ * #include this file, but include zm_functions.hpp instead.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::compute_cape_from_parcel(
+  // Inputs
+  const Int& pver,
+  const Int& num_msg,
+  const ZMRuntime& runtime,
+  const uview_1d<const Scalar>& temperature,
+  const uview_1d<const Scalar>& tv,
+  const uview_1d<const Scalar>& sp_humidity,
+  const uview_1d<const Scalar>& pint,
+  const Int& msemax_klev,
+  const Scalar& lcl_pmid,
+  const Int& lcl_klev,
+  // Work arrays
+  const uview_1d<Scalar>& buoyancy,
+  // Inputs/Outputs
+  const uview_1d<Scalar>& parcel_qsat,
+  const uview_1d<Scalar>& parcel_temp,
+  const uview_1d<Scalar>& parcel_vtemp,
+  // Outputs
+  Int& eql_klev,
+  Scalar& cape)
+{
+  const Int num_cin = runtime.num_cin;
+  const bool lcl_ok = lcl_pmid >= ZMC::lcl_pressure_threshold;
+
+  Scalar cape_tmp[ZMC::max_num_cin];      // provisional values of cape
+  Int    eql_klev_tmp[ZMC::max_num_cin];  // provisional values of equilibrium level index
+  for (Int n=0; n<num_cin; ++n) {
+    cape_tmp[n] = 0;
+    eql_klev_tmp[n] = pver-1;
+  }
+  eql_klev = pver-1;
+  cape = 0;
+
+  // Buoyancy from launch level to equilibrium level
+  for (Int k=0; k<pver; ++k) {
+    buoyancy(k) = 0;
+  }
+  for (Int k=pver-1; k>=num_msg; --k) {
+    if (k <= msemax_klev and lcl_ok) {
+      buoyancy(k) = parcel_vtemp(k) - tv(k) + runtime.tiedke_add;
+    } else {
+      parcel_qsat(k)  = sp_humidity(k);
+      parcel_temp(k)  = temperature(k);
+      parcel_vtemp(k) = tv(k);
+    }
+  }
+
+  // Find the convective equilibrium level accounting for negative buoyancy levels
+  Int neg_buoyancy_cnt = 0;
+  for (Int k=num_msg+1; k<pver; ++k) {
+    if (k < lcl_klev and lcl_ok and buoyancy(k+1) > 0 and buoyancy(k) <= 0) {
+      neg_buoyancy_cnt = Kokkos::min(num_cin, neg_buoyancy_cnt+1);
+      eql_klev_tmp[neg_buoyancy_cnt-1] = k;
+    }
+  }
+
+  // Integrate buoyancy to obtain the possible CAPE values
+  for (Int n=0; n<num_cin; ++n) {
+    for (Int k=num_msg; k<pver; ++k) {
+      if (lcl_ok and k <= msemax_klev and k > eql_klev_tmp[n]) {
+        cape_tmp[n] += C::Rair*buoyancy(k)*Kokkos::log(pint(k+1)/pint(k));
+      }
+    }
+  }
+
+  // Use the max of the tentative CAPE values, and ensure it is positive
+  for (Int n=0; n<num_cin; ++n) {
+    if (cape_tmp[n] > cape) {
+      cape = cape_tmp[n];
+      eql_klev = eql_klev_tmp[n];
+    }
+  }
+  cape = Kokkos::max(cape, Scalar(0));
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
@@ -0,0 +1,166 @@
+#ifndef ZM_COMPUTE_DILUTE_PARCEL_IMPL_HPP
+#define ZM_COMPUTE_DILUTE_PARCEL_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm compute_dilute_parcel. Clients should NOT
+ * #include this file, but include zm_functions.hpp instead.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+bool Functions<S,D>::compute_dilute_parcel(
+  // Inputs
+  const Int& pver,
+  const Int& num_msg,
+  const Int& klaunch,
+  const uview_1d<const Scalar>& pmid,
+  const uview_1d<const Scalar>& temperature,
+  const uview_1d<const Scalar>& sp_humidity,
+  const Scalar& tpert,
+  const Int& pblt,
+  const ZMRuntime& runtime,
+  // Work arrays
+  const uview_1d<Scalar>& tmix,
+  const uview_1d<Scalar>& qtmix,
+  const uview_1d<Scalar>& qsmix,
+  const uview_1d<Scalar>& smix,
+  const uview_1d<Scalar>& xsh2o,
+  const uview_1d<Scalar>& ds_xsh2o,
+  const uview_1d<Scalar>& ds_freeze,
+  // Inputs/Outputs
+  const uview_1d<Scalar>& parcel_temp,
+  const uview_1d<Scalar>& parcel_vtemp,
+  const uview_1d<Scalar>& parcel_qsat,
+  Scalar& lcl_pmid,
+  Scalar& lcl_temperature,
+  Int& lcl_klev)
+{
+  const Scalar zvir = C::RH2O/C::Rair - 1;
+
+  // Super cooled temperature offset from freezing temperature when cloud water loading freezes
+  constexpr Scalar tscool = 0;
+
+  bool converged = true;
+
+  for (Int k=0; k<pver; ++k) {
+    tmix(k)      = 0;
+    qtmix(k)     = 0;
+    qsmix(k)     = 0;
+    smix(k)      = 0;
+    xsh2o(k)     = 0;
+    ds_xsh2o(k)  = 0;
+    ds_freeze(k) = 0;
+  }
+
+  // If the launch level is above the PBL top, the PBL temperature perturbation
+  // should not be able to influence the parcel
+  const Scalar tpert_loc = (runtime.tpert_fix and klaunch<pblt) ? 0 : tpert;
+
+  // Entrainment loop
+  Scalar mp0 = 0, qtp0 = 0, sp0 = 0;   // parcel launch relative mass, total water, and entropy
+  Scalar mp  = 0, qtp  = 0, sp  = 0;   // entrained parcel mass, total water, and entropy
+  for (Int k=pver-1; k>=num_msg; --k) {
+    if (k == klaunch) {
+      // Initialize values at launch level
+      mp0      = 1;               // value of 1.0 does not change for undilute (dmpdp=0)
+      qtp0     = sp_humidity(k);  // assuming subsaturated
+      sp0      = entropy(temperature(k), pmid(k), qtp0);
+      smix(k)  = sp0;
+      qtmix(k) = qtp0;
+      converged &= ientropy(smix(k), pmid(k), qtmix(k), temperature(k), tmix(k), qsmix(k));
+    } else if (k < klaunch) {
+      // Environmental values for this level
+      const Scalar dp    = pmid(k) - pmid(k+1);
+      const Scalar qtenv = 0.5*(sp_humidity(k)+sp_humidity(k+1));
+      const Scalar tenv  = 0.5*(temperature(k)+temperature(k+1));
+      const Scalar penv  = 0.5*(pmid(k)+pmid(k+1));
+      const Scalar senv  = entropy(tenv, penv, qtenv);
+
+      // Fractional entrainment rate [1/mb], given the value in [1/m]
+      const Scalar dpdz  = -(penv*C::gravit)/(C::Rair*tenv);  // [mb/m]
+      const Scalar dzdp  = 1/dpdz;                            // [m/mb]
+      const Scalar dmpdp = runtime.dmpdz*dzdp;
+
+      // Sum entrainment to current level, assuming linear variation over the layer
+      sp  -= dmpdp*dp*senv;
+      qtp -= dmpdp*dp*qtenv;
+      mp  -= dmpdp*dp;
+
+      // Entrain s and qt to next level
+      smix(k)  = (sp0  + sp ) / (mp0 + mp);
+      qtmix(k) = (qtp0 + qtp) / (mp0 + mp);
+
+      // Invert entropy to get T and saturation-capped q of the mixture
+      converged &= ientropy(smix(k), pmid(k), qtmix(k), tmix(k+1), tmix(k), qsmix(k));
+
+      // We are at the LCL if this is the first level where qsmix<=qtmix on ascending
+      if (qsmix(k)<=qtmix(k) and qsmix(k+1)>qtmix(k+1)) {
+        lcl_klev = k;
+        const Scalar qxsk   = qtmix(k) - qsmix(k);
+        const Scalar qxskp1 = qtmix(k+1) - qsmix(k+1);
+        const Scalar dqxsdp = (qxsk - qxskp1)/dp;
+        lcl_pmid = pmid(k+1) - qxskp1/dqxsdp;
+        const Scalar dsdp   = (smix(k)  - smix(k+1))/dp;
+        const Scalar dqtdp  = (qtmix(k) - qtmix(k+1))/dp;
+        const Scalar slcl   = smix(k+1)  + dsdp* (lcl_pmid-pmid(k+1));
+        const Scalar qtlcl  = qtmix(k+1) + dqtdp*(lcl_pmid-pmid(k+1));
+        Scalar qslcl;
+        converged &= ientropy(slcl, lcl_pmid, qtlcl, tmix(k), lcl_temperature, qslcl);
+      }
+    }
+  }
+
+  // Adjust the entropy and total water of the parcel so that the water held in vapor
+  // is <=qsmix. The cloud holds up to lwmax of condensate, and the rest rains out
+  // (xsh2o), which provides latent heating to the parcel.
+  for (Int k=pver-1; k>=num_msg; --k) {
+    if (k == klaunch) {
+      // Assume no liquid water at launch level
+      parcel_temp(k)  = tmix(k);
+      parcel_qsat(k)  = sp_humidity(k);
+      parcel_vtemp(k) = (parcel_temp(k) + runtime.tpert_fac*tpert_loc)
+                        * (1+zvir*parcel_qsat(k)) / (1+parcel_qsat(k));
+    } else if (k < klaunch) {
+      Scalar new_q = 0;
+      for (Int ii=0; ii<ZMC::nit_lheat; ++ii) {
+        // Rain is the excess condensate, bar lwmax
+        xsh2o(k) = Kokkos::max(Scalar(0), qtmix(k) - qsmix(k) - ZMC::lwmax);
+
+        // Contribution to ds from precip loss of condensate
+        ds_xsh2o(k) = ds_xsh2o(k+1) - C::CpLiq*Kokkos::log(tmix(k)/C::Tmelt)
+                                      * Kokkos::max(Scalar(0), xsh2o(k)-xsh2o(k+1));
+
+        // Entropy of freezing: one off freezing of condensate, then continual freezing
+        if (tmix(k) <= C::Tmelt+tscool and ds_freeze(k+1) == 0) {
+          ds_freeze(k) = (C::LatIce/tmix(k)) * Kokkos::max(Scalar(0), qtmix(k)-qsmix(k)-xsh2o(k));
+        }
+        if (tmix(k) <= C::Tmelt+tscool and ds_freeze(k+1) != 0) {
+          ds_freeze(k) = ds_freeze(k+1) + (C::LatIce/tmix(k)) * Kokkos::max(Scalar(0), qsmix(k+1)-qsmix(k));
+        }
+
+        // Adjust entropy and total water, and invert entropy to update tmix and qsmix
+        const Scalar new_s = smix(k) + ds_xsh2o(k) + ds_freeze(k);
+        new_q = qtmix(k) - xsh2o(k);
+        converged &= ientropy(new_s, pmid(k), new_q, tmix(k), tmix(k), qsmix(k));
+      }
+
+      // Parcel virtual temp is the density temp with new_q total water
+      parcel_temp(k) = tmix(k);
+      parcel_qsat(k) = new_q > qsmix(k) ? qsmix(k) : new_q;
+      parcel_vtemp(k) = (parcel_temp(k) + runtime.tpert_fac*tpert_loc)
+                        * (1+zvir*parcel_qsat(k)) / (1+new_q);
+    }
+  }
+
+  return converged;
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
@@ -0,0 +1,161 @@
+#ifndef ZM_ENTROPY_IMPL_HPP
+#define ZM_ENTROPY_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm entropy, ientropy, and the saturation functions they use.
+ * Clients should NOT #include this file, but include zm_functions.hpp instead.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Scalar
+Functions<S,D>::goff_gratch_svp_water(const Scalar& t)
+{
+  // Same formula as GoffGratch_svp_water in wv_sat_methods (uncertain below -70 C)
+  const Scalar tboil = ZMC::Tboil;
+  return Kokkos::pow(Scalar(10),
+                     -7.90298*(tboil/t-1) +
+                      5.02808*Kokkos::log10(tboil/t) -
+                      1.3816e-7*(Kokkos::pow(Scalar(10),11.344*(1-t/tboil))-1) +
+                      8.1328e-3*(Kokkos::pow(Scalar(10),-3.49149*(tboil/t-1))-1) +
+                      Kokkos::log10(Scalar(1013.246)))*100;
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::qsat_hPa(const Scalar& t, const Scalar& p, Scalar& es, Scalar& qs)
+{
+  // The saturation functions work in Pa
+  const Scalar p_pa = p*100;
+  const Scalar es_pa = goff_gratch_svp_water(t);
+
+  // If pressure is less than SVP, set qs to its max value of 1
+  if (p_pa - es_pa <= 0) {
+    qs = 1;
+  } else {
+    qs = C::ep_2*es_pa / (p_pa - (1-C::ep_2)*es_pa);
+  }
+
+  // Ensure es is consistent with the limiter on qs
+  es = Kokkos::min(es_pa,p_pa)*0.01;
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+typename Functions<S,D>::Scalar
+Functions<S,D>::entropy(const Scalar& tk, const Scalar& p, const Scalar& qtot)
+{
+  constexpr Scalar pref = 1000;
+
+  // Latent heat of vaporization, with T converted to centigrade
+  const Scalar L = C::LatVap - (C::CpLiq - ZMC::Cpwv)*(tk-C::Tmelt);
+
+  // Use the saturation mixing ratio to partition qtot into vapor part only
+  Scalar est, qst;
+  qsat_hPa(tk, p, est, qst);
+  const Scalar qv = Kokkos::min(qtot,qst);
+  const Scalar e  = qv*p / (C::ep_2+qv);
+
+  // Entropy per unit mass of dry air - Eq. 1
+  return (C::Cpair + qtot*C::CpLiq)*Kokkos::log(tk/C::Tmelt)
+         - C::Rair*Kokkos::log((p-e)/pref)
+         + L*qv/tk - qv*C::RH2O*Kokkos::log(qv/qst);
+}
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+bool Functions<S,D>::ientropy(const Scalar& s, const Scalar& p, const Scalar& qt, const Scalar& tfg,
+                              Scalar& t, Scalar& qst)
+{
+  constexpr Int    loopmax   = 100;     // max number of iterations
+  constexpr Scalar tol_coeff = 0.001;   // tolerance coefficient
+  constexpr Scalar tol_eps   = 3.e-8;   // small value for tolerance calculation
+
+  Scalar a = tfg-10;  // low bracket
+  Scalar b = tfg+10;  // high bracket
+  Scalar fa = entropy(a, p, qt) - s;
+  Scalar fb = entropy(b, p, qt) - s;
+  Scalar c = b;
+  Scalar fc = fb;
+  Scalar d = b-a;
+  Scalar ebr = d;
+
+  bool converged = false;
+  for (Int i=0; i<=loopmax; ++i) {
+    if ((fb>0 and fc>0) or (fb<0 and fc<0)) {
+      c   = a;
+      d   = b-a;
+      fc  = fa;
+      ebr = d;
+    }
+    if (Kokkos::abs(fc) < Kokkos::abs(fb)) {
+      a  = b;
+      b  = c;
+      c  = a;
+      fa = fb;
+      fb = fc;
+      fc = fa;
+    }
+
+    const Scalar tolerance = 2*tol_eps*Kokkos::abs(b) + 0.5*tol_coeff;
+    const Scalar xm = 0.5*(c-b);
+
+    converged = (Kokkos::abs(xm) <= tolerance or fb == 0);
+    if (converged) {
+      break;
+    }
+
+    if (Kokkos::abs(ebr) >= tolerance and Kokkos::abs(fa) > Kokkos::abs(fb)) {
+      const Scalar sbr = fb/fa;
+      Scalar pbr, qbr;
+      if (a == c) {
+        pbr = 2*xm*sbr;
+        qbr = 1-sbr;
+      } else {
+        qbr = fa/fc;
+        const Scalar rbr = fb/fc;
+        pbr = sbr*(2*xm*qbr*(qbr-rbr)-(b-a)*(rbr-1));
+        qbr = (qbr-1)*(rbr-1)*(sbr-1);
+      }
+      if (pbr > 0) {
+        qbr = -qbr;
+      }
+      pbr = Kokkos::abs(pbr);
+      if (2*pbr < Kokkos::min(3*xm*qbr-Kokkos::abs(tolerance*qbr), Kokkos::abs(ebr*qbr))) {
+        ebr = d;
+        d = pbr/qbr;
+      } else {
+        d = xm;
+        ebr = d;
+      }
+    } else {
+      d = xm;
+      ebr = d;
+    }
+    a  = b;
+    fa = fb;
+    if (Kokkos::abs(d) > tolerance) {
+      b += d;
+    } else {
+      b += xm>=0 ? tolerance : -tolerance;
+    }
+
+    fb = entropy(b, p, qt) - s;
+  }
+
+  t = b;
+  Scalar est;
+  qsat_hPa(t, p, est, qst);
+
+  return converged;
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
@@ -0,0 +1,53 @@
+#ifndef ZM_FIND_MSE_MAX_IMPL_HPP
+#define ZM_FIND_MSE_MAX_IMPL_HPP
+
+#include "zm_functions.hpp" // for ETI only but harmless for GPU
+
+namespace scream {
+namespace zm {
+
+/*
+ * Implementation of zm find_mse_max. Clients should NOT
+ * #include this file, but include zm_functions.hpp instead.
+ */
+
+template<typename S, typename D>
+KOKKOS_FUNCTION
+void Functions<S,D>::find_mse_max(
+  // Inputs
+  const Int& pver,
+  const Int& num_msg,
+  const Int& msemax_top_k,
+  const bool& pergro_active,
+  const ZMRuntime& runtime,
+  const uview_1d<const Scalar>& temperature,
+  const uview_1d<const Scalar>& zmid,
+  const uview_1d<const Scalar>& sp_humidity,
+  // Inputs/Outputs
+  Int& msemax_klev,
+  Scalar& mse_max_val)
+{
+  // Lower limit to search for the launch level with max MSE
+  const Int bot_layer = pver - 1 - runtime.mx_bot_lyr_adj;
+
+  mse_max_val = 0;
+  for (Int k=bot_layer; k>=num_msg; --k) {
+    const Scalar mse_env = C::Cpair*temperature(k) + C::gravit*zmid(k) + C::LatVap*sp_humidity(k);
+    if (pergro_active) {
+      // Reset max moist static energy level when relative difference exceeds 1.e-4
+      const Scalar pergro_rhd = (mse_env - mse_max_val)/(mse_env + mse_max_val);
+      if (k >= msemax_top_k and pergro_rhd > ZMC::pergro_rhd_threshold) {
+        mse_max_val = mse_env;
+        msemax_klev = k;
+      }
+    } else if (k >= msemax_top_k and mse_env > mse_max_val) {
+      mse_max_val = mse_env;
+      msemax_klev = k;
+    }
+  }
+}
+
+} // namespace zm
+} // namespace scream
+
+#endif
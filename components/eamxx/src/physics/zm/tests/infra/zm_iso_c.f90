@@ -9,10 +9,25 @@ module zm_iso_c
 # define c_real c_float
 #endif
 
+  logical, save :: wv_sat_initialized = .false.
+
 !===================================================================================================
 contains
 !===================================================================================================
 
+subroutine zm_test_wv_sat_init()
+  use zm_eamxx_bridge_wv_saturation, only: wv_sat_init
+  !-----------------------------------------------------------------------------
+  ! The saturation functions used by entropy/ientropy need the SVP table and
+  ! constants, which can only be set up once
+  if (.not. wv_sat_initialized) then
+    call wv_sat_init()
+    wv_sat_initialized = .true.
+  end if
+end subroutine zm_test_wv_sat_init
+
+!===================================================================================================
+
 subroutine zm_find_mse_max_c( pcols, ncol, pver, num_msg, msemax_top_k, pergro_active, temperature, zmid, sp_humidity, msemax_klev, mse_max_val ) bind(C)
   use zm_conv_cape,   only: find_mse_max
   use zm_conv_types,  only: zm_const_t, zm_param_t
@@ -46,4 +61,121 @@ end subroutine zm_find_mse_max_c
 
 !===================================================================================================
 
+subroutine zm_entropy_c( num, tk, p, qtot, tfg, s, t, qst ) bind(C)
+  use zm_conv_util,   only: entropy, ientropy
+  use zm_conv_types,  only: zm_const_t, zm_const_set_for_testing
+  !-----------------------------------------------------------------------------
+  ! Interface Arguments
+  integer(kind=c_int), value,             intent(in) :: num   ! number of samples
+  real(kind=c_real),   dimension(num),    intent(in) :: tk    ! temperature                       [K]
+  real(kind=c_real),   dimension(num),    intent(in) :: p     ! pressure                          [mb]
+  real(kind=c_real),   dimension(num),    intent(in) :: qtot  ! total water mixing ratio          [kg/kg]
+  real(kind=c_real),   dimension(num),    intent(in) :: tfg   ! first guess for the inversion     [K]
+  real(kind=c_real),   dimension(num),    intent(out):: s     ! entropy of (tk,p,qtot)            [J/kg]
+  real(kind=c_real),   dimension(num),    intent(out):: t     ! temperature from inverting s      [K]
+  real(kind=c_real),   dimension(num),    intent(out):: qst   ! saturation mixing ratio at t      [kg/kg]
+  !-----------------------------------------------------------------------------
+  ! Local Variables
+  type(zm_const_t) :: zm_const ! derived type to hold ZM constants
+  integer :: i
+  !-----------------------------------------------------------------------------
+  call zm_const_set_for_testing(zm_const)
+  call zm_test_wv_sat_init()
+  !-----------------------------------------------------------------------------
+  do i = 1,num
+    s(i) = entropy( tk(i), p(i), qtot(i), zm_const )
+    call ientropy( 1, s(i), p(i), qtot(i), t(i), qst(i), tfg(i), zm_const )
+  end do
+  !-----------------------------------------------------------------------------
+end subroutine zm_entropy_c
+
+!===================================================================================================
+
+subroutine zm_compute_dilute_parcel_c( pcols, ncol, pver, num_msg, klaunch, pmid, temperature, sp_humidity, tpert, pblt, &
+                                       parcel_temp, parcel_vtemp, parcel_qsat, lcl_pmid, lcl_temperature, lcl_klev ) bind(C)
+  use zm_conv_cape,   only: compute_dilute_parcel
+  use zm_conv_types,  only: zm_const_t, zm_param_t
+  use zm_conv_types,  only: zm_param_set_for_testing, zm_const_set_for_testing
+  !-----------------------------------------------------------------------------
+  ! Interface Arguments
+  integer(kind=c_int), value,                 intent(in)   :: pcols           ! number of atmospheric columns (max)
+  integer(kind=c_int), value,                 intent(in)   :: ncol            ! number of atmospheric columns (actual)
+  integer(kind=c_int), value,                 intent(in)   :: pver            ! number of mid-point vertical levels
+  integer(kind=c_int), value,                 intent(in)   :: num_msg         ! number of missing moisture levels at the top of model
+  integer(kind=c_int), dimension(pcols),      intent(in)   :: klaunch         ! index of parcel launch level based on max MSE
+  real(kind=c_real),   dimension(pcols,pver), intent(in)   :: pmid            ! ambient env pressure at cell center
+  real(kind=c_real),   dimension(pcols,pver), intent(in)   :: temperature     ! ambient env temperature at cell center
+  real(kind=c_real),   dimension(pcols,pver), intent(in)   :: sp_humidity     ! ambient env specific humidity at cell center
+  real(kind=c_real),   dimension(pcols),      intent(in)   :: tpert           ! PBL temperature perturbation
+  integer(kind=c_int), dimension(pcols),      intent(in)   :: pblt            ! index of pbl depth
+  real(kind=c_real),   dimension(pcols,pver), intent(inout):: parcel_temp     ! Parcel temperature
+  real(kind=c_real),   dimension(pcols,pver), intent(inout):: parcel_vtemp    ! Parcel virtual temperature
+  real(kind=c_real),   dimension(pcols,pver), intent(inout):: parcel_qsat     ! Parcel water vapour (sat value above lcl)
+  real(kind=c_real),   dimension(pcols),      intent(inout):: lcl_pmid        ! lifting condensation level (LCL) pressure
+  real(kind=c_real),   dimension(pcols),      intent(inout):: lcl_temperature ! lifting condensation level (LCL) temperature
+  integer(kind=c_int), dimension(pcols),      intent(inout):: lcl_klev        ! lifting condensation level (LCL) vertical index
+  !-----------------------------------------------------------------------------
+  ! Local Variables
+  type(zm_const_t) :: zm_const ! derived type to hold ZM constants
+  type(zm_param_t) :: zm_param ! derived type to hold ZM tunable parameters
+  !-----------------------------------------------------------------------------
+  call zm_param_set_for_testing(zm_param)
+  call zm_const_set_for_testing(zm_const)
+  call zm_test_wv_sat_init()
+  !-----------------------------------------------------------------------------
+  call compute_dilute_parcel( pcols, ncol, pver, num_msg, klaunch, &
+                              pmid, temperature, sp_humidity, tpert, pblt, &
+                              zm_const, zm_param, &
+                              parcel_temp, parcel_vtemp, parcel_qsat, &
+                              lcl_pmid, lcl_temperature, lcl_klev )
+  !-----------------------------------------------------------------------------
+end subroutine zm_compute_dilute_parcel_c
+
+!===================================================================================================
+
+subroutine zm_compute_cape_from_parcel_c( pcols, ncol, pver, num_cin, num_msg, temperature, tv, zmid, sp_humidity, pint, &
+                                          msemax_klev, lcl_pmid, lcl_klev, parcel_qsat, parcel_temp, parcel_vtemp, &
+                                          eql_klev, cape ) bind(C)
+  use zm_conv_cape,   only: compute_cape_from_parcel
+  use zm_conv_types,  only: zm_const_t, zm_param_t
+  use zm_conv_types,  only: zm_param_set_for_testing, zm_const_set_for_testing
+  !-----------------------------------------------------------------------------
+  ! Interface Arguments
+  integer(kind=c_int), value,                   intent(in)   :: pcols        ! number of atmospheric columns (max)
+  integer(kind=c_int), value,                   intent(in)   :: ncol         ! number of atmospheric columns (actual)
+  integer(kind=c_int), value,                   intent(in)   :: pver         ! number of mid-point vertical levels
+  integer(kind=c_int), value,                   intent(in)   :: num_cin      ! num of negative buoyancy regions allowed before the conv. top
+  integer(kind=c_int), value,                   intent(in)   :: num_msg      ! number of missing moisture levels at the top of model
+  real(kind=c_real),   dimension(pcols,pver),   intent(in)   :: temperature  ! temperature
+  real(kind=c_real),   dimension(pcols,pver),   intent(in)   :: tv           ! virtual temperature
+  real(kind=c_real),   dimension(pcols,pver),   intent(in)   :: zmid         ! height/altitude at mid-levels
+  real(kind=c_real),   dimension(pcols,pver),   intent(in)   :: sp_humidity  ! specific humidity
+  real(kind=c_real),   dimension(pcols,pver+1), intent(in)   :: pint         ! pressure at interfaces
+  integer(kind=c_int), dimension(pcols),        intent(in)   :: msemax_klev  ! index of max MSE at parcel launch level
+  real(kind=c_real),   dimension(pcols),        intent(in)   :: lcl_pmid     ! lifting condensation level (LCL) pressure
+  integer(kind=c_int), dimension(pcols),        intent(in)   :: lcl_klev     ! lifting condensation level (LCL) index
+  real(kind=c_real),   dimension(pcols,pver),   intent(inout):: parcel_qsat  ! parcel saturation mixing ratio
+  real(kind=c_real),   dimension(pcols,pver),   intent(inout):: parcel_temp  ! parcel temperature
+  real(kind=c_real),   dimension(pcols,pver),   intent(inout):: parcel_vtemp ! parcel virtual temperature
+  integer(kind=c_int), dimension(pcols),        intent(inout):: eql_klev     ! index of equilibrium level (i.e. cloud top)
+  real(kind=c_real),   dimension(pcols),        intent(inout):: cape         ! convective available potential energy
+  !-----------------------------------------------------------------------------
+  ! Local Variables
+  type(zm_const_t) :: zm_const ! derived type to hold ZM constants
+  type(zm_param_t) :: zm_param ! derived type to hold ZM tunable parameters
+  !-----------------------------------------------------------------------------
+  call zm_param_set_for_testing(zm_param)
+  call zm_const_set_for_testing(zm_const)
+  !-----------------------------------------------------------------------------
+  call compute_cape_from_parcel( pcols, ncol, pver, pver+1, num_cin, num_msg, &
+                                 temperature, tv, zmid, sp_humidity, pint, &
+                                 msemax_klev, lcl_pmid, lcl_klev, &
+                                 zm_const, zm_param, &
+                                 parcel_qsat, parcel_temp, parcel_vtemp, &
+                                 eql_klev, cape )
+  !-----------------------------------------------------------------------------
+end subroutine zm_compute_cape_from_parcel_c
+
+!===================================================================================================
+
 end module zm_iso_c
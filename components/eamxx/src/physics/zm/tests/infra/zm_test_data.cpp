@@ -31,6 +31,51 @@ extern "C" {
                           Int *msemax_klev,
                           Real *mse_max_val );
 
+  void zm_entropy_c( Int  num,
+                     Real *tk,
+                     Real *p,
+                     Real *qtot,
+                     Real *tfg,
+                     Real *s,
+                     Real *t,
+                     Real *qst );
+
+  void zm_compute_dilute_parcel_c( Int  pcols,
+                                   Int  ncol,
+                                   Int  pver,
+                                   Int  num_msg,
+                                   Int  *klaunch,
+                                   Real *pmid,
+                                   Real *temperature,
+                                   Real *sp_humidity,
+                                   Real *tpert,
+                                   Int  *pblt,
+                                   Real *parcel_temp,
+                                   Real *parcel_vtemp,
+                                   Real *parcel_qsat,
+                                   Real *lcl_pmid,
+                                   Real *lcl_temperature,
+                                   Int  *lcl_klev );
+
+  void zm_compute_cape_from_parcel_c( Int  pcols,
+                                      Int  ncol,
+                                      Int  pver,
+                                      Int  num_cin,
+                                      Int  num_msg,
+                                      Real *temperature,
+                                      Real *tv,
+                                      Real *zmid,
+                                      Real *sp_humidity,
+                                      Real *pint,
+                                      Int  *msemax_klev,
+                                      Real *lcl_pmid,
+                                      Int  *lcl_klev,
+                                      Real *parcel_qsat,
+                                      Real *parcel_temp,
+                                      Real *parcel_vtemp,
+                                      Int  *eql_klev,
+                                      Real *cape );
+
 } // extern "C" : end _c decls
 
 void zm_find_mse_max(zm_data_find_mse_max& d){
@@ -49,6 +94,61 @@ void zm_find_mse_max(zm_data_find_mse_max& d){
   d.transpose<ekat::TransposeDirection::f2c>();
 }
 
+void zm_entropy(zm_data_entropy& d){
+  zm_entropy_c( d.num,
+                d.tk,
+                d.p,
+                d.qtot,
+                d.tfg,
+                d.s,
+                d.t,
+                d.qst );
+}
+
+void zm_compute_dilute_parcel(zm_data_compute_dilute_parcel& d){
+  d.transpose<ekat::TransposeDirection::c2f>();
+  zm_compute_dilute_parcel_c( d.pcols,
+                              d.ncol,
+                              d.pver,
+                              d.num_msg,
+                              d.klaunch,
+                              d.pmid,
+                              d.temperature,
+                              d.sp_humidity,
+                              d.tpert,
+                              d.pblt,
+                              d.parcel_temp,
+                              d.parcel_vtemp,
+                              d.parcel_qsat,
+                              d.lcl_pmid,
+                              d.lcl_temperature,
+                              d.lcl_klev );
+  d.transpose<ekat::TransposeDirection::f2c>();
+}
+
+void zm_compute_cape_from_parcel(zm_data_compute_cape_from_parcel& d){
+  d.transpose<ekat::TransposeDirection::c2f>();
+  zm_compute_cape_from_parcel_c( d.pcols,
+                                 d.ncol,
+                                 d.pver,
+                                 d.num_cin,
+                                 d.num_msg,
+                                 d.temperature,
+                                 d.tv,
+                                 d.zmid,
+                                 d.sp_humidity,
+                                 d.pint,
+                                 d.msemax_klev,
+                                 d.lcl_pmid,
+                                 d.lcl_klev,
+                                 d.parcel_qsat,
+                                 d.parcel_temp,
+                                 d.parcel_vtemp,
+                                 d.eql_klev,
+                                 d.cape );
+  d.transpose<ekat::TransposeDirection::f2c>();
+}
+
 // end _c impls
 
 } // namespace zm
@@ -61,8 +61,146 @@ struct zm_data_find_mse_max : public PhysicsTestData {
 
 };
 
+struct zm_data_entropy : public PhysicsTestData {
+  // Inputs
+  Int  num;
+
+  Real *tk;
+  Real *p;
+  Real *qtot;
+  Real *tfg;
+
+  // Outputs
+  Real *s;     // entropy(tk,p,qtot)
+  Real *t;     // ientropy(s,p,qtot,tfg)
+  Real *qst;   // ientropy(s,p,qtot,tfg)
+
+  // Constructor
+  zm_data_entropy(Int num_)
+    : PhysicsTestData(
+        // dims: group by type and shape.
+        {
+          {num_}                     // (Real, 1D)
+        },
+        // reals: group pointers by shape, in order of appearance above
+        {
+          {&tk, &p, &qtot, &tfg, &s, &t, &qst} // (num)
+        }
+      ),
+      num(num_)
+  {}
+
+  PTD_STD_DEF(zm_data_entropy, 1, num);
+
+};
+
+struct zm_data_compute_dilute_parcel : public PhysicsTestData {
+  // Inputs
+  Int  pcols;
+  Int  ncol;
+  Int  pver;
+  Int  num_msg;
+
+  Int  *klaunch;
+  Real *pmid;
+  Real *temperature;
+  Real *sp_humidity;
+  Real *tpert;
+  Int  *pblt;
+
+  // Inputs/Outputs
+  Real *parcel_temp;
+  Real *parcel_vtemp;
+  Real *parcel_qsat;
+  Real *lcl_pmid;
+  Real *lcl_temperature;
+  Int  *lcl_klev;
+
+  // Constructor
+  zm_data_compute_dilute_parcel(Int pcols_, Int ncol_, Int pver_, Int num_msg_)
+    : PhysicsTestData(
+        // dims: group by type and shape.
+        {
+          {pcols_, pver_},           // (Real, 2D)
+          {pcols_},                  // (Real, 1D)
+          {pcols_}                   // (Int, 1D)
+        },
+        // reals: group pointers by shape, in order of appearance above
+        {
+          {&pmid, &temperature, &sp_humidity,
+           &parcel_temp, &parcel_vtemp, &parcel_qsat},  // (pcols, pver)
+          {&tpert, &lcl_pmid, &lcl_temperature}         // (pcols)
+        },
+        // ints: group pointers by shape, in order of appearance above
+        {
+          {&klaunch, &pblt, &lcl_klev}                  // (pcols)
+        }
+      ),
+      pcols(pcols_), ncol(ncol_), pver(pver_), num_msg(num_msg_)
+  {}
+
+  PTD_STD_DEF(zm_data_compute_dilute_parcel, 4, pcols, ncol, pver, num_msg);
+
+};
+
+struct zm_data_compute_cape_from_parcel : public PhysicsTestData {
+  // Inputs
+  Int  pcols;
+  Int  ncol;
+  Int  pver;
+  Int  num_cin;
+  Int  num_msg;
+
+  Real *temperature;
+  Real *tv;
+  Real *zmid;
+  Real *sp_humidity;
+  Real *pint;
+  Int  *msemax_klev;
+  Real *lcl_pmid;
+  Int  *lcl_klev;
+
+  // Inputs/Outputs
+  Real *parcel_qsat;
+  Real *parcel_temp;
+  Real *parcel_vtemp;
+  Int  *eql_klev;
+  Real *cape;
+
+  // Constructor
+  zm_data_compute_cape_from_parcel(Int pcols_, Int ncol_, Int pver_, Int num_cin_, Int num_msg_)
+    : PhysicsTestData(
+        // dims: group by type and shape.
+        {
+          {pcols_, pver_},           // (Real, 2D)
+          {pcols_, pver_+1},         // (Real, 2D)
+          {pcols_},                  // (Real, 1D)
+          {pcols_}                   // (Int, 1D)
+        },
+        // reals: group pointers by shape, in order of appearance above
+        {
+          {&temperature, &tv, &zmid, &sp_humidity,
+           &parcel_qsat, &parcel_temp, &parcel_vtemp},  // (pcols, pver)
+          {&pint},                                      // (pcols, pver+1)
+          {&lcl_pmid, &cape}                            // (pcols)
+        },
+        // ints: group pointers by shape, in order of appearance above
+        {
+          {&msemax_klev, &lcl_klev, &eql_klev}          // (pcols)
+        }
+      ),
+      pcols(pcols_), ncol(ncol_), pver(pver_), num_cin(num_cin_), num_msg(num_msg_)
+  {}
+
+  PTD_STD_DEF(zm_data_compute_cape_from_parcel, 5, pcols, ncol, pver, num_cin, num_msg);
+
+};
+
 // Glue functions to call fortran from from C++ with the Data struct
 void zm_find_mse_max(zm_data_find_mse_max& d);
+void zm_entropy(zm_data_entropy& d);
+void zm_compute_dilute_parcel(zm_data_compute_dilute_parcel& d);
+void zm_compute_cape_from_parcel(zm_data_compute_cape_from_parcel& d);
 
 extern "C" { // _f function decls
 }
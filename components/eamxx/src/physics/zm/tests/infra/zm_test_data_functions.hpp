@@ -4,7 +4,9 @@
 #include "physics/share/physics_test_data.hpp"
 #include "share/eamxx_types.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <utility>
 #include <memory>   // for shared_ptr
 
@@ -36,6 +38,42 @@ void zm_test_data_generate_profile( Engine& engine, Int pver, Int ncol, Real *zm
   }
 }
 
+// Generate a moist, conditionally unstable sounding on pressure levels, suitable for
+// lifting a parcel. Pressures are in mb, pint has pver+1 entries per column, and the
+// specific humidity stays positive and subsaturated at every level.
+template <typename Engine>
+void zm_test_data_generate_sounding( Engine& engine, Int pver, Int ncol,
+                                     Real *pint, Real *pmid, Real *zmid, Real *temperature, Real *sp_humidity )
+{
+  constexpr Real ptop  = 50;     // model top pressure [mb]
+  constexpr Real scale = 7500;   // pressure scale height [m]
+  constexpr Real tmin  = 200;    // temperature floor, i.e. the tropopause [K]
+
+  std::uniform_real_distribution<Real> surface_p(980, 1020);
+  std::uniform_real_distribution<Real> surface_t(295, 305);
+  std::uniform_real_distribution<Real> surface_q(8e-3, 12e-3);
+  std::uniform_real_distribution<Real> lapse_rate_t(6e-3, 7.5e-3);
+
+  std::uniform_real_distribution<Real> perturb_t(-0.1, 0.1);
+
+  for (auto i = decltype(ncol){0}; i < ncol; ++i) {
+    const Real psfc  = surface_p(engine);
+    const Real tsfc  = surface_t(engine);
+    const Real qsfc  = surface_q(engine);
+    const Real lapse = lapse_rate_t(engine);
+    for (auto k = decltype(pver){0}; k <= pver; ++k) {
+      pint[(pver+1)*i+k] = ptop + (psfc-ptop)*k/pver;
+    }
+    for (auto k = decltype(pver){0}; k < pver; ++k) {
+      const int index = pver*i+k;
+      pmid       [index] = 0.5*(pint[(pver+1)*i+k] + pint[(pver+1)*i+k+1]);
+      zmid       [index] = scale*std::log(psfc/pmid[index]);
+      temperature[index] = std::max(tsfc - lapse*zmid[index] + perturb_t(engine), tmin);
+      sp_humidity[index] = qsfc*std::pow(pmid[index]/psfc, 3);
+    }
+  }
+}
+
 }  // namespace zm
 }  // namespace scream
 
@@ -65,6 +65,9 @@ struct UnitWrap {
 
     // Put struct decls here
     struct Test_zm_find_mse_max;
+    struct Test_zm_entropy;
+    struct Test_zm_compute_dilute_parcel;
+    struct Test_zm_compute_cape_from_parcel;
     
   }; // UnitWrap
 };
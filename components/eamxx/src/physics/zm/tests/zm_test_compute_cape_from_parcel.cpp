@@ -0,0 +1,212 @@
+#include "catch2/catch.hpp"
+
+#include "share/eamxx_types.hpp"
+#include "ekat/ekat_pack.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/kokkos/ekat_subview_utils.hpp"
+#include "physics/zm/zm_functions.hpp"
+#include "physics/zm/tests/infra/zm_test_data.hpp"
+#include "physics/zm/tests/infra/zm_test_data_functions.hpp"
+
+#include "zm_unit_tests_common.hpp"
+
+#include <vector>
+
+namespace scream {
+namespace zm {
+namespace unit_test {
+
+template <typename D>
+struct UnitWrap::UnitTest<D>::Test_zm_compute_cape_from_parcel : public UnitWrap::UnitTest<D>::Base {
+
+  // Run the C++ compute_cape_from_parcel on the inputs of d, and check that it matches
+  // the (Fortran) outputs stored in d. Fortran level indices are 1-based. The
+  // inputs of d are the ones before the Fortran call, since they are inout.
+  void compare_cxx(const zm_data_compute_cape_from_parcel& d_in, const zm_data_compute_cape_from_parcel& d)
+  {
+    const Int ncol    = d.ncol;
+    const Int pver    = d.pver;
+    const Int num_msg = d.num_msg;
+    typename Functions::ZMRuntime runtime;
+    runtime.num_cin = d.num_cin;
+
+    view_2d<Real> temperature("temperature",ncol,pver), tv("tv",ncol,pver), sp_humidity("sp_humidity",ncol,pver);
+    view_2d<Real> pint("pint",ncol,pver+1), buoyancy("buoyancy",ncol,pver);
+    view_2d<Real> parcel_qsat("parcel_qsat",ncol,pver), parcel_temp("parcel_temp",ncol,pver),
+                  parcel_vtemp("parcel_vtemp",ncol,pver);
+    view_1d<Real> lcl_pmid("lcl_pmid",ncol), cape("cape",ncol);
+    view_1d<Int>  msemax_klev("msemax_klev",ncol), lcl_klev("lcl_klev",ncol), eql_klev("eql_klev",ncol);
+
+    auto temperature_h  = Kokkos::create_mirror_view(temperature);
+    auto tv_h           = Kokkos::create_mirror_view(tv);
+    auto sp_humidity_h  = Kokkos::create_mirror_view(sp_humidity);
+    auto pint_h         = Kokkos::create_mirror_view(pint);
+    auto parcel_qsat_h  = Kokkos::create_mirror_view(parcel_qsat);
+    auto parcel_temp_h  = Kokkos::create_mirror_view(parcel_temp);
+    auto parcel_vtemp_h = Kokkos::create_mirror_view(parcel_vtemp);
+    auto lcl_pmid_h     = Kokkos::create_mirror_view(lcl_pmid);
+    auto msemax_klev_h  = Kokkos::create_mirror_view(msemax_klev);
+    auto lcl_klev_h     = Kokkos::create_mirror_view(lcl_klev);
+    for (Int i = 0; i < ncol; ++i) {
+      lcl_pmid_h(i)    = d_in.lcl_pmid[i];
+      msemax_klev_h(i) = d_in.msemax_klev[i]-1;
+      lcl_klev_h(i)    = d_in.lcl_klev[i]-1;
+      for (Int k = 0; k < pver; ++k) {
+        temperature_h(i,k)  = d_in.temperature[i*pver+k];
+        tv_h(i,k)           = d_in.tv[i*pver+k];
+        sp_humidity_h(i,k)  = d_in.sp_humidity[i*pver+k];
+        parcel_qsat_h(i,k)  = d_in.parcel_qsat[i*pver+k];
+        parcel_temp_h(i,k)  = d_in.parcel_temp[i*pver+k];
+        parcel_vtemp_h(i,k) = d_in.parcel_vtemp[i*pver+k];
+      }
+      for (Int k = 0; k <= pver; ++k) {
+        pint_h(i,k) = d_in.pint[i*(pver+1)+k];
+      }
+    }
+    Kokkos::deep_copy(temperature,temperature_h);
+    Kokkos::deep_copy(tv,tv_h);
+    Kokkos::deep_copy(sp_humidity,sp_humidity_h);
+    Kokkos::deep_copy(pint,pint_h);
+    Kokkos::deep_copy(parcel_qsat,parcel_qsat_h);
+    Kokkos::deep_copy(parcel_temp,parcel_temp_h);
+    Kokkos::deep_copy(parcel_vtemp,parcel_vtemp_h);
+    Kokkos::deep_copy(lcl_pmid,lcl_pmid_h);
+    Kokkos::deep_copy(msemax_klev,msemax_klev_h);
+    Kokkos::deep_copy(lcl_klev,lcl_klev_h);
+
+    Kokkos::parallel_for(RangePolicy(0,ncol), KOKKOS_LAMBDA(const Int i) {
+      Functions::compute_cape_from_parcel(
+        pver, num_msg, runtime,
+        ekat::subview(temperature,i), ekat::subview(tv,i), ekat::subview(sp_humidity,i), ekat::subview(pint,i),
+        msemax_klev(i), lcl_pmid(i), lcl_klev(i),
+        ekat::subview(buoyancy,i),
+        ekat::subview(parcel_qsat,i), ekat::subview(parcel_temp,i), ekat::subview(parcel_vtemp,i),
+        eql_klev(i), cape(i));
+    });
+
+    Kokkos::deep_copy(parcel_qsat_h,parcel_qsat);
+    Kokkos::deep_copy(parcel_temp_h,parcel_temp);
+    Kokkos::deep_copy(parcel_vtemp_h,parcel_vtemp);
+    auto eql_klev_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),eql_klev);
+    auto cape_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),cape);
+    for (Int i = 0; i < ncol; ++i) {
+      REQUIRE(eql_klev_h(i)+1 == d.eql_klev[i]);
+      if (SCREAM_BFB_TESTING) {
+        REQUIRE(cape_h(i) == d.cape[i]);
+      } else {
+        REQUIRE(cape_h(i) == Approx(d.cape[i]).epsilon(1e-4));
+      }
+      for (Int k = 0; k < pver; ++k) {
+        REQUIRE(parcel_qsat_h(i,k)  == d.parcel_qsat[i*pver+k]);
+        REQUIRE(parcel_temp_h(i,k)  == d.parcel_temp[i*pver+k]);
+        REQUIRE(parcel_vtemp_h(i,k) == d.parcel_vtemp[i*pver+k]);
+      }
+    }
+  }
+
+  void run_bfb()
+  {
+    auto engine = Base::get_engine();
+
+    // Set up baseline data
+    zm_data_compute_cape_from_parcel baseline_data[] = {
+      //                                pcols, ncol, pver, num_cin, num_msg
+      zm_data_compute_cape_from_parcel( 8,     1,    16,   1,       0 ),
+      zm_data_compute_cape_from_parcel( 8,     4,    32,   1,       1 ),
+      zm_data_compute_cape_from_parcel( 8,     8,    72,   3,       2 ),
+    };
+
+    static constexpr Int num_runs = sizeof(baseline_data) / sizeof(zm_data_compute_cape_from_parcel);
+
+    // Generate input data - baseline. The parcel is a perturbation of the environment
+    // whose sign changes with height, so that there are several negative buoyancy
+    // regions and num_cin matters. Level indices are Fortran 1-based.
+    std::uniform_real_distribution<Real> dist_buoyancy(-2, 3);
+    std::uniform_int_distribution<Int>   dist_msemax(0, 2);
+    std::uniform_int_distribution<Int>   dist_lcl(1, 6);
+    const Real zvir = Functions::C::RH2O/Functions::C::Rair - 1;
+    for (auto& d : baseline_data) {
+      std::vector<Real> pmid(d.pcols*d.pver);
+      zm_test_data_generate_sounding( engine, d.pver, d.ncol, d.pint, pmid.data(), d.zmid, d.temperature, d.sp_humidity );
+      for (Int i = 0; i < d.ncol; ++i) {
+        d.msemax_klev[i] = d.pver - dist_msemax(engine);
+        d.lcl_klev[i]    = d.msemax_klev[i] - dist_lcl(engine);
+        d.lcl_pmid[i]    = pmid[i*d.pver+d.lcl_klev[i]-1];
+        for (Int k = 0; k < d.pver; ++k) {
+          const Int  index = i*d.pver+k;
+          const Real q     = d.sp_humidity[index];
+          d.tv[index]           = d.temperature[index]*(1+zvir*q)/(1+q);
+          d.parcel_temp[index]  = d.temperature[index] + dist_buoyancy(engine);
+          d.parcel_qsat[index]  = q;
+          d.parcel_vtemp[index] = d.parcel_temp[index]*(1+zvir*q)/(1+q);
+        }
+      }
+    }
+
+    // Create copies of data for use by test
+    // (needs to happen before read calls so that inout data is in original state)
+    zm_data_compute_cape_from_parcel test_data[] = {
+      zm_data_compute_cape_from_parcel( baseline_data[0] ),
+      zm_data_compute_cape_from_parcel( baseline_data[1] ),
+      zm_data_compute_cape_from_parcel( baseline_data[2] ),
+    };
+    const zm_data_compute_cape_from_parcel input_data[] = {
+      zm_data_compute_cape_from_parcel( baseline_data[0] ),
+      zm_data_compute_cape_from_parcel( baseline_data[1] ),
+      zm_data_compute_cape_from_parcel( baseline_data[2] ),
+    };
+
+    // Read baseline data
+    if (this->m_baseline_action == COMPARE) {
+      for (auto& d : baseline_data) {
+        d.read(Base::m_ifile);
+      }
+    }
+
+    // Get data from test
+    for (auto& d : test_data) { zm_compute_cape_from_parcel(d); }
+
+    // Check the C++ implementation against the Fortran one
+    for (Int i = 0; i < num_runs; ++i) { compare_cxx(input_data[i], test_data[i]); }
+
+    // Verify BFB results, all data should be in C layout
+    if (SCREAM_BFB_TESTING && this->m_baseline_action == COMPARE) {
+      for (Int i = 0; i < num_runs; ++i) {
+        zm_data_compute_cape_from_parcel& d_baseline = baseline_data[i];
+        zm_data_compute_cape_from_parcel& d_test = test_data[i];
+        for (Int k = 0; k < d_baseline.total(d_baseline.parcel_temp); ++k) {
+          REQUIRE(d_baseline.parcel_qsat[k]  == d_test.parcel_qsat[k]);
+          REQUIRE(d_baseline.parcel_temp[k]  == d_test.parcel_temp[k]);
+          REQUIRE(d_baseline.parcel_vtemp[k] == d_test.parcel_vtemp[k]);
+        }
+        for (Int k = 0; k < d_baseline.total(d_baseline.cape); ++k) {
+          REQUIRE(d_baseline.eql_klev[k] == d_test.eql_klev[k]);
+          REQUIRE(d_baseline.cape[k]     == d_test.cape[k]);
+        }
+      }
+    }
+    else if (this->m_baseline_action == GENERATE) {
+      for (Int i = 0; i < num_runs; ++i) {
+        test_data[i].write(Base::m_ofile);
+      }
+    }
+
+  } // zm_compute_cape_from_parcel
+
+};
+
+} // namespace unit_test
+} // namespace zm
+} // namespace scream
+
+namespace {
+
+TEST_CASE("zm_compute_cape_from_parcel", "[zm]")
+{
+  using TestStruct = scream::zm::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::Test_zm_compute_cape_from_parcel;
+
+  TestStruct t;
+  t.run_bfb();
+}
+
+} // empty namespace
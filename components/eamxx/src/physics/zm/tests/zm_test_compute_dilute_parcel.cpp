@@ -0,0 +1,228 @@
+#include "catch2/catch.hpp"
+
+#include "share/eamxx_types.hpp"
+#include "ekat/ekat_pack.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/kokkos/ekat_subview_utils.hpp"
+#include "physics/zm/zm_functions.hpp"
+#include "physics/zm/tests/infra/zm_test_data.hpp"
+#include "physics/zm/tests/infra/zm_test_data_functions.hpp"
+
+#include "zm_unit_tests_common.hpp"
+
+#include <vector>
+
+namespace scream {
+namespace zm {
+namespace unit_test {
+
+template <typename D>
+struct UnitWrap::UnitTest<D>::Test_zm_compute_dilute_parcel : public UnitWrap::UnitTest<D>::Base {
+
+  // Run the C++ compute_dilute_parcel on the inputs of d, and check that it matches
+  // the (Fortran) outputs stored in d. Fortran level indices are 1-based. The
+  // inputs of d are the ones before the Fortran call, since they are inout.
+  void compare_cxx(const zm_data_compute_dilute_parcel& d_in, const zm_data_compute_dilute_parcel& d)
+  {
+    const Int ncol    = d.ncol;
+    const Int pver    = d.pver;
+    const Int num_msg = d.num_msg;
+    const typename Functions::ZMRuntime runtime;
+
+    view_2d<Real> pmid("pmid",ncol,pver), temperature("temperature",ncol,pver), sp_humidity("sp_humidity",ncol,pver);
+    view_2d<Real> parcel_temp("parcel_temp",ncol,pver), parcel_vtemp("parcel_vtemp",ncol,pver),
+                  parcel_qsat("parcel_qsat",ncol,pver);
+    view_1d<Real> tpert("tpert",ncol), lcl_pmid("lcl_pmid",ncol), lcl_temperature("lcl_temperature",ncol);
+    view_1d<Int>  klaunch("klaunch",ncol), pblt("pblt",ncol), lcl_klev("lcl_klev",ncol), converged("converged",ncol);
+
+    // Work arrays
+    std::vector<view_2d<Real>> work;
+    for (const auto& name : {"tmix","qtmix","qsmix","smix","xsh2o","ds_xsh2o","ds_freeze"}) {
+      work.emplace_back(name,ncol,pver);
+    }
+    const auto tmix = work[0], qtmix = work[1], qsmix = work[2], smix = work[3];
+    const auto xsh2o = work[4], ds_xsh2o = work[5], ds_freeze = work[6];
+
+    auto pmid_h            = Kokkos::create_mirror_view(pmid);
+    auto temperature_h     = Kokkos::create_mirror_view(temperature);
+    auto sp_humidity_h     = Kokkos::create_mirror_view(sp_humidity);
+    auto parcel_temp_h     = Kokkos::create_mirror_view(parcel_temp);
+    auto parcel_vtemp_h    = Kokkos::create_mirror_view(parcel_vtemp);
+    auto parcel_qsat_h     = Kokkos::create_mirror_view(parcel_qsat);
+    auto tpert_h           = Kokkos::create_mirror_view(tpert);
+    auto lcl_pmid_h        = Kokkos::create_mirror_view(lcl_pmid);
+    auto lcl_temperature_h = Kokkos::create_mirror_view(lcl_temperature);
+    auto klaunch_h         = Kokkos::create_mirror_view(klaunch);
+    auto pblt_h            = Kokkos::create_mirror_view(pblt);
+    auto lcl_klev_h        = Kokkos::create_mirror_view(lcl_klev);
+    for (Int i = 0; i < ncol; ++i) {
+      tpert_h(i)           = d_in.tpert[i];
+      lcl_pmid_h(i)        = d_in.lcl_pmid[i];
+      lcl_temperature_h(i) = d_in.lcl_temperature[i];
+      klaunch_h(i)         = d_in.klaunch[i]-1;
+      pblt_h(i)            = d_in.pblt[i]-1;
+      lcl_klev_h(i)        = d_in.lcl_klev[i]-1;
+      for (Int k = 0; k < pver; ++k) {
+        pmid_h(i,k)         = d_in.pmid[i*pver+k];
+        temperature_h(i,k)  = d_in.temperature[i*pver+k];
+        sp_humidity_h(i,k)  = d_in.sp_humidity[i*pver+k];
+        parcel_temp_h(i,k)  = d_in.parcel_temp[i*pver+k];
+        parcel_vtemp_h(i,k) = d_in.parcel_vtemp[i*pver+k];
+        parcel_qsat_h(i,k)  = d_in.parcel_qsat[i*pver+k];
+      }
+    }
+    Kokkos::deep_copy(pmid,pmid_h);
+    Kokkos::deep_copy(temperature,temperature_h);
+    Kokkos::deep_copy(sp_humidity,sp_humidity_h);
+    Kokkos::deep_copy(parcel_temp,parcel_temp_h);
+    Kokkos::deep_copy(parcel_vtemp,parcel_vtemp_h);
+    Kokkos::deep_copy(parcel_qsat,parcel_qsat_h);
+    Kokkos::deep_copy(tpert,tpert_h);
+    Kokkos::deep_copy(lcl_pmid,lcl_pmid_h);
+    Kokkos::deep_copy(lcl_temperature,lcl_temperature_h);
+    Kokkos::deep_copy(klaunch,klaunch_h);
+    Kokkos::deep_copy(pblt,pblt_h);
+    Kokkos::deep_copy(lcl_klev,lcl_klev_h);
+
+    Kokkos::parallel_for(RangePolicy(0,ncol), KOKKOS_LAMBDA(const Int i) {
+      converged(i) = Functions::compute_dilute_parcel(
+        pver, num_msg, klaunch(i),
+        ekat::subview(pmid,i), ekat::subview(temperature,i), ekat::subview(sp_humidity,i),
+        tpert(i), pblt(i), runtime,
+        ekat::subview(tmix,i), ekat::subview(qtmix,i), ekat::subview(qsmix,i), ekat::subview(smix,i),
+        ekat::subview(xsh2o,i), ekat::subview(ds_xsh2o,i), ekat::subview(ds_freeze,i),
+        ekat::subview(parcel_temp,i), ekat::subview(parcel_vtemp,i), ekat::subview(parcel_qsat,i),
+        lcl_pmid(i), lcl_temperature(i), lcl_klev(i));
+    });
+
+    Kokkos::deep_copy(parcel_temp_h,parcel_temp);
+    Kokkos::deep_copy(parcel_vtemp_h,parcel_vtemp);
+    Kokkos::deep_copy(parcel_qsat_h,parcel_qsat);
+    Kokkos::deep_copy(lcl_pmid_h,lcl_pmid);
+    Kokkos::deep_copy(lcl_temperature_h,lcl_temperature);
+    Kokkos::deep_copy(lcl_klev_h,lcl_klev);
+    auto converged_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),converged);
+
+    // The entropy inversions stop once the bracket is smaller than ~1e-3 K,
+    // so temperatures are compared with a margin rather than a relative tolerance
+    for (Int i = 0; i < ncol; ++i) {
+      REQUIRE(converged_h(i));
+      REQUIRE(lcl_klev_h(i)+1 == d.lcl_klev[i]);
+      REQUIRE(lcl_pmid_h(i)        == Approx(d.lcl_pmid[i]).epsilon(1e-3));
+      REQUIRE(lcl_temperature_h(i) == Approx(d.lcl_temperature[i]).margin(5e-2));
+      for (Int k = 0; k < pver; ++k) {
+        REQUIRE(parcel_temp_h(i,k)  == Approx(d.parcel_temp[i*pver+k]).margin(5e-2));
+        REQUIRE(parcel_vtemp_h(i,k) == Approx(d.parcel_vtemp[i*pver+k]).margin(5e-2));
+        REQUIRE(parcel_qsat_h(i,k)  == Approx(d.parcel_qsat[i*pver+k]).epsilon(1e-3));
+      }
+    }
+  }
+
+  void run_bfb()
+  {
+    auto engine = Base::get_engine();
+
+    // Set up baseline data
+    zm_data_compute_dilute_parcel baseline_data[] = {
+      //                             pcols, ncol, pver, num_msg
+      zm_data_compute_dilute_parcel( 8,     1,    16,   0 ),
+      zm_data_compute_dilute_parcel( 8,     4,    32,   1 ),
+      zm_data_compute_dilute_parcel( 8,     8,    72,   2 ),
+    };
+
+    static constexpr Int num_runs = sizeof(baseline_data) / sizeof(zm_data_compute_dilute_parcel);
+
+    // Generate input data - baseline. Launch the parcel from one of the lowest
+    // levels, with the PBL top either above or below it (Fortran 1-based indices).
+    // The parcel and LCL inout values start from the environment, as in zm_convr.
+    std::uniform_real_distribution<Real> dist_tpert(0, 1);
+    std::uniform_int_distribution<Int>   dist_klaunch(0, 2);
+    std::uniform_int_distribution<Int>   dist_pblt(0, 4);
+    const Real zvir = Functions::C::RH2O/Functions::C::Rair - 1;
+    for (auto& d : baseline_data) {
+      std::vector<Real> pint(d.pcols*(d.pver+1)), zmid(d.pcols*d.pver);
+      zm_test_data_generate_sounding( engine, d.pver, d.ncol, pint.data(), d.pmid, zmid.data(), d.temperature, d.sp_humidity );
+      for (Int i = 0; i < d.ncol; ++i) {
+        d.klaunch[i]  = d.pver - dist_klaunch(engine);
+        d.pblt[i]     = d.pver - dist_pblt(engine);
+        d.tpert[i]    = dist_tpert(engine);
+        d.lcl_klev[i] = d.klaunch[i];
+        d.lcl_pmid[i]        = d.pmid[i*d.pver+d.klaunch[i]-1];
+        d.lcl_temperature[i] = d.temperature[i*d.pver+d.klaunch[i]-1];
+        for (Int k = 0; k < d.pver; ++k) {
+          const Int index = i*d.pver+k;
+          d.parcel_temp[index]  = d.temperature[index];
+          d.parcel_qsat[index]  = d.sp_humidity[index];
+          d.parcel_vtemp[index] = d.temperature[index]*(1+zvir*d.sp_humidity[index])/(1+d.sp_humidity[index]);
+        }
+      }
+    }
+
+    // Create copies of data for use by test
+    // (needs to happen before read calls so that inout data is in original state)
+    zm_data_compute_dilute_parcel test_data[] = {
+      zm_data_compute_dilute_parcel( baseline_data[0] ),
+      zm_data_compute_dilute_parcel( baseline_data[1] ),
+      zm_data_compute_dilute_parcel( baseline_data[2] ),
+    };
+    const zm_data_compute_dilute_parcel input_data[] = {
+      zm_data_compute_dilute_parcel( baseline_data[0] ),
+      zm_data_compute_dilute_parcel( baseline_data[1] ),
+      zm_data_compute_dilute_parcel( baseline_data[2] ),
+    };
+
+    // Read baseline data
+    if (this->m_baseline_action == COMPARE) {
+      for (auto& d : baseline_data) {
+        d.read(Base::m_ifile);
+      }
+    }
+
+    // Get data from test
+    for (auto& d : test_data) { zm_compute_dilute_parcel(d); }
+
+    // Check the C++ implementation against the Fortran one
+    for (Int i = 0; i < num_runs; ++i) { compare_cxx(input_data[i], test_data[i]); }
+
+    // Verify BFB results, all data should be in C layout
+    if (SCREAM_BFB_TESTING && this->m_baseline_action == COMPARE) {
+      for (Int i = 0; i < num_runs; ++i) {
+        zm_data_compute_dilute_parcel& d_baseline = baseline_data[i];
+        zm_data_compute_dilute_parcel& d_test = test_data[i];
+        for (Int k = 0; k < d_baseline.total(d_baseline.parcel_temp); ++k) {
+          REQUIRE(d_baseline.parcel_temp[k]  == d_test.parcel_temp[k]);
+          REQUIRE(d_baseline.parcel_vtemp[k] == d_test.parcel_vtemp[k]);
+          REQUIRE(d_baseline.parcel_qsat[k]  == d_test.parcel_qsat[k]);
+        }
+        for (Int k = 0; k < d_baseline.total(d_baseline.lcl_pmid); ++k) {
+          REQUIRE(d_baseline.lcl_pmid[k]        == d_test.lcl_pmid[k]);
+          REQUIRE(d_baseline.lcl_temperature[k] == d_test.lcl_temperature[k]);
+          REQUIRE(d_baseline.lcl_klev[k]        == d_test.lcl_klev[k]);
+        }
+      }
+    }
+    else if (this->m_baseline_action == GENERATE) {
+      for (Int i = 0; i < num_runs; ++i) {
+        test_data[i].write(Base::m_ofile);
+      }
+    }
+
+  } // zm_compute_dilute_parcel
+
+};
+
+} // namespace unit_test
+} // namespace zm
+} // namespace scream
+
+namespace {
+
+TEST_CASE("zm_compute_dilute_parcel", "[zm]")
+{
+  using TestStruct = scream::zm::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::Test_zm_compute_dilute_parcel;
+
+  TestStruct t;
+  t.run_bfb();
+}
+
+} // empty namespace
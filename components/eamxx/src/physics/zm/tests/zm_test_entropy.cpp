@@ -0,0 +1,148 @@
+#include "catch2/catch.hpp"
+
+#include "share/eamxx_types.hpp"
+#include "ekat/ekat_pack.hpp"
+#include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "physics/zm/zm_functions.hpp"
+#include "physics/zm/tests/infra/zm_test_data.hpp"
+
+#include "zm_unit_tests_common.hpp"
+
+namespace scream {
+namespace zm {
+namespace unit_test {
+
+template <typename D>
+struct UnitWrap::UnitTest<D>::Test_zm_entropy : public UnitWrap::UnitTest<D>::Base {
+
+  // Run the C++ entropy and ientropy on the inputs of d, and check that they match
+  // the (Fortran) outputs stored in d. The inversion stops once the bracket is
+  // smaller than ~1e-3 K, so the temperatures are compared with that margin.
+  void compare_cxx(const zm_data_entropy& d)
+  {
+    const Int num = d.num;
+
+    view_1d<Real> tk("tk",num), p("p",num), qtot("qtot",num), tfg("tfg",num);
+    view_1d<Real> s("s",num), t("t",num), qst("qst",num);
+    view_1d<Int>  converged("converged",num);
+
+    auto tk_h   = Kokkos::create_mirror_view(tk);
+    auto p_h    = Kokkos::create_mirror_view(p);
+    auto qtot_h = Kokkos::create_mirror_view(qtot);
+    auto tfg_h  = Kokkos::create_mirror_view(tfg);
+    for (Int i = 0; i < num; ++i) {
+      tk_h(i)   = d.tk[i];
+      p_h(i)    = d.p[i];
+      qtot_h(i) = d.qtot[i];
+      tfg_h(i)  = d.tfg[i];
+    }
+    Kokkos::deep_copy(tk,tk_h);
+    Kokkos::deep_copy(p,p_h);
+    Kokkos::deep_copy(qtot,qtot_h);
+    Kokkos::deep_copy(tfg,tfg_h);
+
+    Kokkos::parallel_for(RangePolicy(0,num), KOKKOS_LAMBDA(const Int i) {
+      s(i) = Functions::entropy(tk(i), p(i), qtot(i));
+      Real ti = 0, qsti = 0;
+      converged(i) = Functions::ientropy(s(i), p(i), qtot(i), tfg(i), ti, qsti);
+      t(i)   = ti;
+      qst(i) = qsti;
+    });
+
+    auto s_h         = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),s);
+    auto t_h         = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),t);
+    auto qst_h       = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),qst);
+    auto converged_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),converged);
+    for (Int i = 0; i < num; ++i) {
+      REQUIRE(converged_h(i));
+      REQUIRE(s_h(i)   == Approx(d.s[i]).epsilon(1e-4));
+      REQUIRE(t_h(i)   == Approx(d.t[i]).margin(1e-2));
+      REQUIRE(qst_h(i) == Approx(d.qst[i]).epsilon(1e-3));
+    }
+  }
+
+  void run_bfb()
+  {
+    auto engine = Base::get_engine();
+
+    // Set up baseline data
+    zm_data_entropy baseline_data[] = {
+      //              num
+      zm_data_entropy( 16 ),
+      zm_data_entropy( 64 ),
+    };
+
+    static constexpr Int num_runs = sizeof(baseline_data) / sizeof(zm_data_entropy);
+
+    // Generate input data - baseline. The first guess must be within the
+    // initial +/-10 K bracket of the inversion.
+    std::uniform_real_distribution<Real> dist_t(220, 310);
+    std::uniform_real_distribution<Real> dist_p(100, 1000);
+    std::uniform_real_distribution<Real> dist_q(1e-5, 2e-2);
+    std::uniform_real_distribution<Real> dist_tfg(-5, 5);
+    for (auto& d : baseline_data) {
+      for (Int i = 0; i < d.num; ++i) {
+        d.tk[i]   = dist_t(engine);
+        d.p[i]    = dist_p(engine);
+        d.qtot[i] = dist_q(engine);
+        d.tfg[i]  = d.tk[i] + dist_tfg(engine);
+      }
+    }
+
+    // Create copies of data for use by test
+    // (needs to happen before read calls so that inout data is in original state)
+    zm_data_entropy test_data[] = {
+      zm_data_entropy( baseline_data[0] ),
+      zm_data_entropy( baseline_data[1] ),
+    };
+
+    // Read baseline data
+    if (this->m_baseline_action == COMPARE) {
+      for (auto& d : baseline_data) {
+        d.read(Base::m_ifile);
+      }
+    }
+
+    // Get data from test
+    for (auto& d : test_data) { zm_entropy(d); }
+
+    // Check the C++ implementation against the Fortran one
+    for (const auto& d : test_data) { compare_cxx(d); }
+
+    // Verify BFB results, all data should be in C layout
+    if (SCREAM_BFB_TESTING && this->m_baseline_action == COMPARE) {
+      for (Int i = 0; i < num_runs; ++i) {
+        zm_data_entropy& d_baseline = baseline_data[i];
+        zm_data_entropy& d_test = test_data[i];
+        for (Int k = 0; k < d_baseline.total(d_baseline.s); ++k) {
+          REQUIRE(d_baseline.s[k]   == d_test.s[k]);
+          REQUIRE(d_baseline.t[k]   == d_test.t[k]);
+          REQUIRE(d_baseline.qst[k] == d_test.qst[k]);
+        }
+      }
+    }
+    else if (this->m_baseline_action == GENERATE) {
+      for (Int i = 0; i < num_runs; ++i) {
+        test_data[i].write(Base::m_ofile);
+      }
+    }
+
+  } // zm_entropy
+
+};
+
+} // namespace unit_test
+} // namespace zm
+} // namespace scream
+
+namespace {
+
+TEST_CASE("zm_entropy", "[zm]")
+{
+  using TestStruct = scream::zm::unit_test::UnitWrap::UnitTest<scream::DefaultDevice>::Test_zm_entropy;
+
+  TestStruct t;
+  t.run_bfb();
+}
+
+} // empty namespace
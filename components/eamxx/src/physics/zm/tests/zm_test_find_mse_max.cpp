@@ -3,12 +3,15 @@
 #include "share/eamxx_types.hpp"
 #include "ekat/ekat_pack.hpp"
 #include "ekat/kokkos/ekat_kokkos_utils.hpp"
+#include "ekat/kokkos/ekat_subview_utils.hpp"
 #include "physics/zm/zm_functions.hpp"
 #include "physics/zm/tests/infra/zm_test_data.hpp"
 #include "physics/zm/tests/infra/zm_test_data_functions.hpp"
 
 #include "zm_unit_tests_common.hpp"
 
+#include <algorithm>
+
 namespace scream {
 namespace zm {
 namespace unit_test {
@@ -16,6 +19,59 @@ namespace unit_test {
 template <typename D>
 struct UnitWrap::UnitTest<D>::Test_zm_find_mse_max : public UnitWrap::UnitTest<D>::Base {
 
+  // Run the C++ find_mse_max on the inputs of d, and check that it matches the
+  // (Fortran) outputs stored in d. Fortran level indices are 1-based.
+  void compare_cxx(const zm_data_find_mse_max& d)
+  {
+    const Int  ncol    = d.ncol;
+    const Int  pver    = d.pver;
+    const Int  num_msg = d.num_msg;
+    const bool pergro  = d.pergro_active;
+    const typename Functions::ZMRuntime runtime;
+
+    view_2d<Real> temperature("temperature",ncol,pver), zmid("zmid",ncol,pver), sp_humidity("sp_humidity",ncol,pver);
+    view_1d<Int>  msemax_top_k("msemax_top_k",ncol), msemax_klev("msemax_klev",ncol);
+    view_1d<Real> mse_max_val("mse_max_val",ncol);
+
+    auto temperature_h  = Kokkos::create_mirror_view(temperature);
+    auto zmid_h         = Kokkos::create_mirror_view(zmid);
+    auto sp_humidity_h  = Kokkos::create_mirror_view(sp_humidity);
+    auto msemax_top_k_h = Kokkos::create_mirror_view(msemax_top_k);
+    for (Int i = 0; i < ncol; ++i) {
+      msemax_top_k_h(i) = std::max(d.msemax_top_k[i]-1, 0);
+      for (Int k = 0; k < pver; ++k) {
+        temperature_h(i,k) = d.temperature[i*pver+k];
+        zmid_h(i,k)        = d.zmid[i*pver+k];
+        sp_humidity_h(i,k) = d.sp_humidity[i*pver+k];
+      }
+    }
+    Kokkos::deep_copy(temperature,temperature_h);
+    Kokkos::deep_copy(zmid,zmid_h);
+    Kokkos::deep_copy(sp_humidity,sp_humidity_h);
+    Kokkos::deep_copy(msemax_top_k,msemax_top_k_h);
+
+    Kokkos::parallel_for(RangePolicy(0,ncol), KOKKOS_LAMBDA(const Int i) {
+      Int  klev = pver-1;
+      Real mse  = 0;
+      Functions::find_mse_max(pver, num_msg, msemax_top_k(i), pergro, runtime,
+                              ekat::subview(temperature,i), ekat::subview(zmid,i), ekat::subview(sp_humidity,i),
+                              klev, mse);
+      msemax_klev(i) = klev;
+      mse_max_val(i) = mse;
+    });
+
+    auto msemax_klev_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),msemax_klev);
+    auto mse_max_val_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),mse_max_val);
+    for (Int i = 0; i < ncol; ++i) {
+      REQUIRE(msemax_klev_h(i)+1 == d.msemax_klev[i]);
+      if (SCREAM_BFB_TESTING) {
+        REQUIRE(mse_max_val_h(i) == d.mse_max_val[i]);
+      } else {
+        REQUIRE(mse_max_val_h(i) == Approx(d.mse_max_val[i]));
+      }
+    }
+  }
+
   void run_bfb()
   {
     auto engine = Base::get_engine();
@@ -58,6 +114,9 @@ struct UnitWrap::UnitTest<D>::Test_zm_find_mse_max : public UnitWrap::UnitTest<D
     // Get data from test
     for (auto& d : test_data) { zm_find_mse_max(d); }
 
+    // Check the C++ implementation against the Fortran one
+    for (const auto& d : test_data) { compare_cxx(d); }
+
     // Verify BFB results, all data should be in C layout
     if (SCREAM_BFB_TESTING && this->m_baseline_action == COMPARE) {
       for (Int i = 0; i < num_runs; ++i) {
@@ -19,7 +19,19 @@ template <typename ScalarT, typename DeviceT>
 struct Functions
 {
   // ---------------------------------------------------------------------------
-  // Types
+  // ZM constants
+
+  struct ZMC {
+    static constexpr ScalarT Cpwv                   = 1810.0;   // specific heat of water vapor [J/K/kg]
+    static constexpr ScalarT Tboil                  = 373.16;   // boiling point of water used in Goff-Gratch SVP [K]
+    static constexpr ScalarT capelmt                = 70.0;     // CAPE threshold for deep convection [J/kg]
+    static constexpr ScalarT lcl_pressure_threshold = 600.0;    // no convection if the LCL pressure is lower [mb]
+    static constexpr ScalarT ull_upper_launch_p     = 600.0;    // upper search limit for unrestricted launch level [mb]
+    static constexpr ScalarT pergro_rhd_threshold   = -1.e-4;   // MSE difference threshold for perturbation growth test
+    static constexpr ScalarT lwmax                  = 1.e-3;    // max condensate held in cloud before rainout [kg/kg]
+    static constexpr Int     nit_lheat              = 2;        // iterations of the condensation/freezing loop
+    static constexpr Int     max_num_cin            = 8;        // max allowed value of ZMRuntime::num_cin
+  };
 
   using Scalar = ScalarT;
   using Device = DeviceT;
@@ -33,6 +45,8 @@ struct Functions
 
   using KT = ekat::KokkosTypes<Device>;
 
+  using C = scream::physics::Constants<Scalar>;
+
   template <typename S> using view_1d           = typename KT::template view_1d<S>;
   template <typename S> using view_2d           = typename KT::template view_2d<S>;
   template <typename S> using view_3d           = typename KT::template view_3d<S>;
@@ -46,6 +60,14 @@ struct Functions
   // Structs
   struct ZMRuntime {
     ZMRuntime() = default;
+    // Tunable parameters, defaults as in zm_param_set_for_testing
+    Scalar tiedke_add     = 0.8;      // parcel temperature perturbation added to the buoyancy [K]
+    Scalar dmpdz          = -0.7e-3;  // parcel fractional mass entrainment rate [1/m]
+    Scalar tpert_fac      = 2.0;      // tunable factor for the PBL temperature perturbation
+    Int    num_cin        = 1;        // num of negative buoyancy regions allowed before the conv. top
+    Int    mx_bot_lyr_adj = 1;        // bottom layer adjustment for the launch level search
+    bool   tpert_fix      = true;     // no PBL temperature perturbation for parcels launched above the PBL
+    bool   trig_ull       = true;     // use the unrestricted launch level (ULL) trigger
   };
 
   // This struct stores input views for ZM_main.
@@ -70,11 +92,115 @@ struct Functions
 
   // ---------------------------------------------------------------------------
   // Functions
-
+  //
+  // All functions below work on a single column, with 0-based level indices
+  // (k=0 at model top). As in the Fortran code, pressures are in mb.
+
+  // Saturation vapor pressure over water [Pa] (Goff and Gratch, 1946)
+  KOKKOS_FUNCTION
+  static Scalar goff_gratch_svp_water(const Scalar& t);
+
+  // Saturation vapor pressure [mb] and saturation mixing ratio at temperature t [K] and pressure p [mb]
+  KOKKOS_FUNCTION
+  static void qsat_hPa(const Scalar& t, const Scalar& p, Scalar& es, Scalar& qs);
+
+  // Entropy per unit mass of dry air (Raymond and Blyth, 1992)
+  KOKKOS_FUNCTION
+  static Scalar entropy(const Scalar& tk, const Scalar& p, const Scalar& qtot);
+
+  // Invert the entropy equation for temperature and saturation mixing ratio with
+  // Brent's method, starting from the guess tfg. Return false if it did not converge.
+  KOKKOS_FUNCTION
+  static bool ientropy(const Scalar& s, const Scalar& p, const Scalar& qt, const Scalar& tfg,
+                       Scalar& t, Scalar& qst);
+
+  // Find the level of max moist static energy below msemax_top_k, used as parcel launch level.
+  // msemax_klev is only updated if some level is found.
+  KOKKOS_FUNCTION
+  static void find_mse_max(
+    // Inputs
+    const Int& pver,
+    const Int& num_msg,
+    const Int& msemax_top_k,
+    const bool& pergro_active,
+    const ZMRuntime& runtime,
+    const uview_1d<const Scalar>& temperature,
+    const uview_1d<const Scalar>& zmid,
+    const uview_1d<const Scalar>& sp_humidity,
+    // Inputs/Outputs
+    Int& msemax_klev,
+    Scalar& mse_max_val);
+
+  // Compute the properties of an entraining parcel lifted from klaunch. The parcel
+  // arrays must be initialized with the environment values. The work arrays must have
+  // pver entries each. Return false if some entropy inversion did not converge.
+  KOKKOS_FUNCTION
+  static bool compute_dilute_parcel(
+    // Inputs
+    const Int& pver,
+    const Int& num_msg,
+    const Int& klaunch,
+    const uview_1d<const Scalar>& pmid,
+    const uview_1d<const Scalar>& temperature,
+    const uview_1d<const Scalar>& sp_humidity,
+    const Scalar& tpert,
+    const Int& pblt,
+    const ZMRuntime& runtime,
+    // Work arrays
+    const uview_1d<Scalar>& tmix,
+    const uview_1d<Scalar>& qtmix,
+    const uview_1d<Scalar>& qsmix,
+    const uview_1d<Scalar>& smix,
+    const uview_1d<Scalar>& xsh2o,
+    const uview_1d<Scalar>& ds_xsh2o,
+    const uview_1d<Scalar>& ds_freeze,
+    // Inputs/Outputs
+    const uview_1d<Scalar>& parcel_temp,
+    const uview_1d<Scalar>& parcel_vtemp,
+    const uview_1d<Scalar>& parcel_qsat,
+    Scalar& lcl_pmid,
+    Scalar& lcl_temperature,
+    Int& lcl_klev);
+
+  // Compute CAPE and the equilibrium level from the parcel properties. The buoyancy work
+  // array must have pver entries, and pint is only used through ratios (any unit works).
+  KOKKOS_FUNCTION
+  static void compute_cape_from_parcel(
+    // Inputs
+    const Int& pver,
+    const Int& num_msg,
+    const ZMRuntime& runtime,
+    const uview_1d<const Scalar>& temperature,
+    const uview_1d<const Scalar>& tv,
+    const uview_1d<const Scalar>& sp_humidity,
+    const uview_1d<const Scalar>& pint,
+    const Int& msemax_klev,
+    const Scalar& lcl_pmid,
+    const Int& lcl_klev,
+    // Work arrays
+    const uview_1d<Scalar>& buoyancy,
+    // Inputs/Outputs
+    const uview_1d<Scalar>& parcel_qsat,
+    const uview_1d<Scalar>& parcel_temp,
+    const uview_1d<Scalar>& parcel_vtemp,
+    // Outputs
+    Int& eql_klev,
+    Scalar& cape);
 
 }; // struct Functions
 
 } // namespace zm
 } // namespace scream
 
+// If a GPU build, without relocatable device code enabled, make all code available
+// to the translation unit; otherwise, ETI is used.
+#if defined(EAMXX_ENABLE_GPU) && !defined(KOKKOS_ENABLE_CUDA_RELOCATABLE_DEVICE_CODE) \
+                                && !defined(KOKKOS_ENABLE_HIP_RELOCATABLE_DEVICE_CODE)
+
+# include "impl/zm_entropy_impl.hpp"
+# include "impl/zm_find_mse_max_impl.hpp"
+# include "impl/zm_compute_dilute_parcel_impl.hpp"
+# include "impl/zm_compute_cape_from_parcel_impl.hpp"
+#endif // GPU && !KOKKOS_ENABLE_*_RELOCATABLE_DEVICE_CODE
+
 #endif // ZM_FUNCTIONS_HPP
@@ -18,9 +18,14 @@ Field AtmosphereDiagnostic::get_diagnostic () const {
   return m_diagnostic_output;
 }
 
-void AtmosphereDiagnostic::compute_diagnostic (const double dt) {
+void AtmosphereDiagnostic::compute_diagnostic (const double dt, const bool defer_global_sum) {
+  EKAT_REQUIRE_MSG (not defer_global_sum or can_defer_global_sum(),
+      "Error! This diagnostic cannot defer its global sum to the caller.\n"
+      "  - Diag name: " + name() + "\n");
+
   // Some diagnostics need the timestep, store in case.
   m_dt = dt;
+  m_defer_global_sum = defer_global_sum;
 
   // Set the timestamp of the diagnostic to the most
   // recent timestamp among the inputs
@@ -55,7 +55,14 @@ public:
   // we need to compute tendencies, or accumulated stuff)
   virtual void init_timestep (const util::TimeStamp& /* start_of_step */) {}
 
-  void compute_diagnostic (const double dt = 0);
+  // Diags whose output is the global sum of local partial results (e.g., horizontal
+  // averages) can leave the allreduce to the caller, which can then batch the
+  // reductions of many diags together (see DiagnosticRegistry).
+  virtual bool can_defer_global_sum () const { return false; }
+
+  // If defer_global_sum=true, the output only stores the local partial sums,
+  // and the caller is responsible for summing it across ranks.
+  void compute_diagnostic (const double dt = 0, const bool defer_global_sum = false);
 protected:
 
   void set_required_field_impl (const Field& f) final;
@@ -75,6 +82,9 @@ protected:
 
   // Diagnostics are meant to return a field
   Field m_diagnostic_output;
+
+  // Whether the current evaluation must skip the final allreduce
+  bool m_defer_global_sum = false;
 };
 
 // A short name for the factory for atmosphere diagnostics
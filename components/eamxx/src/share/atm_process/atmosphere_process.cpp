@@ -67,6 +67,12 @@ AtmosphereProcess (const ekat::Comm& comm, const ekat::ParameterList& params)
 
   m_repair_log_level = str2LogLevel(m_params.get<std::string>("repair_log_level","warn"));
 
+  m_fuse_property_checks = m_params.get<bool>("fuse_property_checks",true);
+  m_property_checks_host_interval = m_params.get<int>("property_checks_host_interval",1);
+  EKAT_REQUIRE_MSG (m_property_checks_host_interval>0,
+      "Error! Invalid property_checks_host_interval in param list " + m_params.name() + ".\n"
+      "  - property_checks_host_interval: " + std::to_string(m_property_checks_host_interval) + "\n");
+
   // Info for mass and energy conservation checks
   m_column_conservation_check_data.has_check =
       m_params.get<bool>("enable_column_conservation_checks", false);
@@ -91,6 +97,13 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
     start_timer (m_timer_prefix + this->name() + "::init");
   }
 
+  const auto timer_root = m_timer_prefix + this->name();
+  m_run_timer = TimerHandle(timer_root + "::run");
+  m_precondition_checks_timer = TimerHandle(timer_root + "::run-precondition-checks");
+  m_postcondition_checks_timer = TimerHandle(timer_root + "::run-postcondition-checks");
+  m_column_conservation_checks_timer = TimerHandle(timer_root + "::run-column-conservation-checks");
+  m_tendencies_timer = TimerHandle(timer_root + "::compute_tendencies");
+
   // Avoid logging and flushing if ap type is diag ...
   // ... because we could have 100+ of those in production runs
   if (this->type()!=AtmosphereProcessType::Diagnostic) {
@@ -123,7 +136,7 @@ void AtmosphereProcess::initialize (const TimeStamp& t0, const RunType run_type)
 
 void AtmosphereProcess::run (const double dt) {
   m_atm_logger->debug("[EAMxx::" + this->name() + "] run...");
-  start_timer (m_timer_prefix + this->name() + "::run");
+  start_timer (m_run_timer);
   if (m_params.get("enable_precondition_checks", true)) {
     // Run 'pre-condition' property checks stored in this AP
     run_precondition_checks();
@@ -179,7 +192,7 @@ void AtmosphereProcess::run (const double dt) {
     // Update all output fields time stamps
     update_time_stamps ();
   }
-  stop_timer (m_timer_prefix + this->name() + "::run");
+  stop_timer (m_run_timer);
 }
 
 void AtmosphereProcess::finalize () {
@@ -520,49 +533,102 @@ void AtmosphereProcess::run_property_check (const prop_check_ptr&       property
 
 void AtmosphereProcess::run_precondition_checks () const {
   m_atm_logger->debug("[" + this->name() + "] run_precondition_checks...");
-  start_timer(m_timer_prefix + this->name() + "::run-precondition-checks");
+  start_timer(m_precondition_checks_timer);
   // Run all pre-condition property checks
-  for (const auto& it : m_precondition_checks) {
-    run_property_check(it.second, it.first,
-                       PropertyCheckCategory::Precondition);
+  if (m_fuse_property_checks) {
+    run_fused_property_checks(m_precondition_checks,m_fused_precondition_checks,
+                              PropertyCheckCategory::Precondition);
+  } else {
+    for (const auto& it : m_precondition_checks) {
+      run_property_check(it.second, it.first,
+                         PropertyCheckCategory::Precondition);
+    }
   }
-  stop_timer(m_timer_prefix + this->name() + "::run-precondition-checks");
+  stop_timer(m_precondition_checks_timer);
   m_atm_logger->debug("[" + this->name() + "] run_precondition_checks...done!");
 }
 
 void AtmosphereProcess::run_postcondition_checks () const {
   m_atm_logger->debug("[" + this->name() + "] run_postcondition_checks...");
-  start_timer(m_timer_prefix + this->name() + "::run-postcondition-checks");
+  start_timer(m_postcondition_checks_timer);
   // Run all post-condition property checks
-  for (const auto& it : m_postcondition_checks) {
-    run_property_check(it.second, it.first,
-                       PropertyCheckCategory::Postcondition);
+  if (m_fuse_property_checks) {
+    run_fused_property_checks(m_postcondition_checks,m_fused_postcondition_checks,
+                              PropertyCheckCategory::Postcondition);
+  } else {
+    for (const auto& it : m_postcondition_checks) {
+      run_property_check(it.second, it.first,
+                         PropertyCheckCategory::Postcondition);
+    }
   }
-  stop_timer(m_timer_prefix + this->name() + "::run-postcondition-checks");
+  stop_timer(m_postcondition_checks_timer);
   m_atm_logger->debug("[" + this->name() + "] run_postcondition_checks...done!");
 }
 
+void AtmosphereProcess::
+run_fused_property_checks (const std::list<std::pair<CheckFailHandling,prop_check_ptr>>& checks,
+                           FusedChecks& fused,
+                           const PropertyCheckCategory property_check_category) const
+{
+  if (fused.num_checks!=static_cast<int>(checks.size())) {
+    fused = FusedChecks();
+    fused.engine = std::make_shared<FusedPropertyChecks>();
+    for (const auto& it : checks) {
+      if (fused.engine->add(it.second)) {
+        fused.cfh.push_back(it.first);
+        fused.can_repair |= it.second->can_repair();
+      } else {
+        fused.unfused.push_back(it);
+      }
+    }
+    fused.num_checks = checks.size();
+  }
+
+  for (const auto& it : fused.unfused) {
+    run_property_check(it.second, it.first, property_check_category);
+  }
+
+  if (fused.engine->num_checks()==0) {
+    return;
+  }
+
+  // The screening only raises flags, so, if no check can repair, we can let
+  // failures accumulate for a few calls before reading the flags on host.
+  // NOTE: a flagged check is then re-run on the *current* data, to get the
+  //       diagnostics. If the violation was transient (i.e., it was fixed by a
+  //       later call), the check passes, and the violation goes unreported.
+  //       That is, with an interval larger than 1 checks are not guaranteed.
+  fused.engine->screen();
+  ++fused.num_calls;
+  if (fused.can_repair or fused.num_calls%m_property_checks_host_interval==0) {
+    for (const int i : fused.engine->get_flagged()) {
+      run_property_check(fused.engine->get_check(i), fused.cfh[i], property_check_category);
+    }
+    fused.engine->reset_flags();
+  }
+}
+
 void AtmosphereProcess::run_column_conservation_check () const {
   m_atm_logger->debug("[" + this->name() + "] run_column_conservation_check...");
-  start_timer(m_timer_prefix + this->name() + "::run-column-conservation-checks");
+  start_timer(m_column_conservation_checks_timer);
   // Conservation check is run as a postcondition check
   run_property_check(m_column_conservation_check.second,
                      m_column_conservation_check.first,
                      PropertyCheckCategory::Postcondition);
-  stop_timer(m_timer_prefix + this->name() + "::run-column-conservation-checks");
+  stop_timer(m_column_conservation_checks_timer);
   m_atm_logger->debug("[" + this->name() + "] run_column-conservation_checks...done!");
 }
 
 void AtmosphereProcess::init_step_tendencies () {
   if (m_compute_proc_tendencies) {
-    start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+    start_timer(m_tendencies_timer);
     for (auto& it : m_start_of_step_fields) {
       const auto& fname = it.first;
       const auto& f     = get_field_out(fname);
             auto& f_beg = it.second;
       f_beg.deep_copy(f);
     }
-    stop_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+    stop_timer(m_tendencies_timer);
   }
 }
 
@@ -570,7 +636,7 @@ void AtmosphereProcess::compute_step_tendencies (const double dt) {
   using namespace ShortFieldTagsNames;
   if (m_compute_proc_tendencies) {
     m_atm_logger->debug("[" + this->name() + "] computing tendencies...");
-    start_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+    start_timer(m_tendencies_timer);
     for (auto it : m_proc_tendencies) {
       // Note: f_beg is nonconst, so we can store step tendency in it
       const auto& tname = it.first;
@@ -583,7 +649,7 @@ void AtmosphereProcess::compute_step_tendencies (const double dt) {
       f_beg.update(f,1,-1);
       tend.update(f_beg,1,1);
     }
-    stop_timer(m_timer_prefix + this->name() + "::compute_tendencies");
+    stop_timer(m_tendencies_timer);
   }
 }
 
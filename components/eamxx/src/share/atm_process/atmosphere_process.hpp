@@ -8,10 +8,12 @@
 #include "share/field/field_identifier.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/property_checks/property_check.hpp"
+#include "share/property_checks/fused_property_checks.hpp"
 #include "share/field/field_request.hpp"
 #include "share/field/field.hpp"
 #include "share/field/field_group.hpp"
 #include "share/grid/grids_manager.hpp"
+#include "share/util/eamxx_timing.hpp"
 
 #include "ekat/mpi/ekat_comm.hpp"
 #include "ekat/ekat_parameter_list.hpp"
@@ -493,6 +495,13 @@ protected:
   // A prefix to add to this atm proc timer
   std::string m_timer_prefix;
 
+  // Timers used at every step, created once in initialize (so that name() is available)
+  mutable TimerHandle m_run_timer;
+  mutable TimerHandle m_precondition_checks_timer;
+  mutable TimerHandle m_postcondition_checks_timer;
+  mutable TimerHandle m_column_conservation_checks_timer;
+  mutable TimerHandle m_tendencies_timer;
+
   // The logger for the whole atmosphere
   // WARNING: this is non-const, but you should *NOT* modify its
   //          log level and/or its sinks. If you just need to log
@@ -543,6 +552,24 @@ private:
                            const CheckFailHandling     check_fail_handling,
                            const PropertyCheckCategory property_check_category) const;
 
+  // Pre/postcondition checks that can be screened with a single kernel (see FusedPropertyChecks).
+  // The engine is built the first time the checks are run (when all fields are allocated),
+  // and rebuilt if the number of checks changes.
+  struct FusedChecks {
+    std::shared_ptr<FusedPropertyChecks>                    engine;
+    std::vector<CheckFailHandling>                          cfh;      // Of the fused checks
+    std::list<std::pair<CheckFailHandling,prop_check_ptr>>  unfused;
+    int   num_checks = -1;      // Number of checks when the engine was built
+    bool  can_repair = false;   // Whether any of the fused checks can repair
+    int   num_calls  = 0;
+  };
+
+  // Run checks, screening the fusable ones with a single kernel, and running check() only
+  // for the ones that are flagged by the screening.
+  void run_fused_property_checks (const std::list<std::pair<CheckFailHandling,prop_check_ptr>>& checks,
+                                  FusedChecks& fused,
+                                  const PropertyCheckCategory property_check_category) const;
+
   // NOTE: all these members are private, so that derived classes cannot
   //       bypass checks from the base class by accessing the members directly.
   //       Instead, they are forced to use access function, which include
@@ -573,6 +600,15 @@ private:
   std::list<std::pair<CheckFailHandling,prop_check_ptr>> m_precondition_checks;
   std::list<std::pair<CheckFailHandling,prop_check_ptr>> m_postcondition_checks;
 
+  // Whether to screen pre/postcondition checks with a single kernel, and every how many
+  // calls the host reads the result of the screening (if no fused check can repair).
+  // With an interval larger than 1, violations that do not persist until the host
+  // reads the screening results are missed.
+  bool m_fuse_property_checks;
+  int  m_property_checks_host_interval;
+  mutable FusedChecks m_fused_precondition_checks;
+  mutable FusedChecks m_fused_postcondition_checks;
+
   // Column local mass and energy conservation check
   std::pair<CheckFailHandling,prop_check_ptr> m_column_conservation_check;
 
@@ -0,0 +1,165 @@
+#include "share/field/field_batch_update.hpp"
+
+namespace scream
+{
+
+FieldBatchUpdate::
+FieldBatchUpdate (const CombineMode cm)
+ : m_cm (cm)
+{
+  EKAT_REQUIRE_MSG (cm==CombineMode::Update or cm==CombineMode::Max or cm==CombineMode::Min,
+      "Error! FieldBatchUpdate only supports Update, Max, and Min combine modes.\n");
+}
+
+bool FieldBatchUpdate::
+supports (const Field& x, const Field& y)
+{
+  auto ok = [](const Field& f) {
+    const auto& fh = f.get_header();
+    return f.is_allocated() and
+           f.data_type()==get_data_type<Real>() and
+           fh.get_parent()==nullptr and
+           fh.get_alloc_properties().get_padding()==0;
+  };
+  return ok(x) and ok(y) and not y.is_read_only() and
+         x.get_header().get_identifier().get_layout()==y.get_header().get_identifier().get_layout();
+}
+
+void FieldBatchUpdate::
+add (const Field& x, const Field& y)
+{
+  add(x,y,Field());
+}
+
+void FieldBatchUpdate::
+add (const Field& x, const Field& y, const Field& count)
+{
+  EKAT_REQUIRE_MSG (not m_setup,
+      "Error! Cannot add fields to FieldBatchUpdate after setup was called.\n");
+  EKAT_REQUIRE_MSG (supports(x,y),
+      "Error! Field pair not supported by FieldBatchUpdate.\n"
+      " - x name: " + x.name() + "\n"
+      " - y name: " + y.name() + "\n"
+      "Fields must be allocated, of type Real, not subfields, not padded, and with the same layout.\n");
+  if (count.is_allocated()) {
+    const auto& c_fh = count.get_header();
+    EKAT_REQUIRE_MSG (count.data_type()==DataType::IntType and
+                      c_fh.get_parent()==nullptr and
+                      c_fh.get_alloc_properties().get_padding()==0 and
+                      c_fh.get_identifier().get_layout()==x.get_header().get_identifier().get_layout(),
+        "Error! Invalid count field for FieldBatchUpdate.\n"
+        " - x name    : " + x.name() + "\n"
+        " - count name: " + count.name() + "\n"
+        "Count fields must be of type int, not subfields, not padded, and with the same layout as x.\n");
+    EKAT_REQUIRE_MSG (x.get_header().has_extra_data("mask_value") or y.get_header().has_extra_data("mask_value"),
+        "Error! Count field provided to FieldBatchUpdate, but neither x nor y have mask_value extra data.\n"
+        " - x name    : " + x.name() + "\n"
+        " - count name: " + count.name() + "\n");
+  }
+
+  m_x.push_back(x);
+  m_y.push_back(y);
+  m_count.push_back(count);
+}
+
+void FieldBatchUpdate::
+setup ()
+{
+  EKAT_REQUIRE_MSG (not m_setup,
+      "Error! FieldBatchUpdate::setup called twice.\n");
+
+  const int n = m_x.size();
+  m_entries = decltype(m_entries)("batch_update_entries",n);
+  m_offsets = decltype(m_offsets)("batch_update_offsets",n+1);
+  auto entries_h = Kokkos::create_mirror_view(m_entries);
+  auto offsets_h = Kokkos::create_mirror_view(m_offsets);
+
+  offsets_h(0) = 0;
+  for (int i=0; i<n; ++i) {
+    const auto& x = m_x[i];
+    const auto& y = m_y[i];
+    const auto& x_fh = x.get_header();
+    const auto& y_fh = y.get_header();
+
+    auto& e = entries_h(i);
+    e.x = x.get_internal_view_data<const Real>();
+    e.y = y.get_internal_view_data<Real>();
+    e.count = m_count[i].is_allocated() ? m_count[i].get_internal_view_data<int>() : nullptr;
+
+    // Same logic as in Field::update_impl
+    e.use_fill = y_fh.has_extra_data("mask_value") or x_fh.has_extra_data("mask_value");
+    e.fill_value = 0;
+    if (y_fh.has_extra_data("mask_value")) {
+      e.fill_value = y_fh.get_extra_data<Real>("mask_value");
+    } else if (x_fh.has_extra_data("mask_value")) {
+      e.fill_value = x_fh.get_extra_data<Real>("mask_value");
+    }
+
+    offsets_h(i+1) = offsets_h(i) + x_fh.get_identifier().get_layout().size();
+  }
+  m_total_size = offsets_h(n);
+
+  Kokkos::deep_copy(m_entries,entries_h);
+  Kokkos::deep_copy(m_offsets,offsets_h);
+
+  m_setup = true;
+}
+
+void FieldBatchUpdate::
+run (const Real alpha, const Real beta) const
+{
+  EKAT_REQUIRE_MSG (m_setup,
+      "Error! FieldBatchUpdate::run called before setup.\n");
+
+  if (m_total_size==0) {
+    return;
+  }
+
+  switch (m_cm) {
+    case CombineMode::Update:
+      run_impl<CombineMode::Update>(alpha,beta); break;
+    case CombineMode::Max:
+      run_impl<CombineMode::Max>(alpha,beta); break;
+    case CombineMode::Min:
+      run_impl<CombineMode::Min>(alpha,beta); break;
+    default:
+      EKAT_ERROR_MSG ("Error! Unexpected combine mode in FieldBatchUpdate::run.\n");
+  }
+}
+
+template<CombineMode CM>
+void FieldBatchUpdate::
+run_impl (const Real alpha, const Real beta) const
+{
+  const auto entries = m_entries;
+  const auto offsets = m_offsets;
+  const int  nfields = m_entries.extent(0);
+
+  using policy_t = Kokkos::RangePolicy<KT::ExeSpace,Kokkos::IndexType<long long>>;
+  Kokkos::parallel_for(policy_t(0,m_total_size),
+                       KOKKOS_LAMBDA(const long long idx) {
+    // Binary search for the entry k such that offsets(k) <= idx < offsets(k+1)
+    int lo = 0, hi = nfields;
+    while (hi-lo>1) {
+      const int mid = (lo+hi)/2;
+      if (offsets(mid)<=idx) {
+        lo = mid;
+      } else {
+        hi = mid;
+      }
+    }
+    const auto& e = entries(lo);
+    const auto i = idx - offsets(lo);
+    const Real x = e.x[i];
+    if (e.use_fill) {
+      fill_aware_combine<CM>(x,e.y[i],e.fill_value,alpha,beta);
+    } else {
+      combine<CM>(x,e.y[i],alpha,beta);
+    }
+    if (e.count!=nullptr and x!=e.fill_value) {
+      ++e.count[i];
+    }
+  });
+}
+
+} // namespace scream
@@ -0,0 +1,97 @@
+#ifndef SCREAM_FIELD_BATCH_UPDATE_HPP
+#define SCREAM_FIELD_BATCH_UPDATE_HPP
+
+#include "share/field/field.hpp"
+
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A class to perform y = combine<CM>(x,y) on many (x,y) field pairs at once
+ *
+ * Calling Field::update (or max/min) on N fields launches N kernels. When the
+ * fields are small (e.g., 2d fields in a small rank-local chunk of the grid),
+ * kernel launch latency dominates. This class stores a device table of
+ * descriptors (raw pointers, sizes, fill values), and performs the update
+ * of all fields in a single kernel, over the flattened range of all entries.
+ *
+ * Each (x,y) pair can optionally be paired with an int "count" field, which
+ * is incremented by 1 wherever x is not equal to the fill value. This is
+ * the same as computing mask=(x!=fill_value) and doing count.update(mask,1,1),
+ * but without the need for a separate mask field, and without extra launches.
+ *
+ * Fill-value logic is the same as in Field::update: if x or y have the
+ * "mask_value" extra data, entries where x==fill_value are not combined.
+ *
+ * Only fields of type Real, that are NOT subfields and NOT padded, can be
+ * added (see 'supports'); callers should use Field::update for the others.
+ *
+ * Usage:
+ *   FieldBatchUpdate bu(CombineMode::Update);
+ *   bu.add(x1,y1);
+ *   bu.add(x2,y2,count2);
+ *   bu.setup();
+ *   ...
+ *   bu.run(alpha,beta); // May be called multiple times
+ */
+
+class FieldBatchUpdate
+{
+public:
+  FieldBatchUpdate (const CombineMode cm);
+
+  // Whether the pair (x,y) can be handled by this class
+  static bool supports (const Field& x, const Field& y);
+
+  // Add fields to the batch. Must be called before setup.
+  void add (const Field& x, const Field& y);
+  void add (const Field& x, const Field& y, const Field& count);
+
+  // Create the device table of descriptors. After this call, no more fields can be added.
+  void setup ();
+
+  // Update all y's (and counts, if present)
+  void run (const Real alpha = 1, const Real beta = 1) const;
+
+  int num_fields () const { return m_x.size(); }
+  bool is_setup () const { return m_setup; }
+
+  // Descriptor for each (x,y) pair. Public, since it's used inside a device lambda.
+  struct Entry {
+    const Real* x;
+    Real*       y;
+    int*        count;
+    Real        fill_value;
+    bool        use_fill;
+  };
+
+#ifndef KOKKOS_ENABLE_CUDA
+  // Cuda requires methods enclosing __device__ lambda's to be public
+protected:
+#endif
+
+  template<CombineMode CM>
+  void run_impl (const Real alpha, const Real beta) const;
+
+protected:
+
+  using KT = KokkosTypes<DefaultDevice>;
+
+  CombineMode   m_cm;
+  bool          m_setup = false;
+  long long     m_total_size = 0;
+
+  std::vector<Field>  m_x;
+  std::vector<Field>  m_y;
+  std::vector<Field>  m_count;
+
+  // Device table of descriptors, and offsets of each entry in the flattened range
+  KT::view_1d<Entry>      m_entries;
+  KT::view_1d<long long>  m_offsets;
+};
+
+} // namespace scream
+
+#endif // SCREAM_FIELD_BATCH_UPDATE_HPP
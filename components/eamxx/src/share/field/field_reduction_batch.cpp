@@ -0,0 +1,333 @@
+#include "share/field/field_reduction_batch.hpp"
+
+#include "share/field/field_utils.hpp"
+#include "share/util/eamxx_utils.hpp"  // For check_mpi_call
+
+#include "eamxx_config.h"
+
+namespace scream
+{
+
+namespace {
+
+using KT         = KokkosTypes<DefaultDevice>;
+using mem_space  = KT::ExeSpace::memory_space;
+using dev_result = Kokkos::View<Real,mem_space,Kokkos::MemoryUnmanaged>;
+using policy_t   = Kokkos::RangePolicy<KT::ExeSpace,Kokkos::IndexType<long long>>;
+
+// The fields we reduce on device are not subfields, so their data is stored as
+// a 2d array (prod(dims[:-1]),last_extent), where last_extent>=dims.back() if padded.
+struct FlatInfo {
+  long long size;
+  int last_dim;
+  int last_extent;
+};
+
+bool reduce_on_device (const Field& f)
+{
+  const auto& fh = f.get_header();
+  return fh.get_parent()==nullptr and
+         fh.get_identifier().get_layout().rank()>0;
+}
+
+FlatInfo get_flat_info (const Field& f)
+{
+  const auto& fh = f.get_header();
+  const auto& fl = fh.get_identifier().get_layout();
+  return FlatInfo{fl.size(), fl.dims().back(), fh.get_alloc_properties().get_last_extent()};
+}
+
+// Compute sum(f) (or sum(f^2)) of the local entries of f, and store it in result
+void local_sum (const Field& f, const bool squared, const dev_result& result)
+{
+  const auto info = get_flat_info(f);
+  const auto data = f.get_internal_view_data<const Real>();
+  Kokkos::parallel_reduce("FieldReductionBatch::sum",policy_t(0,info.size),
+                          KOKKOS_LAMBDA(const long long idx, Real& acc) {
+    const auto i = idx / info.last_dim;
+    const auto j = idx % info.last_dim;
+    const Real v = data[i*info.last_extent + j];
+    acc += squared ? v*v : v;
+  },result);
+}
+
+// Compute max(f) (or max(-f)) of the local entries of f, and store it in result
+void local_max (const Field& f, const bool negate, const dev_result& result)
+{
+  const auto info = get_flat_info(f);
+  const auto data = f.get_internal_view_data<const Real>();
+  Kokkos::parallel_reduce("FieldReductionBatch::max",policy_t(0,info.size),
+                          KOKKOS_LAMBDA(const long long idx, Real& acc) {
+    const auto i = idx / info.last_dim;
+    const auto j = idx % info.last_dim;
+    const Real v = data[i*info.last_extent + j];
+    const Real val = negate ? -v : v;
+    if (val>acc) {
+      acc = val;
+    }
+  },Kokkos::Max<Real,mem_space>(result));
+}
+
+// Copy the (non-padding) entries of f into a contiguous buffer, or vice versa
+void pack (const Field& f, Real* buf)
+{
+  const auto info = get_flat_info(f);
+  const auto data = f.get_internal_view_data<const Real>();
+  Kokkos::parallel_for("FieldReductionBatch::pack",policy_t(0,info.size),
+                       KOKKOS_LAMBDA(const long long idx) {
+    const auto i = idx / info.last_dim;
+    const auto j = idx % info.last_dim;
+    buf[idx] = data[i*info.last_extent + j];
+  });
+}
+
+void unpack (const Real* buf, const Field& f)
+{
+  const auto info = get_flat_info(f);
+  const auto data = f.get_internal_view_data<Real>();
+  Kokkos::parallel_for("FieldReductionBatch::unpack",policy_t(0,info.size),
+                       KOKKOS_LAMBDA(const long long idx) {
+    const auto i = idx / info.last_dim;
+    const auto j = idx % info.last_dim;
+    data[i*info.last_extent + j] = buf[idx];
+  });
+}
+
+} // anonymous namespace
+
+FieldReductionBatch::
+FieldReductionBatch (const ekat::Comm& comm)
+ : m_comm (comm)
+{
+  m_mpi_reqs[0] = m_mpi_reqs[1] = MPI_REQUEST_NULL;
+}
+
+FieldReductionBatch::
+~FieldReductionBatch ()
+{
+  // Do not leave pending MPI requests around
+  if (m_in_progress) {
+    MPI_Waitall(2,m_mpi_reqs,MPI_STATUSES_IGNORE);
+  }
+}
+
+void FieldReductionBatch::
+add_horiz_contraction (const Field& f_out, const Field& f_in, const Field& weight)
+{
+  add_field_request(f_out,RequestType::HorizContraction,"horiz contraction");
+
+  auto& r  = m_requests.back();
+  r.f      = f_in;
+  r.weight = weight;
+}
+
+void FieldReductionBatch::
+add_all_reduce (const Field& f)
+{
+  add_field_request(f,RequestType::AllReduce,"all reduce");
+}
+
+void FieldReductionBatch::
+add_field_request (const Field& f_out, const RequestType type, const std::string& name)
+{
+  EKAT_REQUIRE_MSG (not m_setup,
+      "Error! Cannot add requests to FieldReductionBatch after the first call to start.\n");
+  EKAT_REQUIRE_MSG (f_out.is_allocated() and f_out.data_type()==get_data_type<Real>(),
+      "Error! FieldReductionBatch requires allocated fields of type Real.\n"
+      " - field name: " + f_out.name() + "\n"
+      " - reduction : " + name + "\n");
+  EKAT_REQUIRE_MSG (f_out.get_header().get_parent()==nullptr,
+      "Error! FieldReductionBatch does not support subfields as reduction output.\n"
+      " - field name: " + f_out.name() + "\n"
+      " - reduction : " + name + "\n");
+  EKAT_REQUIRE_MSG (not f_out.is_read_only(),
+      "Error! Reduction output field is read-only.\n"
+      " - field name: " + f_out.name() + "\n"
+      " - reduction : " + name + "\n");
+
+  Request r;
+  r.type   = type;
+  r.f_out  = f_out;
+  r.offset = m_sum_size;
+  m_sum_size += f_out.get_header().get_identifier().get_layout().size();
+  m_requests.push_back(r);
+}
+
+int FieldReductionBatch::add_sum (const Field& f) {
+  return add_scalar_request(f,RequestType::Sum,"sum");
+}
+int FieldReductionBatch::add_frobenius_norm (const Field& f) {
+  return add_scalar_request(f,RequestType::FrobeniusNorm,"frobenius_norm");
+}
+int FieldReductionBatch::add_max (const Field& f) {
+  return add_scalar_request(f,RequestType::Max,"max");
+}
+int FieldReductionBatch::add_min (const Field& f) {
+  return add_scalar_request(f,RequestType::Min,"min");
+}
+
+int FieldReductionBatch::
+add_scalar_request (const Field& f, const RequestType type, const std::string& name)
+{
+  EKAT_REQUIRE_MSG (not m_setup,
+      "Error! Cannot add requests to FieldReductionBatch after the first call to start.\n");
+  EKAT_REQUIRE_MSG (f.is_allocated() and f.data_type()==get_data_type<Real>(),
+      "Error! FieldReductionBatch requires allocated fields of type Real.\n"
+      " - field name: " + f.name() + "\n"
+      " - reduction : " + name + "\n");
+
+  Request r;
+  r.type = type;
+  r.f    = f;
+  if (type==RequestType::Max or type==RequestType::Min) {
+    r.offset = m_max_size++;
+  } else {
+    r.offset = m_sum_size++;
+  }
+  m_requests.push_back(r);
+  return m_requests.size()-1;
+}
+
+void FieldReductionBatch::
+setup ()
+{
+  m_sum_buf   = KT::view_1d<Real>("reduction_batch_sum",m_sum_size);
+  m_max_buf   = KT::view_1d<Real>("reduction_batch_max",m_max_size);
+  m_sum_buf_h = Kokkos::create_mirror_view(m_sum_buf);
+  m_max_buf_h = Kokkos::create_mirror_view(m_max_buf);
+  m_setup = true;
+}
+
+void FieldReductionBatch::
+start ()
+{
+  EKAT_REQUIRE_MSG (not m_in_progress,
+      "Error! FieldReductionBatch::start called while a reduction is already in progress.\n");
+
+  if (not m_setup) {
+    setup();
+  }
+
+  // Compute local partials directly in the packed buffers
+  for (const auto& r : m_requests) {
+    auto& buf = (r.type==RequestType::Max or r.type==RequestType::Min) ? m_max_buf : m_sum_buf;
+    dev_result result(buf.data()+r.offset);
+    const bool on_dev = r.f.is_allocated() and reduce_on_device(r.f);
+    switch (r.type) {
+      case RequestType::HorizContraction:
+        horiz_contraction<Real>(r.f_out,r.f,r.weight,nullptr);
+        pack(r.f_out,buf.data()+r.offset);
+        break;
+      case RequestType::AllReduce:
+        pack(r.f_out,buf.data()+r.offset);
+        break;
+      case RequestType::Sum:
+        if (on_dev) {
+          local_sum(r.f,false,result);
+        } else {
+          Kokkos::deep_copy(result,field_sum<Real>(r.f));
+        }
+        break;
+      case RequestType::FrobeniusNorm:
+        if (on_dev) {
+          local_sum(r.f,true,result);
+        } else {
+          const auto norm = frobenius_norm<Real>(r.f);
+          Kokkos::deep_copy(result,norm*norm);
+        }
+        break;
+      case RequestType::Max:
+        if (on_dev) {
+          local_max(r.f,false,result);
+        } else {
+          Kokkos::deep_copy(result,field_max<Real>(r.f));
+        }
+        break;
+      case RequestType::Min:
+        if (on_dev) {
+          local_max(r.f,true,result);
+        } else {
+          Kokkos::deep_copy(result,-field_min<Real>(r.f));
+        }
+        break;
+      default:
+        EKAT_ERROR_MSG ("Error! Unexpected request type in FieldReductionBatch.\n");
+    }
+  }
+  Kokkos::fence();
+
+#if SCREAM_MPI_ON_DEVICE
+  Real* sum_ptr = m_sum_buf.data();
+  Real* max_ptr = m_max_buf.data();
+#else
+  Kokkos::deep_copy(m_sum_buf_h,m_sum_buf);
+  Kokkos::deep_copy(m_max_buf_h,m_max_buf);
+  Real* sum_ptr = m_sum_buf_h.data();
+  Real* max_ptr = m_max_buf_h.data();
+#endif
+
+  const auto mpi_real = ekat::get_mpi_type<Real>();
+  if (m_sum_size>0) {
+    check_mpi_call(MPI_Iallreduce(MPI_IN_PLACE,sum_ptr,m_sum_size,mpi_real,MPI_SUM,m_comm.mpi_comm(),&m_mpi_reqs[0]),
+                   "FieldReductionBatch::start, MPI_Iallreduce (sum)");
+  }
+  if (m_max_size>0) {
+    check_mpi_call(MPI_Iallreduce(MPI_IN_PLACE,max_ptr,m_max_size,mpi_real,MPI_MAX,m_comm.mpi_comm(),&m_mpi_reqs[1]),
+                   "FieldReductionBatch::start, MPI_Iallreduce (max)");
+  }
+
+  m_in_progress = true;
+  m_has_results = false;
+}
+
+void FieldReductionBatch::
+finish ()
+{
+  EKAT_REQUIRE_MSG (m_in_progress,
+      "Error! FieldReductionBatch::finish called before start.\n");
+
+  check_mpi_call(MPI_Waitall(2,m_mpi_reqs,MPI_STATUSES_IGNORE),
+                 "FieldReductionBatch::finish, MPI_Waitall");
+  m_in_progress = false;
+
+  // Scalar results are read on host, while field results are unpacked on device
+#if SCREAM_MPI_ON_DEVICE
+  Kokkos::deep_copy(m_sum_buf_h,m_sum_buf);
+  Kokkos::deep_copy(m_max_buf_h,m_max_buf);
+#else
+  Kokkos::deep_copy(m_sum_buf,m_sum_buf_h);
+#endif
+
+  for (const auto& r : m_requests) {
+    if (r.type==RequestType::HorizContraction or r.type==RequestType::AllReduce) {
+      unpack(m_sum_buf.data()+r.offset,r.f_out);
+    }
+  }
+  Kokkos::fence();
+
+  m_has_results = true;
+}
+
+Real FieldReductionBatch::
+get_value (const int handle) const
+{
+  EKAT_REQUIRE_MSG (m_has_results,
+      "Error! FieldReductionBatch::get_value called before finish.\n");
+  EKAT_REQUIRE_MSG (handle>=0 and handle<num_requests(),
+      "Error! Invalid handle in FieldReductionBatch::get_value.\n"
+      " - handle: " + std::to_string(handle) + "\n"
+      " - num requests: " + std::to_string(num_requests()) + "\n");
+
+  const auto& r = m_requests[handle];
+  switch (r.type) {
+    case RequestType::Sum:            return m_sum_buf_h(r.offset);
+    case RequestType::FrobeniusNorm:  return std::sqrt(m_sum_buf_h(r.offset));
+    case RequestType::Max:            return m_max_buf_h(r.offset);
+    case RequestType::Min:            return -m_max_buf_h(r.offset);
+    default:
+      EKAT_ERROR_MSG ("Error! Handle does not correspond to a scalar reduction.\n");
+  }
+  return 0;
+}
+
+} // namespace scream
@@ -0,0 +1,123 @@
+#ifndef SCREAM_FIELD_REDUCTION_BATCH_HPP
+#define SCREAM_FIELD_REDUCTION_BATCH_HPP
+
+#include "share/field/field.hpp"
+
+#include <ekat/mpi/ekat_comm.hpp>
+
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A class to perform many global field reductions with a single allreduce
+ *
+ * Utilities like horiz_contraction, field_sum, field_max, or frobenius_norm
+ * perform their own MPI allreduce (after a host sync), one field at a time.
+ * When many small reductions are needed at the same point of the step, the
+ * cost is dominated by MPI latency. This class collects the local partial
+ * results of all requests in one packed buffer, and posts one nonblocking
+ * allreduce for all of them (two, if both sum-like and max/min-like requests
+ * are present). If SCREAM_MPI_ON_DEVICE is on, the allreduce operates
+ * directly on the device buffer.
+ *
+ * Local partials are computed on device for fields that are not subfields.
+ * For subfields, we fall back on the host implementation of the field_utils
+ * functions. Notice that device reductions may accumulate in a different
+ * order than the (Kahan) host ones, so results may differ up to roundoff.
+ *
+ * Only fields of type Real are supported.
+ *
+ * Usage:
+ *   FieldReductionBatch rb(comm);
+ *   auto h_sum = rb.add_sum(f1);
+ *   rb.add_horiz_contraction(f_out,f_in,weight);
+ *   rb.add_all_reduce(f_partial);   // f_partial stores local partial sums
+ *   ...
+ *   rb.start();          // May overlap other work between start and finish
+ *   rb.finish();
+ *   auto s = rb.get_value(h_sum);
+ *   // f_out now stores the global contraction, and f_partial the global sums
+ *
+ * Requests are persistent: start/finish can be called as many times as needed,
+ * and will recompute all reductions with the current field values.
+ */
+
+class FieldReductionBatch
+{
+public:
+  FieldReductionBatch (const ekat::Comm& comm);
+  ~FieldReductionBatch ();
+
+  // Add reduction requests. Scalar requests return a handle, to be used in get_value.
+  // All requests must be added before the first call to start.
+  void add_horiz_contraction (const Field& f_out, const Field& f_in, const Field& weight);
+  // Sum f across ranks, in place. When start is called, f must store the local partial sums.
+  void add_all_reduce (const Field& f);
+  int add_sum            (const Field& f);
+  int add_frobenius_norm (const Field& f);
+  int add_max            (const Field& f);
+  int add_min            (const Field& f);
+
+  // Compute local partial results, and post the global reduction(s)
+  void start ();
+
+  // Wait for the global reduction(s) to complete, and store the results
+  void finish ();
+
+  // Get the result of a scalar request (must be called after finish)
+  Real get_value (const int handle) const;
+
+  int num_requests () const { return m_requests.size(); }
+  bool in_progress () const { return m_in_progress; }
+
+protected:
+
+  using KT = KokkosTypes<DefaultDevice>;
+
+  enum class RequestType {
+    HorizContraction,
+    AllReduce,
+    Sum,
+    FrobeniusNorm,
+    Max,
+    Min
+  };
+
+  struct Request {
+    RequestType type;
+    Field       f;
+    Field       f_out;    // Only for HorizContraction and AllReduce
+    Field       weight;   // Only for HorizContraction
+    int         offset;   // Offset of the result in the sum/max buffer
+  };
+
+  void add_field_request (const Field& f_out, const RequestType type, const std::string& name);
+  int add_scalar_request (const Field& f, const RequestType type, const std::string& name);
+
+  void setup ();
+
+  ekat::Comm  m_comm;
+
+  std::vector<Request>  m_requests;
+
+  // Packed buffers for requests reduced with MPI_SUM and MPI_MAX respectively.
+  // Min requests are stored (and reduced) as max of the opposite value.
+  int   m_sum_size = 0;
+  int   m_max_size = 0;
+  KT::view_1d<Real>                 m_sum_buf;
+  KT::view_1d<Real>                 m_max_buf;
+  KT::view_1d<Real>::HostMirror     m_sum_buf_h;
+  KT::view_1d<Real>::HostMirror     m_max_buf_h;
+
+  MPI_Request   m_mpi_reqs[2];
+
+  bool  m_setup       = false;
+  bool  m_in_progress = false;
+  bool  m_has_results = false;
+};
+
+} // namespace scream
+
+#endif // SCREAM_FIELD_REDUCTION_BATCH_HPP
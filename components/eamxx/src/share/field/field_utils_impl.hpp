@@ -369,6 +369,8 @@ void horiz_contraction(const Field &f_out, const Field &f_in,
     // TODO: use device-side MPI calls
     // TODO: the dev ptr causes problems; revisit this later
     // TODO: doing cuda-aware MPI allreduce would be ~10% faster
+    // NOTE: to batch many contractions in a single (nonblocking) allreduce,
+    //       use FieldReductionBatch instead.
     Kokkos::fence();
     f_out.sync_to_host();
     comm->all_reduce(f_out.template get_internal_view_data<ST, Host>(),
@@ -2,6 +2,8 @@
 
 #include "share/field/field_utils.hpp"
 
+#include <ekat/kokkos/ekat_kokkos_utils.hpp>
+
 namespace scream
 {
 
@@ -166,4 +168,312 @@ GridImportExport (const std::shared_ptr<const AbstractGrid>& unique,
   Kokkos::deep_copy(m_num_imports_per_pid,m_num_imports_per_pid_h);
 }
 
+GridImportExport::
+~GridImportExport ()
+{
+  free_requests();
+}
+
+void GridImportExport::
+setup_fields_transfer (const std::vector<Field>& unique_fields,
+                       const std::vector<Field>& overlapped_fields)
+{
+  using namespace ShortFieldTagsNames;
+
+  EKAT_REQUIRE_MSG (unique_fields.size()==overlapped_fields.size(),
+      "Error! Unique and overlapped fields lists have different sizes.\n"
+      " - num unique fields    : " + std::to_string(unique_fields.size()) + "\n"
+      " - num overlapped fields: " + std::to_string(overlapped_fields.size()) + "\n");
+
+  free_requests();
+
+  const int nranks = m_comm.size();
+  const int nexp = m_export_lids.size();
+  const int nimp = m_import_lids.size();
+
+  // Returns the (allocated) size of each column of the field
+  auto get_col_size = [](const Field& f, const std::shared_ptr<const AbstractGrid>& grid) {
+    const auto& fh = f.get_header();
+    const auto& fl = fh.get_identifier().get_layout();
+    const auto& ap = fh.get_alloc_properties();
+    EKAT_REQUIRE_MSG (f.is_allocated() and f.data_type()==DataType::RealType,
+        "Error! GridImportExport can only transfer allocated Real fields.\n"
+        " - field name: " + f.name() + "\n");
+    EKAT_REQUIRE_MSG (fl.rank()>0 and fl.tag(0)==COL and fl.dim(0)==grid->get_num_local_dofs(),
+        "Error! GridImportExport can only transfer fields with COL as first dimension.\n"
+        " - field name  : " + f.name() + "\n"
+        " - field layout: " + fl.to_string() + "\n"
+        " - grid name   : " + grid->name() + "\n");
+    EKAT_REQUIRE_MSG (not ap.is_subfield(),
+        "Error! GridImportExport cannot transfer subfields.\n"
+        " - field name: " + f.name() + "\n");
+    return static_cast<int>(ap.get_num_scalars()/fl.dim(0));
+  };
+
+  m_num_fields   = unique_fields.size();
+  m_buf_col_size = 0;
+  m_max_col_size = 1;
+  m_unique_fields = view_1d<FieldEntry>("GridImportExport::unique_fields",m_num_fields);
+  m_ov_fields     = view_1d<FieldEntry>("GridImportExport::ov_fields",m_num_fields);
+  auto unique_fields_h = Kokkos::create_mirror_view(m_unique_fields);
+  auto ov_fields_h     = Kokkos::create_mirror_view(m_ov_fields);
+  for (int i=0; i<m_num_fields; ++i) {
+    const auto& fu = unique_fields[i];
+    const auto& fo = overlapped_fields[i];
+    const int col_size = get_col_size(fu,m_unique);
+    EKAT_REQUIRE_MSG (get_col_size(fo,m_overlapped)==col_size,
+        "Error! Unique and overlapped fields have different column sizes.\n"
+        " - unique field name    : " + fu.name() + "\n"
+        " - overlapped field name: " + fo.name() + "\n");
+
+    unique_fields_h(i) = {fu.get_internal_view_data<Real>(),col_size,m_buf_col_size};
+    ov_fields_h(i)     = {fo.get_internal_view_data<Real>(),col_size,m_buf_col_size};
+    m_buf_col_size += col_size;
+    m_max_col_size = std::max(m_max_col_size,col_size);
+  }
+  Kokkos::deep_copy(m_unique_fields,unique_fields_h);
+  Kokkos::deep_copy(m_ov_fields,ov_fields_h);
+
+  // Create the buffers
+  m_unique_buf = view_1d<Real>("GridImportExport::unique_buf",nexp*m_buf_col_size);
+  m_ov_buf     = view_1d<Real>("GridImportExport::ov_buf",nimp*m_buf_col_size);
+  m_mpi_unique_buf = Kokkos::create_mirror_view(typename decltype(m_mpi_unique_buf)::execution_space(),m_unique_buf);
+  m_mpi_ov_buf     = Kokkos::create_mirror_view(typename decltype(m_mpi_ov_buf)::execution_space(),m_ov_buf);
+
+  // For gather, find all the copies of each unique lid (in rank order, since exports are sorted by pid)
+  std::map<int,std::vector<int>> lid2exports;
+  for (int i=0; i<nexp; ++i) {
+    lid2exports[m_export_lids_h(i)].push_back(i);
+  }
+  const int ngather = lid2exports.size();
+  m_gather_lids    = view_1d<int>("GridImportExport::gather_lids",ngather);
+  m_gather_offsets = view_1d<int>("GridImportExport::gather_offsets",ngather+1);
+  m_gather_exports = view_1d<int>("GridImportExport::gather_exports",nexp);
+  auto gather_lids_h    = Kokkos::create_mirror_view(m_gather_lids);
+  auto gather_offsets_h = Kokkos::create_mirror_view(m_gather_offsets);
+  auto gather_exports_h = Kokkos::create_mirror_view(m_gather_exports);
+  int pos = 0, ig = 0;
+  gather_offsets_h(0) = 0;
+  for (const auto& [lid,exports] : lid2exports) {
+    gather_lids_h(ig) = lid;
+    for (auto iexp : exports) {
+      gather_exports_h(pos++) = iexp;
+    }
+    gather_offsets_h(++ig) = pos;
+  }
+  Kokkos::deep_copy(m_gather_lids,gather_lids_h);
+  Kokkos::deep_copy(m_gather_offsets,gather_offsets_h);
+  Kokkos::deep_copy(m_gather_exports,gather_exports_h);
+
+  // Create the persistent requests. Exports and imports are sorted by pid,
+  // so the data of each remote rank is a contiguous chunk of the buffers.
+  const auto mpi_comm = m_comm.mpi_comm();
+  const auto mpi_real = ekat::get_mpi_type<Real>();
+  const int scatter_tag = 0;
+  const int gather_tag  = 1;
+  for (int pid=0, exp_offset=0, imp_offset=0; pid<nranks; ++pid) {
+    const int nexp_pid = m_num_exports_per_pid_h(pid);
+    const int nimp_pid = m_num_imports_per_pid_h(pid);
+    if (nexp_pid>0) {
+      auto ptr = m_mpi_unique_buf.data() + exp_offset*m_buf_col_size;
+      auto count = nexp_pid*m_buf_col_size;
+      check_mpi_call(MPI_Send_init(ptr,count,mpi_real,pid,scatter_tag,mpi_comm,&m_scatter_send_req.emplace_back()),
+                     "GridImportExport::setup_fields_transfer, creating scatter send request");
+      check_mpi_call(MPI_Recv_init(ptr,count,mpi_real,pid,gather_tag,mpi_comm,&m_gather_recv_req.emplace_back()),
+                     "GridImportExport::setup_fields_transfer, creating gather recv request");
+    }
+    if (nimp_pid>0) {
+      auto ptr = m_mpi_ov_buf.data() + imp_offset*m_buf_col_size;
+      auto count = nimp_pid*m_buf_col_size;
+      check_mpi_call(MPI_Recv_init(ptr,count,mpi_real,pid,scatter_tag,mpi_comm,&m_scatter_recv_req.emplace_back()),
+                     "GridImportExport::setup_fields_transfer, creating scatter recv request");
+      check_mpi_call(MPI_Send_init(ptr,count,mpi_real,pid,gather_tag,mpi_comm,&m_gather_send_req.emplace_back()),
+                     "GridImportExport::setup_fields_transfer, creating gather send request");
+    }
+    exp_offset += nexp_pid;
+    imp_offset += nimp_pid;
+  }
+}
+
+void GridImportExport::scatter_fields ()
+{
+  EKAT_REQUIRE_MSG (m_num_fields>=0,
+      "Error! Cannot scatter fields before calling setup_fields_transfer.\n");
+
+  // Fire the recv requests right away, so that if some other ranks
+  // is done packing before us, we can start receiving their data
+  if (not m_scatter_recv_req.empty()) {
+    check_mpi_call(MPI_Startall(m_scatter_recv_req.size(),m_scatter_recv_req.data()),
+                   "GridImportExport::scatter_fields, starting recv requests");
+  }
+
+  pack(m_unique_fields,m_export_lids,m_unique_buf);
+  Kokkos::fence();
+  if (not MpiOnDev) {
+    Kokkos::deep_copy(m_mpi_unique_buf,m_unique_buf);
+  }
+  if (not m_scatter_send_req.empty()) {
+    check_mpi_call(MPI_Startall(m_scatter_send_req.size(),m_scatter_send_req.data()),
+                   "GridImportExport::scatter_fields, starting send requests");
+  }
+
+  if (not m_scatter_recv_req.empty()) {
+    check_mpi_call(MPI_Waitall(m_scatter_recv_req.size(),m_scatter_recv_req.data(),MPI_STATUSES_IGNORE),
+                   "GridImportExport::scatter_fields, waiting on recv requests");
+  }
+  if (not MpiOnDev) {
+    Kokkos::deep_copy(m_ov_buf,m_mpi_ov_buf);
+  }
+  unpack(m_ov_fields,m_import_lids,m_ov_buf);
+
+  if (not m_scatter_send_req.empty()) {
+    check_mpi_call(MPI_Waitall(m_scatter_send_req.size(),m_scatter_send_req.data(),MPI_STATUSES_IGNORE),
+                   "GridImportExport::scatter_fields, waiting on send requests");
+  }
+}
+
+void GridImportExport::gather_fields ()
+{
+  EKAT_REQUIRE_MSG (m_num_fields>=0,
+      "Error! Cannot gather fields before calling setup_fields_transfer.\n");
+
+  if (not m_gather_recv_req.empty()) {
+    check_mpi_call(MPI_Startall(m_gather_recv_req.size(),m_gather_recv_req.data()),
+                   "GridImportExport::gather_fields, starting recv requests");
+  }
+
+  pack(m_ov_fields,m_import_lids,m_ov_buf);
+  Kokkos::fence();
+  if (not MpiOnDev) {
+    Kokkos::deep_copy(m_mpi_ov_buf,m_ov_buf);
+  }
+  if (not m_gather_send_req.empty()) {
+    check_mpi_call(MPI_Startall(m_gather_send_req.size(),m_gather_send_req.data()),
+                   "GridImportExport::gather_fields, starting send requests");
+  }
+
+  if (not m_gather_recv_req.empty()) {
+    check_mpi_call(MPI_Waitall(m_gather_recv_req.size(),m_gather_recv_req.data(),MPI_STATUSES_IGNORE),
+                   "GridImportExport::gather_fields, waiting on recv requests");
+  }
+  if (not MpiOnDev) {
+    Kokkos::deep_copy(m_unique_buf,m_mpi_unique_buf);
+  }
+  unpack_and_sum();
+
+  if (not m_gather_send_req.empty()) {
+    check_mpi_call(MPI_Waitall(m_gather_send_req.size(),m_gather_send_req.data(),MPI_STATUSES_IGNORE),
+                   "GridImportExport::gather_fields, waiting on send requests");
+  }
+}
+
+void GridImportExport::
+pack (const view_1d<FieldEntry>& fields, const view_1d<int>& lids,
+      const view_1d<Real>& buf) const
+{
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+
+  const int nlids   = lids.size();
+  const int nfields = m_num_fields;
+  const int buf_col_size = m_buf_col_size;
+  if (nlids*nfields==0) {
+    return;
+  }
+
+  // One team per (column,field) pair
+  const auto policy = ESU::get_default_team_policy(nlids*nfields,m_max_col_size);
+  Kokkos::parallel_for("GridImportExport::pack",policy,
+                       KOKKOS_LAMBDA(const KT::MemberType& team) {
+    const int i = team.league_rank() / nfields;
+    const auto& f = fields(team.league_rank() % nfields);
+    const Real* src = f.data + lids(i)*f.col_size;
+          Real* dst = buf.data() + i*buf_col_size + f.offset;
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,f.col_size),
+                         [&](const int k) {
+      dst[k] = src[k];
+    });
+  });
+}
+
+void GridImportExport::
+unpack (const view_1d<FieldEntry>& fields, const view_1d<int>& lids,
+        const view_1d<Real>& buf) const
+{
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+
+  const int nlids   = lids.size();
+  const int nfields = m_num_fields;
+  const int buf_col_size = m_buf_col_size;
+  if (nlids*nfields==0) {
+    return;
+  }
+
+  // One team per (column,field) pair
+  const auto policy = ESU::get_default_team_policy(nlids*nfields,m_max_col_size);
+  Kokkos::parallel_for("GridImportExport::unpack",policy,
+                       KOKKOS_LAMBDA(const KT::MemberType& team) {
+    const int i = team.league_rank() / nfields;
+    const auto& f = fields(team.league_rank() % nfields);
+    const Real* src = buf.data() + i*buf_col_size + f.offset;
+          Real* dst = f.data + lids(i)*f.col_size;
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,f.col_size),
+                         [&](const int k) {
+      dst[k] = src[k];
+    });
+  });
+}
+
+void GridImportExport::unpack_and_sum () const
+{
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+
+  const int nlids   = m_gather_lids.size();
+  const int nfields = m_num_fields;
+  const int buf_col_size = m_buf_col_size;
+  if (nlids*nfields==0) {
+    return;
+  }
+
+  const auto fields  = m_unique_fields;
+  const auto lids    = m_gather_lids;
+  const auto offsets = m_gather_offsets;
+  const auto exports = m_gather_exports;
+  const auto buf     = m_unique_buf;
+
+  // One team per (column,field) pair. Each entry sums its copies in rank order,
+  // so there is no need for atomics, and the result is reproducible
+  const auto policy = ESU::get_default_team_policy(nlids*nfields,m_max_col_size);
+  Kokkos::parallel_for("GridImportExport::unpack_and_sum",policy,
+                       KOKKOS_LAMBDA(const KT::MemberType& team) {
+    const int i = team.league_rank() / nfields;
+    const auto& f = fields(team.league_rank() % nfields);
+    Real* dst = f.data + lids(i)*f.col_size;
+    const int beg = offsets(i);
+    const int end = offsets(i+1);
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(team,f.col_size),
+                         [&](const int k) {
+      Real sum = 0;
+      for (int j=beg; j<end; ++j) {
+        sum += buf(exports(j)*buf_col_size + f.offset + k);
+      }
+      dst[k] = sum;
+    });
+  });
+}
+
+void GridImportExport::free_requests ()
+{
+  // Persistent requests must be freed, but not after MPI was finalized
+  int finalized;
+  MPI_Finalized(&finalized);
+  for (auto reqs : {&m_scatter_send_req,&m_scatter_recv_req,&m_gather_send_req,&m_gather_recv_req}) {
+    if (not finalized) {
+      for (auto& req : *reqs) {
+        MPI_Request_free(&req);
+      }
+    }
+    reqs->clear();
+  }
+}
+
 } // namespace scream
@@ -2,8 +2,10 @@
 #define EAMXX_GRID_IMPORT_EXPORT_HPP
 
 #include "share/grid/abstract_grid.hpp"
+#include "share/field/field.hpp"
 #include "share/eamxx_types.hpp"       // For KokkosTypes
 #include "share/util/eamxx_utils.hpp"  // For check_mpi_call
+#include "eamxx_config.h"              // For SCREAM_MPI_ON_DEVICE
 
 #include <ekat/mpi/ekat_comm.hpp>
 #include <mpi.h> // We do some direct MPI calls
@@ -38,17 +40,23 @@ namespace scream
  * for ease of use in non-performance critical code.
  * On the other hand, the import/export data (pids/lids) can
  * be used both on host and device, for more efficient pack/unpack methods.
+ *
+ * For repeated transfers of the same set of fields (e.g., at every time step),
+ * use setup_fields_transfer once, and then scatter_fields/gather_fields.
+ * These pack/unpack the columns of all fields on device, with a single kernel
+ * per stage, and exchange data with persistent MPI requests, so that the only
+ * runtime cost is the data movement itself.
  */
 
 class GridImportExport {
 public:
   using KT = KokkosTypes<DefaultDevice>;
   template<typename T>
-  using view_1d = typename KT::view_1d<int>;
+  using view_1d = typename KT::template view_1d<T>;
 
   GridImportExport (const std::shared_ptr<const AbstractGrid>& unique,
                     const std::shared_ptr<const AbstractGrid>& overlapped);
-  ~GridImportExport () = default;
+  ~GridImportExport ();
 
   template<typename T>
   void scatter (const MPI_Datatype mpi_data_t,
@@ -60,6 +68,23 @@ public:
                const std::map<int,std::vector<T>>& src,
                      std::map<int,std::vector<T>>& dst) const;
 
+  // Setup the persistent plan to transfer columns of the input fields between
+  // the two grids. The i-th unique field is paired with the i-th overlapped field.
+  // All fields must be Real valued, have COL as first dimension, not be subfields,
+  // and paired fields must have the same allocation size for each column.
+  // Can be called again, to change the set of fields.
+  void setup_fields_transfer (const std::vector<Field>& unique_fields,
+                              const std::vector<Field>& overlapped_fields);
+
+  // Copy the columns of the unique fields into the overlapped fields
+  void scatter_fields ();
+
+  // Copy the columns of the overlapped fields into the unique fields. If the same
+  // gid appears on several ranks in the overlapped grid, the unique field gets the sum
+  // of all the copies (summed in rank order, so that the result is reproducible).
+  // Columns of the unique grid not present in the overlapped grid are left untouched.
+  void gather_fields ();
+
   view_1d<int> num_exports_per_pid () const { return m_num_exports_per_pid; }
   view_1d<int> num_imports_per_pid () const { return m_num_imports_per_pid; }
 
@@ -76,10 +101,41 @@ public:
   view_1d<int>::HostMirror export_pids_h () const { return m_export_pids_h; }
   view_1d<int>::HostMirror export_lids_h () const { return m_export_lids_h; }
 
+#ifdef KOKKOS_ENABLE_CUDA
+public:
+#endif
+  // A field involved in the transfer. In the pack/unpack buffers, the data
+  // of a column is stored contiguously for all fields (field i at offset).
+  struct FieldEntry {
+    Real* data;
+    int   col_size;
+    int   offset;
+  };
+
+  // Pack/unpack columns lids(i) of all fields in/from buf(i*m_buf_col_size+...)
+  void pack   (const view_1d<FieldEntry>& fields, const view_1d<int>& lids,
+               const view_1d<Real>& buf) const;
+  void unpack (const view_1d<FieldEntry>& fields, const view_1d<int>& lids,
+               const view_1d<Real>& buf) const;
+
+  // Unpack in the unique fields, summing all copies of each column
+  void unpack_and_sum () const;
+
 protected:
 
+  void free_requests ();
+
   using gid_type = AbstractGrid::gid_type;
 
+  // If MpiOnDev=true, we pass device pointers to MPI. Otherwise, we use host mirrors.
+  static constexpr bool MpiOnDev = SCREAM_MPI_ON_DEVICE;
+  template<typename T>
+  using mpi_view_1d = typename std::conditional<
+                        MpiOnDev,
+                        view_1d<T>,
+                        typename view_1d<T>::HostMirror
+                      >::type;
+
   std::shared_ptr<const AbstractGrid>   m_unique;
   std::shared_ptr<const AbstractGrid>   m_overlapped;
 
@@ -102,6 +158,34 @@ protected:
   view_1d<int>::HostMirror  m_num_exports_per_pid_h;
 
   ekat::Comm    m_comm;
+
+  // ----- Persistent plan for fields transfers ----- //
+
+  view_1d<FieldEntry>   m_unique_fields;
+  view_1d<FieldEntry>   m_ov_fields;
+  int                   m_num_fields    = -1;  // -1 means setup_fields_transfer was not called
+  int                   m_buf_col_size  = 0;
+  int                   m_max_col_size  = 0;
+
+  // Buffers for the unique side (one column per export) and the overlapped side
+  // (one column per import). If MpiOnDev=true, the mpi views alias the others.
+  view_1d<Real>         m_unique_buf;
+  view_1d<Real>         m_ov_buf;
+  mpi_view_1d<Real>     m_mpi_unique_buf;
+  mpi_view_1d<Real>     m_mpi_ov_buf;
+
+  // For gather_fields: the unique lids that receive data, and, for each of them,
+  // the range [m_gather_offsets(i),m_gather_offsets(i+1)) of entries of
+  // m_gather_exports, which stores the export indices of its copies (in rank order)
+  view_1d<int>          m_gather_lids;
+  view_1d<int>          m_gather_offsets;
+  view_1d<int>          m_gather_exports;
+
+  // Persistent requests for scatter (unique->overlapped) and gather (overlapped->unique)
+  std::vector<MPI_Request>  m_scatter_send_req;
+  std::vector<MPI_Request>  m_scatter_recv_req;
+  std::vector<MPI_Request>  m_gather_send_req;
+  std::vector<MPI_Request>  m_gather_recv_req;
 };
 
 // --------------------- IMPLEMENTATION ------------------------ //
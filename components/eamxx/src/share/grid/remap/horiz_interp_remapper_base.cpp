@@ -31,8 +31,11 @@ HorizInterpRemapperBase (const grid_ptr_type& fine_grid,
   // This is a special remapper. We only go in one direction
   m_bwd_allowed = false;
 
-  // Get the remap data (if not already present, it will be built)
-  auto& data = s_remapper_data[m_map_file];
+  // Get the remap data (if not already present, it will be built). The data depends on
+  // the fine grid (and its decomposition) and on the remap type, so include them in the key.
+  m_data_key = m_map_file + "@" + m_fine_grid->name()
+             + (m_type==InterpType::Refine ? "@refine" : "@coarsen");
+  auto& data = s_remapper_data[m_data_key];
   if (data.num_customers==0) {
     data.build(m_map_file,m_fine_grid,m_comm,m_type);
   }
@@ -73,7 +76,7 @@ HorizInterpRemapperBase (const grid_ptr_type& fine_grid,
 HorizInterpRemapperBase::
 ~HorizInterpRemapperBase ()
 {
-  auto it = s_remapper_data.find(m_map_file);
+  auto it = s_remapper_data.find(m_data_key);
   if (it==s_remapper_data.end()) {
     // This would be very suspicious. But since the error is "benign",
     // and since we want to avoid throwing inside a destructor, just issue a warning.
@@ -68,10 +68,12 @@ public:
   view_1d<int>    m_col_lids;
   view_1d<Real>   m_weights;
 
-  // Keep track of this, since we need to tell the remap data repo
-  // we are releasing the data for our map file.
   std::string     m_map_file;
 
+  // Keep track of this, since we need to tell the remap data repo
+  // we are releasing the data for our map file and fine grid.
+  std::string     m_data_key;
+
   InterpType      m_type;
 
   ekat::Comm      m_comm;
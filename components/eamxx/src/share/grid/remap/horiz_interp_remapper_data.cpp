@@ -3,13 +3,72 @@
 #include "share/grid/point_grid.hpp"
 #include "share/grid/grid_import_export.hpp"
 #include "share/io/eamxx_scorpio_interface.hpp"
+#include "share/util/eamxx_utils.hpp"  // For check_mpi_call
 
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
 #include <numeric>
+#include <sstream>
 
 namespace scream {
 
+namespace {
+
+// 64-bit FNV-1a hash of a sequence of bytes
+constexpr std::uint64_t fnv_offset = 14695981039346656037ULL;
+constexpr std::uint64_t fnv_prime  = 1099511628211ULL;
+
+std::uint64_t fnv1a (const void* data, const std::size_t n, std::uint64_t h = fnv_offset)
+{
+  auto bytes = reinterpret_cast<const unsigned char*>(data);
+  for (std::size_t i=0; i<n; ++i) {
+    h ^= bytes[i];
+    h *= fnv_prime;
+  }
+  return h;
+}
+
+// Combine the hashes of all ranks, in rank order
+std::uint64_t gather_hashes (const std::uint64_t h, const ekat::Comm& comm)
+{
+  std::vector<std::uint64_t> all (comm.size());
+  check_mpi_call(MPI_Allgather(&h,1,MPI_UINT64_T,all.data(),1,MPI_UINT64_T,comm.mpi_comm()),
+                 "gather_hashes, MPI_Allgather");
+  return fnv1a(all.data(),all.size()*sizeof(std::uint64_t));
+}
+
+template<typename T>
+void write_vector (std::ofstream& out, const T* data, const std::size_t n)
+{
+  const std::uint64_t size = n;
+  out.write(reinterpret_cast<const char*>(&size),sizeof(size));
+  out.write(reinterpret_cast<const char*>(data),n*sizeof(T));
+}
+
+template<typename T>
+bool read_vector (std::ifstream& in, std::vector<T>& v)
+{
+  std::uint64_t size;
+  in.read(reinterpret_cast<char*>(&size),sizeof(size));
+  if (not in.good()) {
+    return false;
+  }
+  v.resize(size);
+  in.read(reinterpret_cast<char*>(v.data()),size*sizeof(T));
+  return in.good();
+}
+
+constexpr char cache_magic[8] = {'E','A','M','X','X','H','R','D'};
+
+} // anonymous namespace
+
 // --------------- HorizRemapperData ---------------- //
 
+std::string HorizRemapperData::s_cache_dir = "";
+std::shared_ptr<ekat::logger::LoggerBase> HorizRemapperData::s_logger;
+
 void HorizRemapperData::
 build (const std::string& map_file,
        const std::shared_ptr<const AbstractGrid>& fine_grid_in,
@@ -19,6 +78,37 @@ build (const std::string& map_file,
   comm = comm_in;
   fine_grid = fine_grid_in;
   type = type_in;
+  loaded_from_cache = false;
+
+  std::string cache_file;
+  std::uint64_t key = 0;
+  if (s_cache_dir!="") {
+    // Only read the map file header, which is cheap. Validate it here too, since
+    // if we load the data from the cache we never get to the checks in get_my_triplets
+    scorpio::register_file(map_file,scorpio::FileMode::Read);
+    const int n_a = scorpio::get_dimlen(map_file,"n_a");
+    const int n_b = scorpio::get_dimlen(map_file,"n_b");
+    const int n_s = scorpio::get_dimlen(map_file,"n_s");
+    scorpio::release_file(map_file);
+    check_map_dims(map_file,n_a,n_b);
+
+    key = compute_cache_key(map_file,n_s);
+    std::stringstream ss;
+    ss << s_cache_dir << "/hremap_" << std::hex << std::setw(16) << std::setfill('0') << key
+       << std::dec << "_" << comm.rank() << ".bin";
+    cache_file = ss.str();
+
+    // All ranks must agree on whether to use the cache
+    CacheData data;
+    int ok = read_cache_file(cache_file,key,data) ? 1 : 0;
+    int all_ok;
+    comm.all_reduce(&ok,&all_ok,1,MPI_MIN);
+    if (all_ok==1) {
+      set_from_cache_data(data);
+      loaded_from_cache = true;
+      return;
+    }
+  }
 
   // Gather sparse matrix triplets needed by this rank
   auto my_triplets = get_my_triplets (map_file);
@@ -28,6 +118,167 @@ build (const std::string& map_file,
 
   // Create crs matrix
   create_crs_matrix_structures (my_triplets);
+
+  if (cache_file!="") {
+    if (comm.am_i_root()) {
+      std::error_code ec;
+      std::filesystem::create_directories(s_cache_dir,ec);
+    }
+    comm.barrier();
+    write_cache_file(cache_file,key);
+  }
+}
+
+std::uint64_t HorizRemapperData::
+decomposition_hash (const AbstractGrid& grid)
+{
+  const auto gids_h = grid.get_dofs_gids().get_view<const gid_type*,Host>();
+  const auto h = fnv1a(gids_h.data(),gids_h.size()*sizeof(gid_type));
+  return gather_hashes(h,grid.get_comm());
+}
+
+void HorizRemapperData::
+check_map_dims (const std::string& map_file, const int n_a, const int n_b) const
+{
+  // Figure out if we are reading the right map, that is:
+  //  - n_a or n_b matches the fine grid ncols
+  //  - the map "direction" (fine->coarse or coarse->fine) matches m_type
+  const int ncols_fine = fine_grid->get_num_global_dofs();
+  EKAT_REQUIRE_MSG (n_a==ncols_fine or n_b==ncols_fine,
+      "Error! The input map seems incompatible with the remapper fine grid.\n"
+      " - map file: " + map_file + "\n"
+      " - map file n_a: " + std::to_string(n_a) + "\n"
+      " - map file n_b: " + std::to_string(n_b) + "\n"
+      " - fine grid ncols: " + std::to_string(ncols_fine) + "\n");
+  const bool map_is_coarsening = n_a==ncols_fine;
+  EKAT_REQUIRE_MSG (map_is_coarsening==(type==InterpType::Coarsen),
+      "Error! The input map seems incompatible with the remapper type.\n"
+      " - map file: " + map_file + "\n"
+      " - map file n_a: " + std::to_string(n_a) + "\n"
+      " - map file n_b: " + std::to_string(n_b) + "\n"
+      " - fine grid ncols: " + std::to_string(ncols_fine) + "\n"
+      " - remapper type: " + std::string(type==InterpType::Refine ? "refine" : "coarsen") + "\n");
+}
+
+std::uint64_t HorizRemapperData::
+compute_cache_key (const std::string& map_file, const int n_s) const
+{
+  // Hashing the map file content would require reading the whole file, which is what
+  // the cache is meant to avoid. Use its metadata instead: a regenerated map file
+  // has a different modification time. Only root stats the file, to avoid
+  // hammering the file system, and broadcasts the result.
+  std::uint64_t map_hash = 0;
+  if (comm.am_i_root()) {
+    namespace fs = std::filesystem;
+    std::error_code ec;
+    const auto path  = fs::absolute(map_file,ec).string();
+    const auto size  = static_cast<std::uint64_t>(fs::file_size(map_file,ec));
+    const auto mtime = static_cast<std::uint64_t>(fs::last_write_time(map_file,ec).time_since_epoch().count());
+    EKAT_REQUIRE_MSG (not ec,
+        "Error! Could not retrieve the map file metadata.\n"
+        " - map file: " + map_file + "\n"
+        " - error   : " + ec.message() + "\n");
+    const std::uint64_t vals[3] = {size, mtime, static_cast<std::uint64_t>(n_s)};
+    map_hash = fnv1a(vals,sizeof(vals),fnv1a(path.data(),path.size()));
+  }
+  check_mpi_call(MPI_Bcast(&map_hash,1,MPI_UINT64_T,comm.root_rank(),comm.mpi_comm()),
+                 "HorizRemapperData::compute_cache_key, MPI_Bcast");
+
+  // Anything that changes the content or the layout of the cache files must be hashed.
+  // NOTE: the decomposition hash is already specific to the number of ranks
+  const std::uint64_t vals[5] = {
+    map_hash,
+    decomposition_hash(*fine_grid),
+    static_cast<std::uint64_t>(type==InterpType::Refine ? 0 : 1),
+    sizeof(Real),
+    sizeof(gid_type)
+  };
+  return fnv1a(vals,sizeof(vals));
+}
+
+bool HorizRemapperData::
+read_cache_file (const std::string& cache_file, const std::uint64_t key, CacheData& data) const
+{
+  std::ifstream in (cache_file, std::ios::binary);
+  if (not in.is_open()) {
+    return false;
+  }
+
+  char magic[8];
+  std::uint64_t file_key;
+  in.read(magic,sizeof(magic));
+  in.read(reinterpret_cast<char*>(&file_key),sizeof(file_key));
+  if (not in.good() or not std::equal(magic,magic+8,cache_magic) or file_key!=key) {
+    return false;
+  }
+
+  return read_vector(in,data.ov_coarse_gids) and
+         read_vector(in,data.coarse_gids) and
+         read_vector(in,data.row_offsets) and
+         read_vector(in,data.col_lids) and
+         read_vector(in,data.weights);
+}
+
+void HorizRemapperData::
+write_cache_file (const std::string& cache_file, const std::uint64_t key) const
+{
+  const auto ov_gids_h   = ov_coarse_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  const auto gids_h      = coarse_grid->get_dofs_gids().get_view<const gid_type*,Host>();
+  const auto row_offsets_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),row_offsets);
+  const auto col_lids_h    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),col_lids);
+  const auto weights_h     = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),weights);
+
+  // Write to a temp file, and rename it when done, so that a failed (or concurrent)
+  // run cannot leave a partially written cache file behind.
+  const auto tmp_file = cache_file + ".tmp";
+  std::ofstream out (tmp_file, std::ios::binary);
+  out.write(cache_magic,sizeof(cache_magic));
+  out.write(reinterpret_cast<const char*>(&key),sizeof(key));
+  write_vector(out,ov_gids_h.data(),ov_gids_h.size());
+  write_vector(out,gids_h.data(),gids_h.size());
+  write_vector(out,row_offsets_h.data(),row_offsets_h.size());
+  write_vector(out,col_lids_h.data(),col_lids_h.size());
+  write_vector(out,weights_h.data(),weights_h.size());
+  out.close();
+
+  std::error_code ec;
+  if (out.good()) {
+    std::filesystem::rename(tmp_file,cache_file,ec);
+  }
+  if (not out.good() or ec) {
+    // The cache is only an optimization, so don't crash
+    if (s_logger) {
+      s_logger->warn("[HorizRemapperData] Could not write horiz remap data cache file.\n"
+                     " - cache file: " + cache_file);
+    }
+    std::filesystem::remove(tmp_file,ec);
+  }
+}
+
+void HorizRemapperData::
+set_from_cache_data (const CacheData& data)
+{
+  auto create_grid = [&](const std::string& name, const std::vector<gid_type>& gids) {
+    auto grid = std::make_shared<PointGrid>(name,gids.size(),0,comm);
+    auto gids_h = grid->get_dofs_gids().get_view<gid_type*,Host>();
+    std::copy(gids.begin(),gids.end(),gids_h.data());
+    grid->get_dofs_gids().sync_to_dev();
+    return grid;
+  };
+  ov_coarse_grid = create_grid("ov_coarse_grid",data.ov_coarse_gids);
+  coarse_grid    = create_grid("coarse_grid",data.coarse_gids);
+
+  auto to_device = [](const auto& v, const std::string& name) {
+    using value_type = typename std::decay_t<decltype(v)>::value_type;
+    view_1d<value_type> d (name,v.size());
+    auto h = Kokkos::create_mirror_view(d);
+    std::copy(v.begin(),v.end(),h.data());
+    Kokkos::deep_copy(d,h);
+    return d;
+  };
+  row_offsets = to_device(data.row_offsets,"");
+  col_lids    = to_device(data.col_lids,"");
+  weights     = to_device(data.weights,"");
 }
 
 auto HorizRemapperData::
@@ -55,26 +306,10 @@ get_my_triplets (const std::string& map_file) const
   std::vector<gid_type> rows(nlweights+1,-1);
   std::vector<Real>  S(nlweights+1,0);
 
-  // Figure out if we are reading the right map, that is:
-  //  - n_a or n_b matches the fine grid ncols
-  //  - the map "direction" (fine->coarse or coarse->fine) matches m_type
+  // Figure out if we are reading the right map
   const int n_a = scorpio::get_dimlen(map_file,"n_a");
   const int n_b = scorpio::get_dimlen(map_file,"n_b");
-  const int ncols_fine = fine_grid->get_num_global_dofs();
-  EKAT_REQUIRE_MSG (n_a==ncols_fine or n_b==ncols_fine,
-      "Error! The input map seems incompatible with the remapper fine grid.\n"
-      " - map file: " + map_file + "\n"
-      " - map file n_a: " + std::to_string(n_a) + "\n"
-      " - map file n_b: " + std::to_string(n_b) + "\n"
-      " - fine grid ncols: " + std::to_string(ncols_fine) + "\n");
-  const bool map_is_coarsening = n_a==ncols_fine;
-  EKAT_REQUIRE_MSG (map_is_coarsening==(type==InterpType::Coarsen),
-      "Error! The input map seems incompatible with the remapper type.\n"
-      " - map file: " + map_file + "\n"
-      " - map file n_a: " + std::to_string(n_a) + "\n"
-      " - map file n_b: " + std::to_string(n_b) + "\n"
-      " - fine grid ncols: " + std::to_string(ncols_fine) + "\n"
-      " - remapper type: " + std::string(type==InterpType::Refine ? "refine" : "coarsen") + "\n");
+  check_map_dims(map_file,n_a,n_b);
 
   scorpio::read_var(map_file,"col",cols.data());
   scorpio::read_var(map_file,"row",rows.data());
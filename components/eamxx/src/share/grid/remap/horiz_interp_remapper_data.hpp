@@ -5,10 +5,13 @@
 #include "share/grid/remap/abstract_remapper.hpp"
 
 #include <ekat/mpi/ekat_comm.hpp>
+#include <ekat/logging/ekat_logger.hpp>
 
+#include <cstdint>
 #include <memory>
 #include <map>
 #include <string>
+#include <vector>
 
 namespace scream {
 
@@ -20,6 +23,10 @@ enum class InterpType {
 // A small struct to hold horiz remap data, which can be shared across multiple horiz remappers
 // NOTE: the client will call the build method, which will read the map file, and create the
 //       CRS matrix data for online interpolation.
+// NOTE: for large maps, reading and redistributing the triplets is expensive. If a cache dir
+//       is set, build saves the per-rank data in it (one binary file per rank). Later builds
+//       with the same map file (path, size, modification time, and n_s), fine grid
+//       decomposition, and remap type load the data directly from those files.
 struct HorizRemapperData {
   using KT = KokkosTypes<DefaultDevice>;
   template<typename T>
@@ -32,6 +39,17 @@ struct HorizRemapperData {
               const ekat::Comm& comm,
               const InterpType type);
 
+  // Set/get the directory for the cache files (empty means no caching)
+  static void set_cache_dir (const std::string& dir,
+                             const std::shared_ptr<ekat::logger::LoggerBase>& logger = nullptr) {
+    s_cache_dir = dir;
+    s_logger = logger;
+  }
+  static const std::string& get_cache_dir () { return s_cache_dir; }
+
+  // A hash of the dofs gids owned by each rank (in rank order). This is a collective call.
+  static std::uint64_t decomposition_hash (const AbstractGrid& grid);
+
   // The coarse grid data
   std::shared_ptr<AbstractGrid> coarse_grid;
   std::shared_ptr<AbstractGrid> ov_coarse_grid;
@@ -42,6 +60,9 @@ struct HorizRemapperData {
   view_1d<Real>   weights;
 
   int num_customers = 0;
+
+  // Whether build loaded the data from the cache files
+  bool loaded_from_cache = false;
 private:
   using gid_type = AbstractGrid::gid_type;
 
@@ -68,6 +89,31 @@ private:
   // Not a const ref, since we'll sort the triplets according to
   // how row gids appear in the coarse grid
   void create_crs_matrix_structures (std::vector<Triplet>& triplets);
+
+  // The data stored in the cache file of each rank
+  struct CacheData {
+    std::vector<gid_type> ov_coarse_gids;
+    std::vector<gid_type> coarse_gids;
+    std::vector<int>      row_offsets;
+    std::vector<int>      col_lids;
+    std::vector<Real>     weights;
+  };
+
+  // Check that n_a/n_b from the map file are compatible with the fine grid and the remap type
+  void check_map_dims (const std::string& map_file, const int n_a, const int n_b) const;
+
+  // Hash of map file metadata (path, size, mtime, and n_s), fine grid decomposition,
+  // and remap type. This is a collective call.
+  std::uint64_t compute_cache_key (const std::string& map_file, const int n_s) const;
+
+  // Return false if the file does not exist, or its data was not created with the same key
+  bool read_cache_file (const std::string& cache_file, const std::uint64_t key, CacheData& data) const;
+  void write_cache_file (const std::string& cache_file, const std::uint64_t key) const;
+
+  void set_from_cache_data (const CacheData& data);
+
+  static std::string s_cache_dir;
+  static std::shared_ptr<ekat::logger::LoggerBase> s_logger;
 };
 
 } // namespace scream
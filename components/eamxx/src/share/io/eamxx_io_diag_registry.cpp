@@ -0,0 +1,143 @@
+#include "share/io/eamxx_io_diag_registry.hpp"
+
+#include <sstream>
+
+namespace scream
+{
+
+std::string DiagnosticRegistry::
+make_key (const std::string& diag_field_name,
+          const std::string& grid_name,
+          const float fill_value)
+{
+  std::ostringstream ss;
+  ss.precision(9);
+  ss << diag_field_name << "@" << grid_name << "#" << fill_value;
+  return ss.str();
+}
+
+auto DiagnosticRegistry::
+get_diag (const std::string& key) const -> diag_ptr_type
+{
+  auto it = m_diags.find(key);
+  EKAT_REQUIRE_MSG (it!=m_diags.end(),
+      "Error! Diagnostic not found in the registry.\n"
+      " - key: " + key + "\n");
+  return it->second;
+}
+
+void DiagnosticRegistry::
+add_diag (const std::string& key, const diag_ptr_type& diag)
+{
+  EKAT_REQUIRE_MSG (diag!=nullptr,
+      "Error! Cannot add a null diagnostic to the registry.\n"
+      " - key: " + key + "\n");
+  EKAT_REQUIRE_MSG (m_diags.count(key)==0,
+      "Error! A diagnostic with this key was already added to the registry.\n"
+      " - key: " + key + "\n");
+
+  m_diags[key] = diag;
+  m_info[diag.get()];
+}
+
+void DiagnosticRegistry::
+init_timestep (const diag_ptr_type& diag, const util::TimeStamp& start_of_step)
+{
+  auto& info = m_info.at(diag.get());
+  if (info.last_init_ts.is_valid() and info.last_init_ts==start_of_step) {
+    return;
+  }
+
+  diag->init_timestep(start_of_step);
+  info.last_init_ts = start_of_step;
+}
+
+bool DiagnosticRegistry::
+compute (const diag_ptr_type& diag)
+{
+  auto& info = m_info.at(diag.get());
+  if (is_up_to_date(*diag,info)) {
+    return true;
+  }
+
+  // If the diag depends on a diag whose global sum is pending, finish it first
+  for (const auto& f : diag->get_fields_in()) {
+    for (const auto& p : m_pending) {
+      if (p->get_diagnostic().get_header().get_identifier()==f.get_header().get_identifier()) {
+        finish_reductions();
+        break;
+      }
+    }
+  }
+
+  // Invalidate, in case the diag fails to compute
+  info.inputs_ts.clear();
+
+  const bool defer = diag->can_defer_global_sum();
+  diag->compute_diagnostic(0,defer);
+  ++m_num_evaluations;
+
+  const auto& d = diag->get_diagnostic();
+  if (not d.get_header().get_tracking().get_time_stamp().is_valid()) {
+    return false;
+  }
+
+  if (defer) {
+    m_pending.push_back(diag);
+  }
+
+  if (diag->get_groups_in().empty()) {
+    for (const auto& f : diag->get_fields_in()) {
+      info.inputs_ts.push_back(f.get_header().get_tracking().get_time_stamp());
+    }
+  }
+  return true;
+}
+
+void DiagnosticRegistry::
+finish_reductions ()
+{
+  if (m_pending.empty()) {
+    return;
+  }
+
+  batch_key_type key;
+  for (const auto& diag : m_pending) {
+    key.push_back(diag.get());
+  }
+
+  auto& batch = m_batches[key];
+  if (batch==nullptr) {
+    batch = std::make_shared<FieldReductionBatch>(m_pending.front()->get_comm());
+    for (const auto& diag : m_pending) {
+      batch->add_all_reduce(diag->get_diagnostic());
+    }
+  }
+
+  batch->start();
+  batch->finish();
+  m_pending.clear();
+}
+
+bool DiagnosticRegistry::
+is_up_to_date (const AtmosphereDiagnostic& diag, const DiagInfo& info) const
+{
+  const auto& fields_in = diag.get_fields_in();
+  if (info.inputs_ts.empty() or info.inputs_ts.size()!=fields_in.size()) {
+    return false;
+  }
+
+  if (not diag.get_diagnostic().get_header().get_tracking().get_time_stamp().is_valid()) {
+    return false;
+  }
+
+  int i = 0;
+  for (const auto& f : fields_in) {
+    if (f.get_header().get_tracking().get_time_stamp()!=info.inputs_ts[i++]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // namespace scream
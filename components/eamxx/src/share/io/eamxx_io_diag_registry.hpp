@@ -0,0 +1,103 @@
+#ifndef SCREAM_IO_DIAG_REGISTRY_HPP
+#define SCREAM_IO_DIAG_REGISTRY_HPP
+
+#include "share/atm_process/atmosphere_diagnostic.hpp"
+#include "share/field/field_reduction_batch.hpp"
+#include "share/util/eamxx_time_stamp.hpp"
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * A registry of diagnostics, which can be shared by several output streams
+ *
+ * Output streams create the diagnostics they need on the fly. If the same
+ * diagnostic (same name, params, and grid) is requested by multiple streams
+ * (e.g., an hourly and a daily stream both requesting PotentialTemperature),
+ * without a shared registry each stream would create and compute its own copy.
+ * Streams that share a registry will instead share the diag object, and the
+ * diag will be computed only once per step.
+ *
+ * To decide whether a diag needs to be recomputed, the registry stores the
+ * time stamps of all input fields at the last (successful) evaluation. If none
+ * of them has moved since, the diag output is still up to date.
+ * Since all diags are created (and evaluated) by streams in dependency order,
+ * the evaluation order of a diag that depends on other diags is preserved.
+ *
+ * Diags that can defer their final allreduce (e.g., horizontal averages) only
+ * compute local partial sums in compute. The registry reduces all pending diags
+ * with one FieldReductionBatch in finish_reductions, which callers must call once
+ * they are done computing diags. If a diag depends on a pending one, the pending
+ * reductions are finished before computing it. All diags are assumed to live on
+ * the same comm.
+ *
+ * NOTE: diagnostics with input groups are always recomputed, since group
+ *       fields are not tracked.
+ */
+
+class DiagnosticRegistry
+{
+public:
+  using diag_ptr_type = std::shared_ptr<AtmosphereDiagnostic>;
+
+  // Build the key uniquely identifying a diag for a given output field name.
+  // The fill value is part of the key, since some diags use it internally, and since
+  // streams fill the output of a diag that could not be computed with their fill value.
+  static std::string make_key (const std::string& diag_field_name,
+                               const std::string& grid_name,
+                               const float fill_value);
+
+  bool has_diag (const std::string& key) const { return m_diags.count(key)==1; }
+
+  // Retrieve a diag (error out if not found)
+  diag_ptr_type get_diag (const std::string& key) const;
+
+  // Store a diag (error out if key is already used)
+  void add_diag (const std::string& key, const diag_ptr_type& diag);
+
+  // Call diag->init_timestep, unless already done for this start_of_step
+  void init_timestep (const diag_ptr_type& diag, const util::TimeStamp& start_of_step);
+
+  // Compute the diag, unless its inputs have not changed since last evaluation.
+  // Returns true if the diag output is valid (either recomputed or up to date),
+  // though a deferred global sum is only done in finish_reductions.
+  bool compute (const diag_ptr_type& diag);
+
+  // Sum the outputs of all diags with a pending global sum across ranks
+  void finish_reductions ();
+
+  // Number of actual calls to compute_diagnostic (for testing/debug purposes)
+  int num_evaluations () const { return m_num_evaluations; }
+
+  int size () const { return m_diags.size(); }
+
+protected:
+
+  struct DiagInfo {
+    // Time stamps of the inputs at the last successful evaluation
+    std::vector<util::TimeStamp> inputs_ts;
+    util::TimeStamp              last_init_ts;
+  };
+
+  bool is_up_to_date (const AtmosphereDiagnostic& diag, const DiagInfo& info) const;
+
+  std::map<std::string,diag_ptr_type>            m_diags;
+  std::map<const AtmosphereDiagnostic*,DiagInfo> m_info;
+
+  // Diags computed with a deferred global sum, and the batches used to reduce
+  // them (the set of pending diags is usually the same at every output step)
+  using batch_key_type = std::vector<const AtmosphereDiagnostic*>;
+  std::vector<diag_ptr_type>                                      m_pending;
+  std::map<batch_key_type,std::shared_ptr<FieldReductionBatch>>   m_batches;
+
+  int m_num_evaluations = 0;
+};
+
+} // namespace scream
+
+#endif // SCREAM_IO_DIAG_REGISTRY_HPP
@@ -5,7 +5,10 @@
 #include "share/util/eamxx_utils.hpp"
 #include "share/eamxx_config.hpp"
 
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <limits>
 #include <regex>
 
 namespace scream {
@@ -129,6 +132,7 @@ create_diagnostic (const std::string& diag_field_name,
   // Note: the number for field_at_p/h can match positive integer/floating-point numbers
   std::regex field_at_l (R"(([A-Za-z0-9_]+)_at_(lev_(\d+)|model_(top|bot))$)");
   std::regex field_at_p (R"(([A-Za-z0-9_]+)_at_(\d+(\.\d+)?)(hPa|mb|Pa)$)");
+  std::regex field_at_ps (R"(([A-Za-z0-9_]+)_at_((\d+(\.\d+)?_)+\d+(\.\d+)?)(hPa|mb|Pa)$)");
   std::regex field_at_h (R"(([A-Za-z0-9_]+)_at_(\d+(\.\d+)?)(m)_above_(sealevel|surface)$)");
   std::regex surf_mass_flux ("precip_(liq|ice|total)_surf_mass_flux$");
   std::regex water_path ("(Ice|Liq|Rain|Rime|Vap)WaterPath$");
@@ -151,6 +155,12 @@ create_diagnostic (const std::string& diag_field_name,
     params.set("grid_name",grid->name());
     params.set("vertical_location", matches[2].str());
     diag_name = "FieldAtLevel";
+  } else if (std::regex_search(diag_field_name,matches,field_at_ps)) {
+    params.set("field_name",matches[1].str());
+    params.set("grid_name",grid->name());
+    params.set("pressure_values",matches[2].str());
+    params.set("pressure_units", matches[6].str());
+    diag_name = "FieldAtPressureLevels";
   } else if (std::regex_search(diag_field_name,matches,field_at_p)) {
     params.set("field_name",matches[1].str());
     params.set("grid_name",grid->name());
@@ -231,4 +241,90 @@ create_diagnostic (const std::string& diag_field_name,
   return diag;
 }
 
+namespace {
+
+// Work on the bits of the entries, using the unsigned int type U of the same size as T
+template<typename T, typename U>
+void bit_round_impl (const Field& src, const Field& dst, const int keepbits, const T fill_value)
+{
+  static_assert (sizeof(T)==sizeof(U), "Error! Mismatching sizes of real and unsigned int types.\n");
+  using RangePolicy = typename KokkosTypes<DefaultDevice>::RangePolicy;
+
+  constexpr int nmant = std::numeric_limits<T>::digits - 1;
+  constexpr int nexp  = 8*sizeof(T) - nmant - 1;
+
+  const int n = src.get_header().get_alloc_properties().get_num_scalars();
+  const auto s = reinterpret_cast<const U*>(src.get_internal_view_data<const T>());
+  const auto d = reinterpret_cast<U*>(dst.get_internal_view_data<T>());
+
+  const int shift = keepbits<nmant ? nmant-keepbits : 0;
+  const U one = 1;
+  const U exp_mask = ((one << nexp) - one) << nmant;
+  const U keep_mask = ~((one << shift) - one);
+  const U half_m1 = shift>0 ? (one << (shift-1)) - one : 0;
+  U fill_bits;
+  std::memcpy(&fill_bits,&fill_value,sizeof(T));
+
+  Kokkos::parallel_for("bit_round",RangePolicy(0,n),KOKKOS_LAMBDA(const int i) {
+    U u = s[i];
+    // Exponent bits all set means inf/nan
+    if (shift>0 and u!=fill_bits and (u & exp_mask)!=exp_mask) {
+      // Round to nearest, ties to even (a carry into the exponent is the correct rounding)
+      u += half_m1 + ((u >> shift) & one);
+      u &= keep_mask;
+    }
+    d[i] = u;
+  });
+}
+
+} // anonymous namespace
+
+void bit_round (const Field& src, const Field& dst, const int keepbits, const double fill_value)
+{
+  const auto& src_fh = src.get_header();
+  const auto& dst_fh = dst.get_header();
+  EKAT_REQUIRE_MSG (keepbits>0,
+      "Error! Invalid number of mantissa bits to keep in bit_round.\n"
+      " - field name: " + src.name() + "\n"
+      " - keepbits  : " + std::to_string(keepbits) + "\n");
+  EKAT_REQUIRE_MSG (src.is_allocated() and dst.is_allocated(),
+      "Error! Input fields to bit_round must be allocated.\n"
+      " - src name: " + src.name() + "\n"
+      " - dst name: " + dst.name() + "\n");
+  EKAT_REQUIRE_MSG (not dst.is_read_only(),
+      "Error! Cannot write into read-only field in bit_round.\n"
+      " - dst name: " + dst.name() + "\n");
+  EKAT_REQUIRE_MSG (src.data_type()==dst.data_type() and
+                    src_fh.get_identifier().get_layout().congruent(dst_fh.get_identifier().get_layout()),
+      "Error! Input fields to bit_round must have the same layout and data type.\n"
+      " - src name: " + src.name() + "\n"
+      " - dst name: " + dst.name() + "\n");
+  EKAT_REQUIRE_MSG (dst_fh.get_parent()==nullptr,
+      "Error! Output field of bit_round cannot be a subfield.\n"
+      " - dst name: " + dst.name() + "\n");
+
+  // The kernel runs over the whole allocation (padding included, which is harmless),
+  // so src must be stored exactly like dst. If not (e.g., src is a subfield), copy
+  // src into dst first, and round dst in place.
+  const bool same_storage = src_fh.get_parent()==nullptr and
+                            src_fh.get_alloc_properties().get_alloc_size()==dst_fh.get_alloc_properties().get_alloc_size();
+  if (not same_storage) {
+    dst.deep_copy(src);
+  }
+  const auto& f_in = same_storage ? src : dst;
+
+  switch (src.data_type()) {
+    case DataType::FloatType:
+      bit_round_impl<float,std::uint32_t>(f_in,dst,keepbits,static_cast<float>(fill_value));
+      break;
+    case DataType::DoubleType:
+      bit_round_impl<double,std::uint64_t>(f_in,dst,keepbits,fill_value);
+      break;
+    default:
+      EKAT_ERROR_MSG ("Error! Unsupported data type in bit_round.\n"
+          " - field name: " + src.name() + "\n"
+          " - data type : " + e2str(src.data_type()) + "\n");
+  }
+}
+
 } // namespace scream
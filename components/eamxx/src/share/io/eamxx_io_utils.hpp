@@ -89,5 +89,13 @@ std::shared_ptr<AtmosphereDiagnostic>
 create_diagnostic (const std::string& diag_name,
                    const std::shared_ptr<const AbstractGrid>& grid);
 
+// Copy src into dst, rounding each entry to the nearest value with keepbits mantissa bits
+// (ties to even). The trailing mantissa bits are then zero, which makes the data much more
+// compressible by lossless algorithms (e.g., NetCDF-4 deflate). Entries equal to fill_value,
+// as well as inf/nan, are copied unchanged. The fields must have the same layout, and dst
+// cannot be a subfield. If keepbits is larger than the number of mantissa bits of the field
+// data type, entries are copied unchanged.
+void bit_round (const Field& src, const Field& dst, const int keepbits, const double fill_value);
+
 } // namespace scream
 #endif // SCREAM_IO_UTILS_HPP
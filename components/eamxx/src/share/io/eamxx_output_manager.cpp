@@ -82,7 +82,7 @@ setup (const std::shared_ptr<fm_type>& field_mgr,
     EKAT_REQUIRE_MSG(grid_names.size()==1,
       "Error! Output requested on multiple grids but no grid information exists in output params.\n");
 
-    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgr,*grid_names.begin());
+    auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgr,*grid_names.begin(),m_diag_registry);
     output->set_logger(m_atm_logger);
     m_output_streams.push_back(output);
   } else {
@@ -116,7 +116,7 @@ setup (const std::shared_ptr<fm_type>& field_mgr,
       // as this is what the FieldManager expects.
       const auto& gname = field_mgr->get_grids_manager()->get_grid(*it)->name();
 
-      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgr,gname);
+      auto output = std::make_shared<output_type>(m_io_comm,m_params,field_mgr,gname,m_diag_registry);
       output->set_logger(m_atm_logger);
       m_output_streams.push_back(output);
     }
@@ -513,63 +513,84 @@ void OutputManager::run(const util::TimeStamp& timestamp)
       control.compute_next_write_ts();
       control.nsamples_since_last_write = 0;
 
-      if (m_is_model_restart_output) {
-        // Only write nsteps on model restart
-        set_attribute(filespecs.filename,"GLOBAL","nsteps",timestamp.get_num_steps());
-      } else {
-        if (filespecs.ftype==FileType::HistoryRestart) {
-          // Update the date of last write and sample size
-          write_timestamp (filespecs.filename,"last_write",m_output_control.last_write_ts,true);
-          scorpio::set_attribute (filespecs.filename,"GLOBAL","last_output_filename",m_output_file_specs.filename);
-          scorpio::set_attribute (filespecs.filename,"GLOBAL","num_snapshots_since_last_write",m_output_control.nsamples_since_last_write);
-          scorpio::set_attribute (filespecs.filename,"GLOBAL","last_output_file_num_snaps",m_output_file_specs.storage.num_snapshots_in_file);
+      // With async output, the writes below may happen later, so grab a copy of
+      // all the data to be written *now*.
+      // NOTE: for checkpoint files, unless we write restart data, we did not update time,
+      //       which means we cannot write any variable (the check var.num_records==time.length
+      //       would fail)
+      const auto filename = filespecs.filename;
+      const auto ftype    = filespecs.ftype;
+      const auto last_output_filename = m_output_file_specs.filename;
+      const auto last_write_ts = m_output_control.last_write_ts;
+      const int  nsamples_since_last_write = m_output_control.nsamples_since_last_write;
+      const int  last_output_file_num_snaps = m_output_file_specs.storage.num_snapshots_in_file;
+      const auto& fp_precision = m_params.get<std::string>("floating_point_precision");
+      const int keep_mantissa_bits = m_params.isSublist("compression")
+                                   ? m_params.sublist("compression").get<int>("keep_mantissa_bits",0) : 0;
+      const bool write_time_bnds = m_time_bnds.size()>0 and
+                                   (filespecs.ftype!=FileType::HistoryRestart or is_full_checkpoint_step);
+      auto write_globals = [=,globals=m_globals,time_bnds=m_time_bnds,
+                            avg_type=m_avg_type,output_control=m_output_control,
+                            output_storage=m_output_file_specs.storage,
+                            is_model_restart_output=m_is_model_restart_output]() {
+        if (is_model_restart_output) {
+          // Only write nsteps on model restart
+          set_attribute(filename,"GLOBAL","nsteps",timestamp.get_num_steps());
+        } else {
+          if (ftype==FileType::HistoryRestart) {
+            // Update the date of last write and sample size
+            write_timestamp (filename,"last_write",last_write_ts,true);
+            scorpio::set_attribute (filename,"GLOBAL","last_output_filename",last_output_filename);
+            scorpio::set_attribute (filename,"GLOBAL","num_snapshots_since_last_write",nsamples_since_last_write);
+            scorpio::set_attribute (filename,"GLOBAL","last_output_file_num_snaps",last_output_file_num_snaps);
+          }
+          // Write these in both output and rhist file. The former, b/c we need these info when we postprocess
+          // output, and the latter b/c we want to make sure these params don't change across restarts
+          set_attribute(filename,"GLOBAL","averaging_type",e2str(avg_type));
+          set_attribute(filename,"GLOBAL","averaging_frequency_units",output_control.frequency_units);
+          set_attribute(filename,"GLOBAL","averaging_frequency",output_control.frequency);
+          set_attribute(filename,"GLOBAL","file_max_storage_type",e2str(output_storage.type));
+          if (output_storage.type==NumSnaps) {
+            set_attribute(filename,"GLOBAL","max_snapshots_per_file",output_storage.max_snapshots_in_file);
+          }
+          set_attribute(filename,"GLOBAL","fp_precision",fp_precision);
+          if (ftype==FileType::ModelOutput and keep_mantissa_bits>0) {
+            // Let users know the data is lossy
+            set_attribute(filename,"GLOBAL","keep_mantissa_bits",keep_mantissa_bits);
+          }
         }
-        // Write these in both output and rhist file. The former, b/c we need these info when we postprocess
-        // output, and the latter b/c we want to make sure these params don't change across restarts
-        set_attribute(filespecs.filename,"GLOBAL","averaging_type",e2str(m_avg_type));
-        set_attribute(filespecs.filename,"GLOBAL","averaging_frequency_units",m_output_control.frequency_units);
-        set_attribute(filespecs.filename,"GLOBAL","averaging_frequency",m_output_control.frequency);
-        set_attribute(filespecs.filename,"GLOBAL","file_max_storage_type",e2str(m_output_file_specs.storage.type));
-        if (m_output_file_specs.storage.type==NumSnaps) {
-          set_attribute(filespecs.filename,"GLOBAL","max_snapshots_per_file",m_output_file_specs.storage.max_snapshots_in_file);
+
+        // Write all stored globals
+        for (const auto& it : globals) {
+          const auto& name = it.first;
+          const auto& any = it.second;
+          if (any.isType<int>()) {
+            set_attribute(filename,"GLOBAL",name,ekat::any_cast<int>(any));
+          } else if (any.isType<std::int64_t>()) {
+            set_attribute(filename,"GLOBAL",name,ekat::any_cast<std::int64_t>(any));
+          } else if (any.isType<float>()) {
+            set_attribute(filename,"GLOBAL",name,ekat::any_cast<float>(any));
+          } else if (any.isType<double>()) {
+            set_attribute(filename,"GLOBAL",name,ekat::any_cast<double>(any));
+          } else if (any.isType<std::string>()) {
+            set_attribute(filename,"GLOBAL",name,ekat::any_cast<std::string>(any));
+          } else {
+            EKAT_ERROR_MSG (
+                "Error! Invalid concrete type for IO global.\n"
+                " - global name: " + it.first + "\n"
+                " - type id    : " + any.content().type().name() + "\n");
+          }
         }
-        const auto& fp_precision = m_params.get<std::string>("floating_point_precision");
-        set_attribute(filespecs.filename,"GLOBAL","fp_precision",fp_precision);
-      }
 
-      // Write all stored globals
-      for (const auto& it : m_globals) {
-        const auto& name = it.first;
-        const auto& any = it.second;
-        if (any.isType<int>()) {
-          set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<int>(any));
-        } else if (any.isType<std::int64_t>()) {
-          set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<std::int64_t>(any));
-        } else if (any.isType<float>()) {
-          set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<float>(any));
-        } else if (any.isType<double>()) {
-          set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<double>(any));
-        } else if (any.isType<std::string>()) {
-          set_attribute(filespecs.filename,"GLOBAL",name,ekat::any_cast<std::string>(any));
-        } else {
-          EKAT_ERROR_MSG (
-              "Error! Invalid concrete type for IO global.\n"
-              " - global name: " + it.first + "\n"
-              " - type id    : " + any.content().type().name() + "\n");
+        if (write_time_bnds) {
+          scorpio::write_var(filename, "time_bnds", time_bnds.data());
         }
-      }
+      };
+      run_io_task(write_globals);
 
       // We're adding one snapshot to the file
       filespecs.storage.update_storage(timestamp);
 
-      // NOTE: for checkpoint files, unless we write restart data, we did not update time,
-      //       which means we cannot write any variable (the check var.num_records==time.length
-      //       would fail)
-      if (m_time_bnds.size()>0 and
-          (filespecs.ftype!=FileType::HistoryRestart or is_full_checkpoint_step)) {
-        scorpio::write_var(filespecs.filename, "time_bnds", m_time_bnds.data());
-      }
-
       close_or_flush_if_needed(filespecs,control);
     };
 
@@ -585,8 +606,19 @@ void OutputManager::run(const util::TimeStamp& timestamp)
 
       // Always flush output during checkpoints (assuming we opened it already)
       if (m_output_file_specs.is_open) {
-        scorpio::flush_file (m_output_file_specs.filename);
+        const auto filename = m_output_file_specs.filename;
+        run_io_task([filename](){ scorpio::flush_file (filename); });
       }
+
+      // A checkpoint must be complete before we move on
+      if (m_async_write) {
+        scorpio::wait_for_async_tasks();
+      }
+    }
+    if (m_is_model_restart_output and m_async_write) {
+      // The model restart file must be complete before we move on, since the
+      // pending writes are reading directly from the model fields
+      scorpio::wait_for_async_tasks();
     }
     stop_timer(timer_root+"::update_snapshot_tally");
     if (is_output_step && m_time_bnds.size()>0) {
@@ -705,6 +737,12 @@ setup_internals (const std::shared_ptr<fm_type>& field_mgr,
 
     // Hard code some parameters in case we access them later
     m_params.set<std::string>("floating_point_precision","real");
+
+    // If pipelined, the restart fields are written by the scorpio background thread
+    // straight from the fields host views (no staging), while the next field is copied
+    // to host. The restart file is then completed before the model proceeds (see run).
+    m_params.set("async_write",m_params.get<bool>("pipelined_io",false));
+    m_params.set("async_write_staging",false);
   } else {
     auto avg_type = m_params.get<std::string>("averaging_type");
     m_avg_type = str2avg(avg_type);
@@ -743,6 +781,14 @@ setup_internals (const std::shared_ptr<fm_type>& field_mgr,
         "  - supported values: float, single, double, real\n");
   }
 
+  // Restart files must allow a BFB restart, so they cannot be lossy
+  if (m_is_model_restart_output and m_params.isSublist("compression")) {
+    const auto keep_bits = m_params.sublist("compression").get<int>("keep_mantissa_bits",0);
+    EKAT_REQUIRE_MSG (keep_bits==0,
+        "Error! Bit rounding is not allowed for model restart output.\n"
+        " - keep_mantissa_bits: " + std::to_string(keep_bits) + "\n");
+  }
+
   // Output control
   EKAT_REQUIRE_MSG(m_params.isSublist("output_control"),
       "Error! The output control YAML file for " + m_filename_prefix + " is missing the sublist 'output_control'");
@@ -785,6 +831,16 @@ setup_internals (const std::shared_ptr<fm_type>& field_mgr,
   std::string iotype = m_params.get<std::string>("iotype", "default");
   m_output_file_specs.iotype = scorpio::str2iotype(iotype);
   m_checkpoint_file_specs.iotype = scorpio::str2iotype(iotype);
+
+  // Async output requires the scorpio background thread, which may not be available
+  if (m_params.get<bool>("async_write",false)) {
+    scorpio::enable_async_tasks(m_params.get<int>("async_max_pending_writes",1024));
+    m_async_write = scorpio::async_tasks_enabled();
+    if (not m_async_write and m_atm_logger) {
+      m_atm_logger->warn("[EAMxx::output_manager] WARNING! Async output requires MPI_THREAD_MULTIPLE.\n"
+                         "  Output stream '" + m_filename_prefix + "' will be written synchronously.\n");
+    }
+  }
 }
 
 /*===============================================================================================*/
@@ -921,11 +977,22 @@ void OutputManager::
 close_or_flush_if_needed (      IOFileSpecs& file_specs,
                           const IOControl&   control) const
 {
+  const auto filename = file_specs.filename;
   if (not file_specs.storage.snapshot_fits(control.next_write_ts)) {
-    scorpio::release_file(file_specs.filename);
+    run_io_task([filename](){ scorpio::release_file(filename); });
     file_specs.close();
   } else if (file_specs.file_needs_flush()) {
-    scorpio::flush_file (file_specs.filename);
+    run_io_task([filename](){ scorpio::flush_file (filename); });
+  }
+}
+
+void OutputManager::
+run_io_task (const std::function<void()>& task) const
+{
+  if (m_async_write) {
+    scorpio::enqueue_async_task(task);
+  } else {
+    task();
   }
 }
 
@@ -106,6 +106,11 @@ public:
   void set_logger(const std::shared_ptr<ekat::logger::LoggerBase>& atm_logger) {
       m_atm_logger = atm_logger;
   }
+  // Share diagnostics with other output managers using the same registry.
+  // Must be called before setup.
+  void set_diagnostic_registry (const std::shared_ptr<DiagnosticRegistry>& registry) {
+    m_diag_registry = registry;
+  }
   void add_global (const std::string& name, const ekat::any& global);
 
   void init_timestep (const util::TimeStamp& start_of_step, const Real dt);
@@ -138,6 +143,9 @@ protected:
   void close_or_flush_if_needed (      IOFileSpecs& file_specs,
                                  const IOControl&   control) const;
 
+  // Run a task that accesses scorpio, either immediately or asynchronously
+  void run_io_task (const std::function<void()>& task) const;
+
   // Manage logging of info to atm.log
   void push_to_logger();
 
@@ -189,8 +197,14 @@ protected:
   // The logger to be used throughout the ATM to log message
   std::shared_ptr<ekat::logger::LoggerBase> m_atm_logger;
 
+  // If set, diagnostics are shared with other output managers
+  std::shared_ptr<DiagnosticRegistry> m_diag_registry;
+
   // If true, we save grid data in output file
   bool m_save_grid_data;
+
+  // If true, writes are carried out by the scorpio background thread
+  bool m_async_write = false;
 };
 
 } // namespace scream
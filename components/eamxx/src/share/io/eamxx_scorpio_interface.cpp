@@ -8,11 +8,168 @@
 
 #include <pio.h>
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iostream>
+#include <mutex>
 #include <numeric>
+#include <thread>
 
 namespace scream {
 namespace scorpio {
 
+// A FIFO queue of tasks, executed by a background thread. Like ScorpioSession,
+// this is an implementation detail, hidden inside this cpp file.
+// To ensure scorpio is never accessed concurrently, any thread other than the
+// worker must wait for all pending tasks to complete before accessing the session.
+// All members are protected by the mutex.
+struct AsyncTaskQueue
+{
+public:
+  static AsyncTaskQueue& instance () {
+    static AsyncTaskQueue q;
+    return q;
+  }
+
+  ~AsyncTaskQueue () {
+    // Exceptions must not escape a destructor, so only report errors of pending tasks
+    try {
+      stop();
+    } catch (const std::exception& e) {
+      std::cerr << "WARNING! An async scorpio task failed while shutting down the task queue.\n"
+                   " - error: " << e.what() << "\n";
+    } catch (...) {
+      std::cerr << "WARNING! An async scorpio task failed while shutting down the task queue.\n";
+    }
+  }
+
+  void start (const int max_pending) {
+    std::unique_lock<std::mutex> lock(mutex);
+    max_tasks = std::max(max_tasks,max_pending);
+    if (not active) {
+      done = false;
+      active = true;
+      worker = std::thread([this](){ loop(); });
+      worker_id = worker.get_id();
+    }
+  }
+
+  // Complete all pending tasks, and shut down the worker thread
+  void stop () {
+    std::thread w;
+    {
+      std::unique_lock<std::mutex> lock(mutex);
+      if (not active) {
+        return;
+      }
+      // The worker executes all queued tasks before exiting
+      done = true;
+      active = false;
+      w = std::move(worker);
+    }
+    cv_push.notify_all();
+    w.join();
+
+    std::unique_lock<std::mutex> lock(mutex);
+    rethrow_error();
+  }
+
+  bool running () {
+    std::unique_lock<std::mutex> lock(mutex);
+    return active;
+  }
+
+  // Returns the ticket of the task (tickets are 1,2,3,... in push order)
+  std::int64_t push (const std::function<void()>& task) {
+    std::unique_lock<std::mutex> lock(mutex);
+    // Bounded queue: block until there is room for the new task
+    cv_pop.wait(lock,[&](){ return static_cast<int>(tasks.size())<max_tasks; });
+    tasks.push_back(task);
+    cv_push.notify_one();
+    return ++num_pushed;
+  }
+
+  // Wait for all pending tasks to complete. No-op if called from the worker thread.
+  void wait () {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (not active or std::this_thread::get_id()==worker_id) {
+      return;
+    }
+    cv_pop.wait(lock,[&](){ return tasks.empty() and not busy; });
+    rethrow_error();
+  }
+
+  // Wait for the task with the given ticket (and all the ones before it) to complete.
+  // No-op if called from the worker thread.
+  void wait (const std::int64_t ticket) {
+    std::unique_lock<std::mutex> lock(mutex);
+    if (not active or std::this_thread::get_id()==worker_id) {
+      return;
+    }
+    cv_pop.wait(lock,[&](){ return num_done>=ticket; });
+    rethrow_error();
+  }
+
+private:
+
+  AsyncTaskQueue () = default;
+
+  void loop () {
+    while (true) {
+      std::function<void()> task;
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv_push.wait(lock,[&](){ return done or not tasks.empty(); });
+        if (tasks.empty()) {
+          return;
+        }
+        task = tasks.front();
+        tasks.pop_front();
+        busy = true;
+      }
+      try {
+        task();
+      } catch (...) {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (not error) {
+          error = std::current_exception();
+        }
+      }
+      {
+        std::unique_lock<std::mutex> lock(mutex);
+        busy = false;
+        ++num_done;
+      }
+      cv_pop.notify_all();
+    }
+  }
+
+  // Re-throw the (first) exception raised by a task on the calling thread.
+  // Must be called with the mutex locked.
+  void rethrow_error () {
+    if (error) {
+      auto e = error;
+      error = nullptr;
+      std::rethrow_exception(e);
+    }
+  }
+
+  std::deque<std::function<void()>>   tasks;
+  std::thread                         worker;
+  std::thread::id                     worker_id;
+  std::mutex                          mutex;
+  std::condition_variable             cv_push;
+  std::condition_variable             cv_pop;
+  std::exception_ptr                  error;
+  int                                 max_tasks = 1;
+  std::int64_t                        num_pushed = 0;
+  std::int64_t                        num_done = 0;
+  bool                                busy = false;
+  bool                                done = false;
+  bool                                active = false;
+};
+
 // This class is an implementation detail, and therefore it is hidden inside
 // a cpp file. All customers of IO capabilities must use the common interfaces
 // exposed in the header file of this source file.
@@ -21,6 +178,10 @@ struct ScorpioSession
 {
 public:
   static ScorpioSession& instance () {
+    // If async tasks are pending, wait for them, to avoid concurrent access.
+    // NOTE: this is a no-op if called by the async tasks themselves.
+    AsyncTaskQueue::instance().wait();
+
     static ScorpioSession s;
     return s;
   }
@@ -218,12 +379,20 @@ int pio_iotype (IOType iotype) {
     case IOType::Adios:         iotype_int = static_cast<int>(PIO_IOTYPE_ADIOS);    break;
     case IOType::Adiosc:        iotype_int = static_cast<int>(PIO_IOTYPE_ADIOSC);   break;
     case IOType::Hdf5:          iotype_int = static_cast<int>(PIO_IOTYPE_HDF5);     break;
+    case IOType::NetCDF4c:      iotype_int = static_cast<int>(PIO_IOTYPE_NETCDF4C); break;
+    case IOType::NetCDF4p:      iotype_int = static_cast<int>(PIO_IOTYPE_NETCDF4P); break;
     default:
       EKAT_ERROR_MSG ("Unrecognized/unsupported iotype.\n");
   }
   return iotype_int;
 }
 
+// Only NetCDF-4 files support compression
+bool is_netcdf4 (const int iotype_int) {
+  return iotype_int==static_cast<int>(PIO_IOTYPE_NETCDF4C) or
+         iotype_int==static_cast<int>(PIO_IOTYPE_NETCDF4P);
+}
+
 // ====================== Local utilities ========================== //
 
 namespace impl {
@@ -354,6 +523,9 @@ bool is_subsystem_inited () {
 
 void finalize_subsystem ()
 {
+  // Complete any pending async task, and shut down the background thread
+  AsyncTaskQueue::instance().stop();
+
   auto& s = ScorpioSession::instance();
 
   // TODO: should we simply return instead? I think trying to finalize twice
@@ -390,6 +562,51 @@ void finalize_subsystem ()
   s.pio_rearranger   = -1;
 }
 
+// ======================== Asynchronous tasks ======================= //
+
+void enable_async_tasks (const int max_pending)
+{
+  EKAT_REQUIRE_MSG (max_pending>0,
+      "Error! The max number of pending async tasks must be positive.\n"
+      " - max_pending: " + std::to_string(max_pending) + "\n");
+
+  // The background thread performs MPI operations (inside PIO), while the
+  // calling thread may be doing MPI operations of its own.
+  int provided;
+  MPI_Query_thread(&provided);
+  if (provided!=MPI_THREAD_MULTIPLE) {
+    return;
+  }
+
+  AsyncTaskQueue::instance().start(max_pending);
+}
+
+bool async_tasks_enabled ()
+{
+  return AsyncTaskQueue::instance().running();
+}
+
+std::int64_t enqueue_async_task (const std::function<void()>& task)
+{
+  auto& q = AsyncTaskQueue::instance();
+  if (q.running()) {
+    return q.push(task);
+  } else {
+    task();
+    return 0;
+  }
+}
+
+void wait_for_async_tasks ()
+{
+  AsyncTaskQueue::instance().wait();
+}
+
+void wait_for_async_task (const std::int64_t ticket)
+{
+  AsyncTaskQueue::instance().wait(ticket);
+}
+
 // ========================= File operations ===================== //
 
 void register_file (const std::string& filename,
@@ -418,7 +635,10 @@ void register_file (const std::string& filename,
       err = PIOc_openfile(s.pio_sysid,&f.ncid,&iotype_int,filename.c_str(),write);
       f.enddef = true;
     } else {
-      err = PIOc_createfile(s.pio_sysid,&f.ncid,&iotype_int,filename.c_str(),s.pio_format);
+      // NetCDF-4 files cannot be created with the CDF5 format flag
+      const bool nc4 = iotype!=IOType::DefaultIOType and is_netcdf4(iotype_int);
+      const int format = nc4 ? PIO_CLOBBER : s.pio_format;
+      err = PIOc_createfile(s.pio_sysid,&f.ncid,&iotype_int,filename.c_str(),format);
       f.enddef = false;
     }
 
@@ -1046,6 +1266,54 @@ void define_var (const std::string& filename, const std::string& varname,
   define_var(filename,varname,"",dimensions,dtype,dtype,time_dependent);
 }
 
+bool set_var_compression (const std::string& filename, const std::string& varname,
+                          const int deflate_level, const bool shuffle,
+                          const std::map<std::string,int>& chunk_sizes)
+{
+  auto& f = impl::get_file(filename,"scorpio::set_var_compression");
+  auto& var = impl::get_var(filename,varname,"scorpio::set_var_compression");
+
+  EKAT_REQUIRE_MSG (not f.enddef,
+      "Error! Cannot set variable compression after the define phase.\n"
+      " - filename: " + filename + "\n"
+      " - varname : " + varname + "\n");
+  EKAT_REQUIRE_MSG (deflate_level>=0 and deflate_level<=9,
+      "Error! Invalid deflate level. Valid values are in [0,9].\n"
+      " - filename     : " + filename + "\n"
+      " - varname      : " + varname + "\n"
+      " - deflate level: " + std::to_string(deflate_level) + "\n");
+
+  if (not is_netcdf4(pio_iotype(f.iotype))) {
+    return false;
+  }
+
+  if (chunk_sizes.size()>0) {
+    std::vector<PIO_Offset> chunks;
+    if (var.time_dep) {
+      chunks.push_back(1);
+    }
+    for (const auto& dim : var.dims) {
+      auto it = chunk_sizes.find(dim->name);
+      const int len = it==chunk_sizes.end() ? dim->length : it->second;
+      EKAT_REQUIRE_MSG (len>0 and len<=dim->length,
+          "Error! Invalid chunk size. Valid values are in [1,dim_length].\n"
+          " - filename  : " + filename + "\n"
+          " - varname   : " + varname + "\n"
+          " - dimname   : " + dim->name + "\n"
+          " - dim length: " + std::to_string(dim->length) + "\n"
+          " - chunk size: " + std::to_string(len) + "\n");
+      chunks.push_back(len);
+    }
+    int err = PIOc_def_var_chunking(f.ncid,var.ncid,NC_CHUNKED,chunks.data());
+    check_scorpio_noerr(err,f.name,"variable",varname,"set_var_compression","def_var_chunking");
+  }
+
+  int err = PIOc_def_var_deflate(f.ncid,var.ncid,shuffle ? 1 : 0,deflate_level>0 ? 1 : 0,deflate_level);
+  check_scorpio_noerr(err,f.name,"variable",varname,"set_var_compression","def_var_deflate");
+
+  return true;
+}
+
 // This overload is not exposed externally. Also, filename is only
 // used to print it in case there are errors
 void change_var_dtype (PIOVar& var,
@@ -6,6 +6,9 @@
 #include <ekat/mpi/ekat_comm.hpp>
 #include <ekat/ekat_assert.hpp>
 
+#include <cstdint>
+#include <functional>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -69,6 +72,33 @@ void init_subsystem(const ekat::Comm& comm, const int atm_id = 0);
 bool is_subsystem_inited ();
 void finalize_subsystem ();
 
+// =================== Asynchronous tasks ================= //
+
+// When async tasks are enabled, enqueued tasks are executed (in FIFO order) by a
+// background thread, allowing the caller to overlap I/O with computation. A task
+// can call any function of this interface. Any call to this interface from another
+// thread first waits for all pending tasks to complete, so that scorpio is never
+// accessed concurrently, and collective operations happen in the same order on all ranks.
+// At most max_pending tasks can be queued: enqueuing more blocks until the oldest completes.
+// Since every other call drains the queue, I/O only overlaps with the work done by the caller
+// between enqueuing tasks and its next call to this interface: callers should batch their
+// tasks, and avoid interleaving them with other scorpio calls.
+// NOTES:
+//  - async tasks require MPI_THREAD_MULTIPLE. If not available, enable_async_tasks
+//    is a no-op, and tasks are executed immediately by enqueue_async_task. Callers
+//    should check async_tasks_enabled, and warn the user about the fallback.
+//  - exceptions thrown by a task are re-thrown by the next call to wait_for_async_tasks
+//    (or by any other function of this interface).
+//  - enqueue_async_task returns a ticket, which can be passed to wait_for_async_task
+//    to wait only for that task (and the ones enqueued before it). This allows to
+//    consume the result of a task while the following ones are still running.
+//    If the task was executed immediately, the ticket is 0.
+void enable_async_tasks (const int max_pending);
+bool async_tasks_enabled ();
+std::int64_t enqueue_async_task (const std::function<void()>& task);
+void wait_for_async_tasks ();
+void wait_for_async_task (const std::int64_t ticket);
+
 // =================== File operations ================= //
 
 // Opens a file, returns const handle to it (useful for Read mode, to get dims/vars)
@@ -162,6 +192,19 @@ void define_var (const std::string& filename, const std::string& varname,
                  const std::string& dtype,
                  const bool time_dependent = false);
 
+// Set lossless compression (deflate, possibly with byte shuffling) and chunking for a var.
+// This is only supported by NetCDF-4 files (iotype netcdf4c/netcdf4p, or a default iotype
+// that resolves to one of them), and must be called before ending the define phase.
+// If the file does not support compression, return false, and do nothing.
+// Chunk sizes are specified by dimension name. Dims not in the map use a single chunk
+// along the whole dimension, while the time dim (if any) always uses chunks of size 1.
+// NOTES:
+//  - deflate_level=0 disables compression (but shuffle/chunking are still set).
+//  - parallel writes of compressed vars (netcdf4p) require netcdf>=4.7.4 and hdf5>=1.10.3.
+bool set_var_compression (const std::string& filename, const std::string& varname,
+                          const int deflate_level, const bool shuffle,
+                          const std::map<std::string,int>& chunk_sizes = {});
+
 // This is useful when reading data sets. E.g., if the pio file is storing
 // a var as float, but we need to read it as double, we need to call this.
 // NOTE: read_var/write_var automatically change the dtype if the input
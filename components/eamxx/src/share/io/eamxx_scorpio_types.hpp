@@ -28,6 +28,8 @@ enum IOType {
   Adios,
   Adiosc,
   Hdf5,
+  NetCDF4c,   // NetCDF-4 (HDF5-based) format, written serially. Supports compression
+  NetCDF4p,   // NetCDF-4 (HDF5-based) format, written in parallel
   Invalid
 };
 
@@ -3,8 +3,10 @@
 #include "share/field/field_utils.hpp"
 #include "share/io/eamxx_scorpio_interface.hpp"
 
+#include <ekat/std_meta/ekat_std_utils.hpp>
 #include <ekat/util/ekat_string_utils.hpp>
 
+#include <functional>
 #include <memory>
 #include <numeric>
 
@@ -207,32 +209,21 @@ void AtmosphereInput::read_variables (const int time_index)
   EKAT_REQUIRE_MSG (m_fields_inited and m_scorpio_inited,
       "Error! Internal structures not fully inited yet. Did you forget to call 'init(..)'?\n");
 
-  for (auto const& name : m_fields_names) {
-
-    auto f_scorpio = m_fm_for_scorpio->get_field(name);
-    auto f_user    = m_fm_from_user->get_field(name);
-
-    // Read the data
-    switch (f_scorpio.data_type()) {
-      case DataType::DoubleType:
-        scorpio::read_var(m_filename,name,f_scorpio.get_internal_view_data<double,Host>(),time_index);
-        break;
-      case DataType::FloatType:
-        scorpio::read_var(m_filename,name,f_scorpio.get_internal_view_data<float,Host>(),time_index);
-        break;
-      case DataType::IntType:
-        scorpio::read_var(m_filename,name,f_scorpio.get_internal_view_data<int,Host>(),time_index);
-        break;
-      default:
-        EKAT_ERROR_MSG (
-            "Error! Unsupported/unrecognized data type while reading field from file.\n"
-            " - file name : " + m_filename + "\n"
-            " - field name: " + name + "\n");
+  if (scorpio::async_tasks_enabled()) {
+    // Pipeline the reads: the background thread reads the vars one after the other,
+    // while this thread copies each var to device (and into the user field) as soon
+    // as it is available, overlapping the host-device transfers with the file reads.
+    std::vector<std::int64_t> tickets;
+    for (auto const& name : m_fields_names) {
+      tickets.push_back(read_variable_to_host(name,time_index,true));
     }
-
-    f_scorpio.sync_to_dev();
-    if (not f_scorpio.is_aliasing(f_user)) {
-      f_user.deep_copy(f_scorpio);
+    for (size_t i=0; i<m_fields_names.size(); ++i) {
+      scorpio::wait_for_async_task(tickets[i]);
+      copy_variable_to_dev(m_fields_names[i]);
+    }
+  } else {
+    for (auto const& name : m_fields_names) {
+      read_variable(name,time_index);
     }
   }
   if (m_atm_logger) {
@@ -242,6 +233,80 @@ void AtmosphereInput::read_variables (const int time_index)
   }
 }
 
+/* ---------------------------------------------------------- */
+void AtmosphereInput::read_variable (const std::string& name, const int time_index)
+{
+  EKAT_REQUIRE_MSG (m_fields_inited and m_scorpio_inited,
+      "Error! Internal structures not fully inited yet. Did you forget to call 'init(..)'?\n");
+  EKAT_REQUIRE_MSG (ekat::contains(m_fields_names,name),
+      "Error! Requested variable is not among the fields of this input stream.\n"
+      " - file name : " + m_filename + "\n"
+      " - var name  : " + name + "\n"
+      " - var names : " + ekat::join(m_fields_names,", ") + "\n");
+
+  read_variable_to_host(name,time_index,false);
+  copy_variable_to_dev(name);
+}
+
+/* ---------------------------------------------------------- */
+std::int64_t AtmosphereInput::
+read_variable_to_host (const std::string& name, const int time_index, const bool async)
+{
+  auto f_scorpio = m_fm_for_scorpio->get_field(name);
+
+  // Read the data
+  std::function<void()> read;
+  switch (f_scorpio.data_type()) {
+    case DataType::DoubleType:
+    {
+      auto data = f_scorpio.get_internal_view_data<double,Host>();
+      read = [filename=m_filename,name,data,time_index]() {
+        scorpio::read_var(filename,name,data,time_index);
+      };
+      break;
+    }
+    case DataType::FloatType:
+    {
+      auto data = f_scorpio.get_internal_view_data<float,Host>();
+      read = [filename=m_filename,name,data,time_index]() {
+        scorpio::read_var(filename,name,data,time_index);
+      };
+      break;
+    }
+    case DataType::IntType:
+    {
+      auto data = f_scorpio.get_internal_view_data<int,Host>();
+      read = [filename=m_filename,name,data,time_index]() {
+        scorpio::read_var(filename,name,data,time_index);
+      };
+      break;
+    }
+    default:
+      EKAT_ERROR_MSG (
+          "Error! Unsupported/unrecognized data type while reading field from file.\n"
+          " - file name : " + m_filename + "\n"
+          " - field name: " + name + "\n");
+  }
+
+  if (async) {
+    return scorpio::enqueue_async_task(read);
+  }
+  read();
+  return 0;
+}
+
+/* ---------------------------------------------------------- */
+void AtmosphereInput::copy_variable_to_dev (const std::string& name)
+{
+  auto f_scorpio = m_fm_for_scorpio->get_field(name);
+  auto f_user    = m_fm_from_user->get_field(name);
+
+  f_scorpio.sync_to_dev();
+  if (not f_scorpio.is_aliasing(f_user)) {
+    f_user.deep_copy(f_scorpio);
+  }
+}
+
 /* ---------------------------------------------------------- */
 void AtmosphereInput::finalize()
 {
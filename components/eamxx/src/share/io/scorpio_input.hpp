@@ -7,6 +7,8 @@
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/logging/ekat_logger.hpp"
 
+#include <cstdint>
+
 /*  The AtmosphereInput class handles all input streams to SCREAM.
  *  It is important to note that there does not exist an InputManager,
  *  like in the case of output.  So all input streams have to be managed
@@ -85,6 +87,10 @@ public:
   // Read fields that were required via parameter list.
   void read_variables (const int time_index = -1);
 
+  // Read a single one of the fields. Allows to spread the reading of several
+  // fields over multiple calls (e.g., to prefetch data one field at a time)
+  void read_variable (const std::string& name, const int time_index = -1);
+
   // Cleans up the class
   void finalize();
 
@@ -110,6 +116,13 @@ protected:
 
   void set_decompositions();
 
+  // Read a var into the host view of its scorpio field. If async=true, the read is
+  // enqueued as a scorpio async task, and its ticket is returned (see scorpio::enqueue_async_task)
+  std::int64_t read_variable_to_host (const std::string& name, const int time_index, const bool async);
+
+  // Copy a var that was read into host to device (and into the user field, if not aliased)
+  void copy_variable_to_dev (const std::string& name);
+
   std::vector<std::string> get_vec_of_dims (const FieldLayout& layout);
 
   // Internal variables
@@ -10,7 +10,9 @@
 #include <ekat/util/ekat_string_utils.hpp>
 #include <ekat/std_meta/ekat_std_utils.hpp>
 
+#include <algorithm>
 #include <numeric>
+#include <limits>
 
 namespace {
   // Helper lambda, to copy io string attributes. This will be used if any
@@ -63,8 +65,10 @@ AtmosphereOutput (const ekat::Comm& comm,
 AtmosphereOutput::
 AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
                   const std::shared_ptr<const fm_type>& field_mgr,
-                  const std::string& grid_name)
+                  const std::string& grid_name,
+                  const std::shared_ptr<DiagnosticRegistry>& diag_registry)
  : m_comm           (comm)
+ , m_diag_registry  (diag_registry ? diag_registry : std::make_shared<DiagnosticRegistry>())
  , m_add_time_dim   (true)
 {
   using vos_t = std::vector<std::string>;
@@ -173,6 +177,39 @@ AtmosphereOutput (const ekat::Comm& comm, const ekat::ParameterList& params,
     m_fill_value = static_cast<float>(params.get<double>("fill_value"));
   }
 
+  // Lossless compression (NetCDF-4 files only), and lossy bit rounding of the output fields
+  if (params.isSublist("compression")) {
+    const auto& pl = params.sublist("compression");
+    m_deflate_level = pl.get<int>("deflate_level",0);
+    m_shuffle = pl.get<bool>("shuffle",true);
+    if (pl.isSublist("chunk_sizes")) {
+      const auto& chunks_pl = pl.sublist("chunk_sizes");
+      for (auto it=chunks_pl.params_names_cbegin(); it!=chunks_pl.params_names_cend(); ++it) {
+        m_chunk_sizes[*it] = chunks_pl.get<int>(*it);
+      }
+    }
+    m_keep_mantissa_bits = pl.get<int>("keep_mantissa_bits",0);
+
+    // Rounding to more bits than the output precision would be a no-op
+    const auto& prec = params.get<std::string>("floating_point_precision","single");
+    const bool out_double = prec=="double" or (prec=="real" and std::is_same<Real,double>::value);
+    const int max_bits = std::numeric_limits<float>::digits - 1;
+    const int max_bits_double = std::numeric_limits<double>::digits - 1;
+    EKAT_REQUIRE_MSG (m_keep_mantissa_bits>=0 and m_keep_mantissa_bits<=(out_double ? max_bits_double : max_bits),
+        "Error! Invalid value for 'keep_mantissa_bits' in the compression sublist.\n"
+        " - yaml file         : " + params.name() + "\n"
+        " - keep_mantissa_bits: " + std::to_string(m_keep_mantissa_bits) + "\n"
+        " - valid range       : [0," + std::to_string(out_double ? max_bits_double : max_bits) + "] (0 means no rounding)\n");
+  }
+
+  // Async writes are only possible if the scorpio background thread is running
+  // (which requires MPI_THREAD_MULTIPLE, see scorpio::enable_async_tasks)
+  if (params.get<bool>("async_write",false)) {
+    scorpio::enable_async_tasks(params.get<int>("async_max_pending_writes",1024));
+    m_async_write = scorpio::async_tasks_enabled();
+    m_async_staging = params.get<bool>("async_write_staging",true);
+  }
+
   // Setup remappers - if needed
   auto grid_after_vr = fm_grid;
   if (use_vertical_remap_from_file) {
@@ -301,10 +338,10 @@ void AtmosphereOutput::init()
                           ? m_io_grid->get_special_tag_name(tags[i])
                           : layout.names()[i];
 
-      // If t==CMP, and the name stored in the layout is "dim" (the default) or "bin",
+      // If t==CMP, and the name stored in the layout is "dim" (the default), "bin", or "plev",
       // we append also the extent, to allow different vector dims in the file
-      // TODO: generalize this to all tags, for now hardcoding to dim and bin only
-      dimname += (dimname=="dim" or dimname=="bin") ? std::to_string(dims[i]) : "";
+      // TODO: generalize this to all tags, for now hardcoding to dim, bin, and plev only
+      dimname += (dimname=="dim" or dimname=="bin" or dimname=="plev") ? std::to_string(dims[i]) : "";
 
       auto is_partitioned = m_io_grid->get_partitioned_dim_tag()==tags[i];
       int dimlen = is_partitioned
@@ -343,7 +380,7 @@ void AtmosphereOutput::
 init_timestep (const util::TimeStamp& start_of_step)
 {
   for (auto diag : m_diagnostics) {
-    diag->init_timestep(start_of_step);
+    m_diag_registry->init_timestep(diag,start_of_step);
   }
 }
 
@@ -402,13 +439,19 @@ run (const std::string& filename,
   auto fm_scorpio = m_field_mgrs[Scorpio];
   auto fm_after_hr = m_field_mgrs[AfterHorizRemap];
 
+  // For non-instant output, all eligible fields (and their avg counts) are accumulated
+  // with a single fused kernel, rather than with one (or more) kernel(s) per field.
+  if (m_avg_type!=OutputAvgType::Instant and not m_batch_update) {
+    setup_batch_update();
+  }
+
   // If tracking avg count, update the count at each field location separately.
   // We do count++ only where the fields are NOT equal to the fill value.
   // Note, we assume that all fields that share a layout are also masked/filled in the same way.
   if (m_track_avg_cnt) {
     // Since 2+ fields may have same avg count, make sure we update the counts only ONCE.
     for (auto& [fname, count] : m_field_to_avg_count) {
-      count.get_header().set_extra_data("updated",false);
+      count.get_header().set_extra_data("updated",m_batched_counts.count(count.name())==1);
     }
 
     for (auto& [fname, count] : m_field_to_avg_count) {
@@ -425,54 +468,59 @@ run (const std::string& filename,
       // mask=1 for "good" entries, and mask=0 otherwise.
       count.update(mask,1,1);
 
-      // Handle writing the average count variables to file
-      if (is_write_step) {
-        // Bring data to host
-        count.sync_to_host();
-
-        auto func_start = std::chrono::steady_clock::now();
-        scorpio::write_var(filename,count.name(),count.get_internal_view_data<int,Host>());
-        auto func_finish = std::chrono::steady_clock::now();
-        auto duration_loc = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start);
-        duration_write += duration_loc.count();
-
-        // If it's an output step, for Avg we need to ensure count>threshold.
-        // If count<=threshold, we set count=fill_value, so that fill_val propagates
-        // to the output fields when we divide by count later
-        if (output_step and m_avg_type==OutputAvgType::Average) {
-          int min_count = static_cast<int>(std::floor(m_avg_coeff_threshold*nsteps_since_last_output));
-
-          // Recycle mask to find where count<thresh
-          compute_mask<Comparison::LE>(count,min_count,mask);
-
-          // Later, we divide fields by count. By setting count=1 where count<thresholt,
-          // we can later do
-          //   f.scale_inv(count); // Requires count!=0 anywhere
-          //   f.deep_copy(fill_val,mask)
-          count.deep_copy(1,mask);
-        }
-      }
       count.get_header().set_extra_data("updated",true);
     }
   }
 
+  if (m_batch_update) {
+    start_timer("EAMxx::IO::batch_update");
+    m_batch_update->run();
+    stop_timer("EAMxx::IO::batch_update");
+  }
+
+  // Handle writing the average count variables to file
+  if (m_track_avg_cnt and is_write_step) {
+    for (auto& count : m_avg_counts) {
+      duration_write += write_field<int>(filename,count);
+
+      // If it's an output step, for Avg we need to ensure count>threshold.
+      // If count<=threshold, we set count=fill_value, so that fill_val propagates
+      // to the output fields when we divide by count later
+      if (output_step and m_avg_type==OutputAvgType::Average) {
+        int min_count = static_cast<int>(std::floor(m_avg_coeff_threshold*nsteps_since_last_output));
+        auto mask = count.get_header().get_extra_data<Field>("mask");
+
+        // Recycle mask to find where count<thresh
+        compute_mask<Comparison::LE>(count,min_count,mask);
+
+        // Later, we divide fields by count. By setting count=1 where count<thresholt,
+        // we can later do
+        //   f.scale_inv(count); // Requires count!=0 anywhere
+        //   f.deep_copy(fill_val,mask)
+        count.deep_copy(1,mask);
+      }
+    }
+  }
+
   // Take care of updating and possibly writing fields.
   for (auto const& name : m_fields_names) {
     // Get all the info for this field.
     const auto& f_in  = fm_after_hr->get_field(name);
           auto& f_out = fm_scorpio->get_field(name);
 
-    switch (m_avg_type) {
-      case OutputAvgType::Instant:
-        f_out.deep_copy(f_in);  break; // Note: if f_in aliases f_out, this is a no-op
-      case OutputAvgType::Max:
-        f_out.max(f_in);        break;
-      case OutputAvgType::Min:
-        f_out.min(f_in);        break;
-      case OutputAvgType::Average:
-        f_out.update(f_in,1,1); break;
-      default:
-        EKAT_ERROR_MSG ("Unexpected/unsupported averaging type.\n");
+    if (m_batched_fields.count(name)==0) {
+      switch (m_avg_type) {
+        case OutputAvgType::Instant:
+          f_out.deep_copy(f_in);  break; // Note: if f_in aliases f_out, this is a no-op
+        case OutputAvgType::Max:
+          f_out.max(f_in);        break;
+        case OutputAvgType::Min:
+          f_out.min(f_in);        break;
+        case OutputAvgType::Average:
+          f_out.update(f_in,1,1); break;
+        default:
+          EKAT_ERROR_MSG ("Unexpected/unsupported averaging type.\n");
+      }
     }
 
     if (is_write_step) {
@@ -492,25 +540,78 @@ run (const std::string& filename,
         }
       }
 
-      // Bring data to host
-      f_out.sync_to_host();
-
-      // Write
-      auto func_start = std::chrono::steady_clock::now();
-      scorpio::write_var(filename,name,f_out.get_internal_view_data<Real,Host>());
-      auto func_finish = std::chrono::steady_clock::now();
-      auto duration_loc = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start);
-      duration_write += duration_loc.count();
+      if (output_step and m_keep_mantissa_bits>0) {
+        // Round a copy, since f_out may alias a model field, and, for non-instant output,
+        // checkpoint files (which are never rounded) are written from f_out as well
+        auto& f_rounded = m_bit_rounded_fields[name];
+        if (not f_rounded.is_allocated()) {
+          f_rounded = f_out.clone();
+        }
+        bit_round(f_out,f_rounded,m_keep_mantissa_bits,m_fill_value);
+        duration_write += write_field<Real>(filename,f_rounded);
+      } else {
+        duration_write += write_field<Real>(filename,f_out);
+      }
     }
   }
 
   if (is_write_step) {
     if (m_atm_logger) {
-      m_atm_logger->info("  Done! Elapsed time: " + std::to_string(duration_write/1000.0) +" seconds");
+      m_atm_logger->info(std::string("  Done! Elapsed time") + (m_async_write ? " (async)" : "") +
+                         ": " + std::to_string(duration_write/1000.0) +" seconds");
     }
   }
 } // run
 
+template<typename T>
+double AtmosphereOutput::
+write_field (const std::string& filename, const Field& f)
+{
+  auto func_start = std::chrono::steady_clock::now();
+  if (m_async_write and not m_async_staging) {
+    // The caller guarantees the field is not modified until all pending writes
+    // complete, so write straight from the field host view. The copy to host of
+    // the next field overlaps with the write of this one.
+    f.sync_to_host();
+    const auto data = f.get_internal_view_data<const T,Host>();
+    scorpio::enqueue_async_task([filename,name=f.name(),data](){
+      scorpio::write_var(filename,name,data);
+    });
+  } else if (m_async_write) {
+    // Snapshot device data into the staging buffer, so that the field can be
+    // modified (e.g., reset for the next avg window) while the write is pending.
+    const auto& name = f.name();
+    const auto size = f.get_header().get_alloc_properties().get_num_scalars();
+    auto& buf = m_staging_buffers[name];
+    if (buf.size()==0) {
+      buf = staging_view_t(name+"_staging",size*sizeof(T));
+    } else if (buf.use_count()>1) {
+      // A previous write of this var is still holding the buffer
+      scorpio::wait_for_async_tasks();
+    }
+
+    using src_view_t = Kokkos::View<const T*,DefaultDevice,Kokkos::MemoryUnmanaged>;
+    using dst_view_t = Kokkos::View<T*,staging_mem_space,Kokkos::MemoryUnmanaged>;
+    src_view_t src(f.get_internal_view_data<const T>(),size);
+    dst_view_t dst(reinterpret_cast<T*>(buf.data()),size);
+    Kokkos::deep_copy(dst,src);
+
+    // The task holds a copy of the view, so that we can detect if it's still in use
+    scorpio::enqueue_async_task([filename,name,buf](){
+      scorpio::write_var(filename,name,reinterpret_cast<const T*>(buf.data()));
+    });
+  } else {
+    // Bring data to host
+    f.sync_to_host();
+
+    // Write
+    scorpio::write_var(filename,f.name(),f.get_internal_view_data<T,Host>());
+  }
+  auto func_finish = std::chrono::steady_clock::now();
+  auto duration_loc = std::chrono::duration_cast<std::chrono::milliseconds>(func_finish - func_start);
+  return duration_loc.count();
+}
+
 long long AtmosphereOutput::
 res_dep_memory_footprint () const
 {
@@ -559,10 +660,10 @@ void AtmosphereOutput::set_avg_cnt_tracking(const std::string& name, const Field
                          ? m_io_grid->get_special_tag_name(t)
                          : layout.names()[i];
 
-    // If t==CMP, and the name stored in the layout is "dim" (the default) or "bin",
+    // If t==CMP, and the name stored in the layout is "dim" (the default), "bin", or "plev",
     // we append also the extent, to allow different vector dims in the file
-    // TODO: generalize this to all tags, for now hardcoding to dim and bin only
-    tag_name += (tag_name=="dim" or tag_name=="bin") ? std::to_string(layout.dim(i)) : "";
+    // TODO: generalize this to all tags, for now hardcoding to dim, bin, and plev only
+    tag_name += (tag_name=="dim" or tag_name=="bin" or tag_name=="plev") ? std::to_string(layout.dim(i)) : "";
 
     avg_cnt_name += "_" + tag_name;
   }
@@ -593,6 +694,52 @@ void AtmosphereOutput::set_avg_cnt_tracking(const std::string& name, const Field
 }
 /* ---------------------------------------------------------- */
 void AtmosphereOutput::
+setup_batch_update ()
+{
+  CombineMode cm = CombineMode::Update;
+  switch (m_avg_type) {
+    case OutputAvgType::Max:
+      cm = CombineMode::Max;    break;
+    case OutputAvgType::Min:
+      cm = CombineMode::Min;    break;
+    case OutputAvgType::Average:
+      cm = CombineMode::Update; break;
+    default:
+      EKAT_ERROR_MSG ("Error! Batched field update not supported for Instant output.\n");
+  }
+  m_batch_update = std::make_shared<FieldBatchUpdate>(cm);
+
+  auto fm_scorpio = m_field_mgrs[Scorpio];
+  auto fm_after_hr = m_field_mgrs[AfterHorizRemap];
+
+  for (const auto& name : m_fields_names) {
+    const auto& f_in  = fm_after_hr->get_field(name);
+    const auto& f_out = fm_scorpio->get_field(name);
+    if (not FieldBatchUpdate::supports(f_in,f_out)) {
+      continue;
+    }
+
+    // The avg count is updated together with the first field that uses it
+    // (same as the un-batched logic in 'run', which loops over m_field_to_avg_count)
+    Field count;
+    if (m_track_avg_cnt) {
+      const auto& c = m_field_to_avg_count.at(name);
+      if (m_batched_counts.count(c.name())==0) {
+        const auto& owner = std::find_if(m_field_to_avg_count.begin(),m_field_to_avg_count.end(),
+                                         [&](const auto& it) { return it.second.name()==c.name(); })->first;
+        if (owner==name) {
+          count = c;
+          m_batched_counts.insert(c.name());
+        }
+      }
+    }
+    m_batch_update->add(f_in,f_out,count);
+    m_batched_fields.insert(name);
+  }
+  m_batch_update->setup();
+}
+/* ---------------------------------------------------------- */
+void AtmosphereOutput::
 reset_scorpio_fields()
 {
   // Reset the fields for scorpio to whatever is the proper accumulation value (if avg!=Instant)
@@ -629,6 +776,10 @@ register_variables(const std::string& filename,
       "  - input value: " + fp_precision + "\n"
       "  - supported values: float, single, double, real\n");
 
+  // Compression is set on each var, but may not be supported by the file iotype
+  const bool compress = m_deflate_level>0 or m_chunk_sizes.size()>0;
+  bool compressed = true;
+
   // Cycle through all fields and register.
   for (auto const& name : m_fields_names) {
     const auto& f = m_field_mgrs[Scorpio]->get_field(name);
@@ -668,6 +819,9 @@ register_variables(const std::string& filename,
     } else {
       scorpio::define_var (filename, name, units, dimnames,
                             "real",fp_precision, m_add_time_dim);
+      if (compress) {
+        compressed &= scorpio::set_var_compression(filename,name,m_deflate_level,m_shuffle,m_chunk_sizes);
+      }
 
       // Add FillValue as an attribute of each variable
       // FillValue is a protected metadata, do not add it if it already existed
@@ -752,8 +906,16 @@ register_variables(const std::string& filename,
       // variables we don't need to add all of the extra metadata.  So we simply
       // define the variable.
       scorpio::define_var(filename, name, dimnames, "int", m_add_time_dim);
+      if (compress) {
+        compressed &= scorpio::set_var_compression(filename,name,m_deflate_level,m_shuffle,m_chunk_sizes);
+      }
     }
   }
+
+  if (not compressed and m_atm_logger) {
+    m_atm_logger->warn("[EAMxx::scorpio_output] WARNING! Compression requires a NetCDF-4 iotype (netcdf4c or netcdf4p).\n"
+                       "  Variables in file '" + filename + "' will not be compressed.\n");
+  }
 } // register_variables
 
 void AtmosphereOutput::set_decompositions(const std::string& filename)
@@ -826,25 +988,29 @@ compute_diagnostics(const bool allow_invalid_fields)
         " - diag name: " + diag->get_diagnostic().name() + "\n"
         " - dep  name: " + dep_name + "\n");
 
+    // NOTE: if the diag is shared with other streams, and it was already
+    //       computed with the current inputs, the registry won't recompute it
     auto d = diag->get_diagnostic();
     if (computable) {
-      computed = true;
-      diag->compute_diagnostic();
-      if (not d.get_header().get_tracking().get_time_stamp().is_valid()) {
-        computed = false;
-      }
+      computed = m_diag_registry->compute(diag);
     }
 
     if (not computed) {
       // The diag was either not computable or it may have failed to compute
       // (e.g., t=0 output with a flux-like diag).
       // If we're allowing invalid fields, then we should simply set diag=m_fill_value
+      // NOTE: the diag may be shared with other streams, but the registry key includes
+      //       the fill value, so all the streams sharing it would fill it the same way.
       EKAT_REQUIRE_MSG (allow_invalid_fields,
         "Error! Failed to compute diagnostic.\n"
         " - diag name: " + diag->get_diagnostic().name() + "\n");
       d.deep_copy(m_fill_value);
     }
   }
+
+  // Diags like horiz averages defer their allreduce, so that the registry
+  // can reduce all of them at once
+  m_diag_registry->finish_reductions();
 }
 
 void AtmosphereOutput::
@@ -861,10 +1027,15 @@ init_diagnostics ()
   //       inside a std::function, so that the lambda body CAN call create_diag.
   std::function<void(const std::string&)> create_diag;
   create_diag = [&](const std::string& name) {
-    // Create the diag
-    auto diag = create_diagnostic(name,fm_model->get_grid());
-
-    // Set inputs in the diag (and recurse if inputs are also diags not yet created)
+    // Create the diag, unless another stream already did
+    const auto key = DiagnosticRegistry::make_key(name,fm_grid->name(),m_fill_value);
+    const bool shared = m_diag_registry->has_diag(key);
+    auto diag = shared ? m_diag_registry->get_diag(key)
+                       : create_diagnostic(name,fm_model->get_grid());
+
+    // Set inputs in the diag (and recurse if inputs are also diags not yet created).
+    // NOTE: we recurse also for shared diags, so that their dependencies are
+    //       added to m_diagnostics *before* the diag itself
     for (const auto& freq : diag->get_required_field_requests()) {
       const auto& dep_name = freq.fid.name();
 
@@ -873,12 +1044,17 @@ init_diagnostics ()
         create_diag(dep_name);
       }
 
-      auto dep = fm_model->get_field(dep_name);
-      diag->set_required_field(dep);
+      if (not shared) {
+        auto dep = fm_model->get_field(dep_name);
+        diag->set_required_field(dep);
+      }
     }
 
     // Initialize the diag
-    diag->initialize(util::TimeStamp(),RunType::Initial);
+    if (not shared) {
+      diag->initialize(util::TimeStamp(),RunType::Initial);
+      m_diag_registry->add_diag(key,diag);
+    }
 
     // Set the diag field in the FM
     auto diag_field = diag->get_diagnostic();
@@ -896,6 +1072,13 @@ init_diagnostics ()
                         + params.get<std::string>("pressure_value")
                         + params.get<std::string>("pressure_units");
       m_track_avg_cnt |= m_avg_type!=OutputAvgType::Instant;
+    } else if (diag->name()=="FieldAtPressureLevels") {
+      // All fields at the same set of levels share the mask, hence the avg count
+      params.set<double>("mask_value",m_fill_value);
+      diag_avg_cnt_name = "_"
+                        + params.get<std::string>("pressure_values")
+                        + params.get<std::string>("pressure_units");
+      m_track_avg_cnt |= m_avg_type!=OutputAvgType::Instant;
     } else if (diag->name()=="FieldAtHeight") {
       if (params.get<std::string>("surface_reference")=="sealevel") {
         diag_avg_cnt_name = "_"
@@ -938,7 +1121,7 @@ get_var_dimnames (const FieldLayout& layout) const
     auto tag_name = m_io_grid->has_special_tag_name(t)
                   ? m_io_grid->get_special_tag_name(t)
                   : layout.names()[i];
-    if (tag_name=="dim" or tag_name=="bin") {
+    if (tag_name=="dim" or tag_name=="bin" or tag_name=="plev") {
       tag_name += std::to_string(layout.dim(i));
     }
     dims.push_back(tag_name); // Add dimensions string to vector of dims.
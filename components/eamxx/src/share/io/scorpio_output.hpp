@@ -3,7 +3,9 @@
 
 #include "share/io/eamxx_scorpio_interface.hpp"
 #include "share/io/eamxx_io_utils.hpp"
+#include "share/io/eamxx_io_diag_registry.hpp"
 #include "share/field/field_manager.hpp"
+#include "share/field/field_batch_update.hpp"
 #include "share/grid/abstract_grid.hpp"
 #include "share/grid/grids_manager.hpp"
 #include "share/util/eamxx_time_stamp.hpp"
@@ -12,6 +14,9 @@
 
 #include "ekat/ekat_parameter_list.hpp"
 #include "ekat/mpi/ekat_comm.hpp"
+
+#include <set>
+
 /*  The AtmosphereOutput class handles an output stream in SCREAM.
  *  Typical usage is to register an AtmosphereOutput object with the OutputManager (see eamxx_output_manager.hpp
  *
@@ -46,6 +51,9 @@
  *  restart:
  *    filename_prefix:                  STRING                (default: ${filename_prefix})
  *    skip_restart_if_rhist_not_found:  BOOL                  (default: false)
+ *  async_write:                        BOOL                  (default: false)
+ *  async_max_pending_writes:           INT                   (default: 1024)
+ *  async_write_staging:                BOOL                  (default: true)
  *  -----
  *  The meaning of these parameters is the following:
  *  - filename_prefix: the output filename root.
@@ -76,6 +84,15 @@
  *    - skip_restart_if_rhist_not_found: if this is a restarted run and this is true, skip the
  *      hist restart if the proper filename is not found in rpointer. Allows to add a new stream
  *      upon restart.
+ *  - async_write: if true, on write steps the output fields are copied into host staging buffers,
+ *    and the actual writes are carried out by the scorpio background thread, while the model
+ *    proceeds (see scorpio::enqueue_async_task). For model restart output, this is
+ *    set by OutputManager from the model_restart 'pipelined_io' option.
+ *  - async_max_pending_writes: max number of writes that can be queued before the model blocks.
+ *  - async_write_staging: if false, async writes are done directly from the fields host views,
+ *    skipping the staging buffers. The caller must then wait for all pending writes before
+ *    the fields are modified. Used by model restart output, which completes its writes
+ *    before the model proceeds.
 
  *  Notes:
  *   - you can specify lists with either of the two syntaxes:
@@ -116,9 +133,12 @@ public:
   virtual ~AtmosphereOutput () = default;
 
   // Constructor
+  // If diag_registry is provided, diagnostics are shared with all other streams using
+  // the same registry (see eamxx_io_diag_registry.hpp). Otherwise, a private one is used.
   AtmosphereOutput(const ekat::Comm& comm, const ekat::ParameterList& params,
                    const std::shared_ptr<const fm_type>& field_mgr,
-                   const std::string& grid_name);
+                   const std::string& grid_name,
+                   const std::shared_ptr<DiagnosticRegistry>& diag_registry = nullptr);
 
   // Short version for outputing a list of fields (no remapping supported)
   AtmosphereOutput(const ekat::Comm& comm,
@@ -165,6 +185,14 @@ protected:
   // Tracking the averaging of any filled values:
   void set_avg_cnt_tracking(const std::string& name, const FieldLayout& layout);
 
+  // Create the fused kernel used to accumulate (and update avg counts of) all eligible fields
+  void setup_batch_update ();
+
+  // Write the field to file (synchronously or asynchronously), and returns the time (in ms)
+  // spent by the calling thread. Requires f to be contiguous (no padding, no parent).
+  template<typename T>
+  double write_field (const std::string& filename, const Field& f);
+
   // --- Internal variables --- //
   ekat::Comm                          m_comm;
 
@@ -211,6 +239,7 @@ protected:
   strmap_t<strvec_t>                    m_vars_dims;
   strmap_t<int>                         m_dims_len;
   std::list<diag_ptr_type>              m_diagnostics;
+  std::shared_ptr<DiagnosticRegistry>   m_diag_registry;
 
   DefaultMetadata                       m_default_metadata;
 
@@ -223,6 +252,39 @@ protected:
 
   bool m_add_time_dim;
   bool m_track_avg_cnt = false;
+
+  // For non-instant output, accumulate all fields (and their avg counts) with a single kernel.
+  // Fields (and counts) that cannot be handled by the batch (e.g., padded/subfields) are
+  // updated one at a time.
+  std::shared_ptr<FieldBatchUpdate>     m_batch_update;
+  std::set<std::string>                 m_batched_fields;
+  std::set<std::string>                 m_batched_counts;
+
+  // For async output, each variable is snapshotted into a host staging buffer,
+  // which is then handed to the scorpio background thread for writing.
+  // NOTE: we store the buffers as raw bytes, since avg counts are stored as int
+#ifdef KOKKOS_HAS_SHARED_HOST_PINNED_SPACE
+  using staging_mem_space = Kokkos::SharedHostPinnedSpace;
+#else
+  using staging_mem_space = Kokkos::HostSpace;
+#endif
+  using staging_view_t = Kokkos::View<char*,staging_mem_space>;
+
+  bool                                  m_async_write = false;
+  bool                                  m_async_staging = true;
+  strmap_t<staging_view_t>              m_staging_buffers;
+
+  // Lossless compression settings (only honored by NetCDF-4 iotypes)
+  int                                   m_deflate_level = 0;
+  bool                                  m_shuffle = true;
+  strmap_t<int>                         m_chunk_sizes;
+
+  // If >0, output fields are rounded to this many mantissa bits before writing.
+  // Rounding is done on device into a copy of the output field, so that the
+  // averaging buffers (and checkpoint files) retain full precision.
+  int                                   m_keep_mantissa_bits = 0;
+  strmap_t<Field>                       m_bit_rounded_fields;
+
   std::string m_decomp_dimname = "";
 
   // The logger to be used throughout the ATM to log message
@@ -39,6 +39,14 @@ TEST_CASE("create_diag")
 
     REQUIRE_THROWS(create_diagnostic("BlaH_123_at_400KPa",grid)); // invalid units
 
+    // FieldAtPressureLevels
+    auto d4m = create_diagnostic("BlaH_123_at_1000_850_500hPa",grid);
+    REQUIRE (std::dynamic_pointer_cast<FieldAtPressureLevels>(d4m)!=nullptr);
+    auto d5m = create_diagnostic("BlaH_123_at_10.5_20mb",grid);
+    REQUIRE (std::dynamic_pointer_cast<FieldAtPressureLevels>(d5m)!=nullptr);
+
+    REQUIRE_THROWS(create_diagnostic("BlaH_123_at_850_500KPa",grid)); // invalid units
+
     // FieldAtHeight
     auto d7 = create_diagnostic("BlaH_123_at_10m_above_sealevel",grid);
     REQUIRE (std::dynamic_pointer_cast<FieldAtHeight>(d7)!=nullptr);
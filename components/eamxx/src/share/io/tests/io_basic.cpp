@@ -126,7 +126,8 @@ get_fm (const std::shared_ptr<const AbstractGrid>& grid,
 
 // Returns fields after initialization
 void write (const std::string& avg_type, const std::string& freq_units,
-            const int freq, const int seed, const ekat::Comm& comm)
+            const int freq, const int seed, const ekat::Comm& comm,
+            const bool async = false)
 {
   // Create grid
   auto gm = get_gm(comm);
@@ -152,6 +153,7 @@ void write (const std::string& avg_type, const std::string& freq_units,
   ctrl_pl.set("frequency_units",freq_units);
   ctrl_pl.set("frequency",freq);
   ctrl_pl.set("save_grid_data",false);
+  om_pl.set("async_write",async);
 
   // While setting this is in practice irrelevant (we would close
   // the file anyways at the end of the run), we can test that the OM closes
@@ -324,4 +326,28 @@ TEST_CASE ("io_basic") {
   scorpio::finalize_subsystem();
 }
 
+TEST_CASE ("io_basic_async") {
+  std::vector<std::string> avg_type = {
+    "INSTANT",
+    "MAX",
+    "MIN",
+    "AVERAGE"
+  };
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+  scorpio::init_subsystem(comm);
+
+  auto seed = get_random_test_seed(&comm);
+
+  // NOTE: if MPI_THREAD_MULTIPLE is not available, writes are synchronous,
+  //       but we still check that the output is correct. Otherwise, the async
+  //       tasks are still enabled when reading, so the reads are pipelined.
+  const int freq = 5;
+  for (const auto& avg : avg_type) {
+    write(avg,"nsteps",freq,seed,comm,true);
+    read (avg,"nsteps",freq,seed,comm);
+  }
+  scorpio::finalize_subsystem();
+}
+
 } // anonymous namespace
@@ -276,6 +276,65 @@ void read (const int seed, const ekat::Comm& comm)
   }
 }
 
+// Two streams requesting the same diag should share it (and compute it once per step)
+void write_shared (const int seed, const ekat::Comm& comm)
+{
+  auto gm = get_gm(comm);
+  auto grid = gm->get_grid("point_grid");
+
+  auto t0 = get_t0();
+  auto dt = get_dt();
+
+  auto fm = get_fm(grid,t0,seed);
+  std::vector<std::string> fnames;
+  for (auto it : fm->get_repo()) {
+    fnames.push_back(it.second->name());
+  }
+  fnames.push_back("MyDiag");
+
+  auto registry = std::make_shared<DiagnosticRegistry>();
+  std::vector<std::shared_ptr<OutputManager>> oms;
+  for (std::string avg_type : {"instant","average"}) {
+    ekat::ParameterList om_pl;
+    om_pl.set("filename_prefix",std::string("io_diags_shared"));
+    om_pl.set("field_names",fnames);
+    om_pl.set("averaging_type", avg_type);
+    auto& ctrl_pl = om_pl.sublist("output_control");
+    ctrl_pl.set("frequency_units",std::string("nsteps"));
+    ctrl_pl.set("frequency",2);
+    ctrl_pl.set("save_grid_data",false);
+
+    auto om = oms.emplace_back(std::make_shared<OutputManager>());
+    om->initialize(comm, om_pl, t0, false);
+    om->set_diagnostic_registry(registry);
+    om->setup(fm,gm->get_grid_names());
+  }
+  REQUIRE (registry->size()==1);
+
+  Field one = fm->get_field(fnames[0]).clone("one");
+  one.deep_copy(1.0);
+  for (int n=1; n<=2; ++n) {
+    auto t = t0 + n*dt;
+    for (auto it : fm->get_repo()) {
+      auto& f = *it.second;
+      f.get_header().get_tracking().update_time_stamp(t);
+      f.update(one,1.0,1.0);
+    }
+    for (auto& om : oms) {
+      om->init_timestep(t-dt,dt);
+    }
+    for (auto& om : oms) {
+      om->run(t);
+    }
+    // Inputs changed once per step, so the diag is evaluated once per step
+    REQUIRE (registry->num_evaluations()==n);
+  }
+
+  for (auto& om : oms) {
+    om->finalize();
+  }
+}
+
 TEST_CASE ("io_diags") {
   ekat::Comm comm(MPI_COMM_WORLD);
   scorpio::init_subsystem(comm);
@@ -300,6 +359,10 @@ TEST_CASE ("io_diags") {
   write(seed,comm);
   read(seed,comm);
   print(" PASS\n");
+
+  print ("-> Share diagnostic across streams ", 40);
+  write_shared(seed,comm);
+  print(" PASS\n");
   scorpio::finalize_subsystem();
 }
 
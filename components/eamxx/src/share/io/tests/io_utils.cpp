@@ -3,8 +3,15 @@
 #include <share/io/eamxx_io_utils.hpp>
 #include <share/io/eamxx_io_control.hpp>
 #include <share/util/eamxx_time_stamp.hpp>
+#include <share/field/field.hpp>
+#include <share/util/eamxx_universal_constants.hpp>
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <limits>
+#include <type_traits>
 
 TEST_CASE ("find_filename_in_rpointer") {
   using namespace scream;
@@ -145,3 +152,70 @@ TEST_CASE ("io_control") {
     REQUIRE (not control.is_write_step(t3));
   }
 }
+
+TEST_CASE ("bit_round") {
+  using namespace scream;
+  using namespace ShortFieldTagsNames;
+
+  const int ncols = 4;
+  const int keepbits = 7;
+  const double fill_value = constants::DefaultFillValue<float>().value;
+
+  auto test = [&](auto dummy) {
+    using T = decltype(dummy);
+    using U = typename std::conditional<sizeof(T)==4,std::uint32_t,std::uint64_t>::type;
+    constexpr int nmant = std::numeric_limits<T>::digits - 1;
+    const auto dt = sizeof(T)==4 ? DataType::FloatType : DataType::DoubleType;
+
+    FieldIdentifier fid ("f", {{COL},{ncols}}, ekat::units::Units::nondimensional(), "some_grid", dt);
+    Field src(fid), dst(fid);
+    src.allocate_view();
+    dst.allocate_view();
+
+    auto to_bits = [](const T x) { U u; std::memcpy(&u,&x,sizeof(T)); return u; };
+    auto from_bits = [](const U u) { T x; std::memcpy(&x,&u,sizeof(T)); return x; };
+
+    // A regular value, a tie (1 followed by half an ulp at keepbits), and fill/inf
+    const U one = to_bits(T(1));
+    const U half_ulp = U(1) << (nmant-keepbits-1);
+    const T x = T(0.1234567890123);
+    const T tie = from_bits(one + half_ulp);
+
+    auto src_h = src.get_view<T*,Host>();
+    src_h(0) = x;
+    src_h(1) = tie;
+    src_h(2) = static_cast<T>(fill_value);
+    src_h(3) = std::numeric_limits<T>::infinity();
+    src.sync_to_dev();
+
+    bit_round(src,dst,keepbits,fill_value);
+    dst.sync_to_host();
+    auto dst_h = dst.get_view<const T*,Host>();
+
+    // Trailing mantissa bits are zero, and the rounding error is at most half an ulp
+    const U trailing = (U(1) << (nmant-keepbits)) - 1;
+    REQUIRE ((to_bits(dst_h(0)) & trailing)==0);
+    REQUIRE (std::abs(dst_h(0)-x)<=std::ldexp(std::abs(x),-keepbits-1));
+
+    // Ties go to the even neighbor, which here is 1
+    REQUIRE (dst_h(1)==T(1));
+
+    // Fill value and inf are untouched
+    REQUIRE (dst_h(2)==static_cast<T>(fill_value));
+    REQUIRE (dst_h(3)==std::numeric_limits<T>::infinity());
+
+    // Keeping all the bits is a copy
+    bit_round(src,dst,nmant,fill_value);
+    dst.sync_to_host();
+    for (int i=0; i<ncols; ++i) {
+      REQUIRE (dst_h(i)==src_h(i));
+    }
+  };
+
+  SECTION ("float") {
+    test(float(0));
+  }
+  SECTION ("double") {
+    test(double(0));
+  }
+}
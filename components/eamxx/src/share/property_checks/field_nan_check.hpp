@@ -4,6 +4,8 @@
 #include "share/property_checks/property_check.hpp"
 #include "share/grid/abstract_grid.hpp"
 
+#include <limits>
+
 namespace scream
 {
 
@@ -23,6 +25,13 @@ public:
 
   ResultAndMsg check() const override;
 
+  // NaN (and inf) values fail any comparison with finite bounds
+  bool get_screening_bounds (double& lb, double& ub) const override {
+    lb = -std::numeric_limits<double>::max();
+    ub =  std::numeric_limits<double>::max();
+    return true;
+  }
+
 // CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
 #ifndef EAMXX_ENABLE_GPU
 protected:
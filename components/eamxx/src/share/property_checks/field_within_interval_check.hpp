@@ -41,6 +41,12 @@ public:
 
   ResultAndMsg check() const override;
 
+  bool get_screening_bounds (double& lb, double& ub) const override {
+    lb = m_lb;
+    ub = m_ub;
+    return true;
+  }
+
 // CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
 #ifndef EAMXX_ENABLE_GPU
 protected:
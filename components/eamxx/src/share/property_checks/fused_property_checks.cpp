@@ -0,0 +1,199 @@
+#include "share/property_checks/fused_property_checks.hpp"
+
+#include <ekat/kokkos/ekat_kokkos_utils.hpp>
+
+#include <algorithm>
+
+namespace scream
+{
+
+bool FusedPropertyChecks::
+add (const std::shared_ptr<PropertyCheck>& pc)
+{
+  EKAT_REQUIRE_MSG (pc!=nullptr,
+      "Error! Invalid property check pointer in FusedPropertyChecks::add.\n");
+
+  Entry e;
+  if (pc->fields().size()!=1 or not pc->get_screening_bounds(e.lb,e.ub)) {
+    return false;
+  }
+
+  const auto& f  = pc->fields().front();
+  const auto& fh = f.get_header();
+  if (not f.is_allocated() or f.data_type()!=DataType::RealType) {
+    return false;
+  }
+
+  auto prod = [](const std::vector<int>& dims, const int beg, const int end) {
+    int p = 1;
+    for (int i=beg; i<end; ++i) {
+      p *= dims[i];
+    }
+    return p;
+  };
+
+  const auto& ap = fh.get_alloc_properties();
+  int offset = 0;
+  if (not ap.is_subfield()) {
+    const auto& dims = fh.get_identifier().get_layout().dims();
+    const int rank = dims.size();
+    if (rank==0) {
+      e.n_outer = e.n_inner = e.stride = 1;
+    } else {
+      e.n_outer = prod(dims,0,rank-1);
+      e.n_inner = dims.back();
+      e.stride  = ap.get_last_extent();
+    }
+  } else {
+    // Only static single-slice subfields of a regular field
+    const auto& info   = ap.get_subview_info();
+    const auto  parent = fh.get_parent();
+    if (info.dynamic or info.slice_idx_end!=-1 or parent==nullptr or parent->get_parent()!=nullptr) {
+      return false;
+    }
+    const auto& pdims = parent->get_identifier().get_layout().dims();
+    const int prank = pdims.size();
+    const int L = parent->get_alloc_properties().get_last_extent();
+    const int k = info.slice_idx;
+    if (info.dim_idx==prank-1) {
+      // Slicing the last dim: one entry per row of the parent
+      e.n_outer = prod(pdims,0,prank-1);
+      e.n_inner = 1;
+      e.stride  = L;
+      offset    = k;
+    } else if (info.dim_idx==prank-2) {
+      // Slicing the second to last dim: one row every pdims[prank-2] rows of the parent
+      e.n_outer = prod(pdims,0,prank-2);
+      e.n_inner = pdims.back();
+      e.stride  = pdims[prank-2]*L;
+      offset    = k*L;
+    } else if (info.dim_idx==0) {
+      // Slicing the first dim: a contiguous chunk of rows of the parent
+      e.n_outer = prod(pdims,1,prank-1);
+      e.n_inner = pdims.back();
+      e.stride  = L;
+      offset    = k*e.n_outer*L;
+    } else {
+      return false;
+    }
+  }
+  e.data = f.get_internal_view_data<const Real>() + offset;
+
+  m_checks.push_back(pc);
+  m_entries.push_back(e);
+  m_setup_done = false;
+  return true;
+}
+
+const std::shared_ptr<PropertyCheck>& FusedPropertyChecks::
+get_check (const int i) const
+{
+  EKAT_REQUIRE_MSG (i>=0 and i<num_checks(),
+      "Error! Invalid property check index in FusedPropertyChecks::get_check.\n"
+      " - index     : " + std::to_string(i) + "\n"
+      " - num checks: " + std::to_string(num_checks()) + "\n");
+  return m_checks[i];
+}
+
+void FusedPropertyChecks::setup ()
+{
+  const int nchecks = num_checks();
+
+  m_entries_d   = view_1d<Entry>("fused_checks_entries",nchecks);
+  m_row_offsets = view_1d<int>("fused_checks_row_offsets",nchecks);
+  m_flags       = view_1d<int>("fused_checks_flags",nchecks);
+  m_flags_h     = Kokkos::create_mirror_view(m_flags);
+
+  auto entries_h = Kokkos::create_mirror_view(m_entries_d);
+  auto offsets_h = Kokkos::create_mirror_view(m_row_offsets);
+  m_num_rows  = 0;
+  m_max_inner = 1;
+  for (int i=0; i<nchecks; ++i) {
+    entries_h(i) = m_entries[i];
+    offsets_h(i) = m_num_rows;
+    m_num_rows  += m_entries[i].n_outer;
+    m_max_inner  = std::max(m_max_inner,m_entries[i].n_inner);
+  }
+  Kokkos::deep_copy(m_entries_d,entries_h);
+  Kokkos::deep_copy(m_row_offsets,offsets_h);
+
+  m_setup_done = true;
+}
+
+void FusedPropertyChecks::screen ()
+{
+  using ESU = ekat::ExeSpaceUtils<KT::ExeSpace>;
+
+  if (not m_setup_done) {
+    setup();
+  }
+  if (m_num_rows==0) {
+    return;
+  }
+
+  const int nchecks = num_checks();
+  const auto entries = m_entries_d;
+  const auto offsets = m_row_offsets;
+  const auto flags   = m_flags;
+  const auto policy  = ESU::get_default_team_policy(m_num_rows,m_max_inner);
+  Kokkos::parallel_for("FusedPropertyChecks::screen",policy,
+                       KOKKOS_LAMBDA(const KT::MemberType& team) {
+    const int row = team.league_rank();
+
+    // Find the check owning this row, i.e., the last one with offsets(ic)<=row
+    // (taking the last one skips checks with no rows)
+    int beg = 0, end = nchecks;
+    while (end-beg>1) {
+      const int mid = (beg+end)/2;
+      if (offsets(mid)<=row) {
+        beg = mid;
+      } else {
+        end = mid;
+      }
+    }
+    const auto& e = entries(beg);
+    const Real* v = e.data + (row-offsets(beg))*e.stride;
+
+    int nbad = 0;
+    Kokkos::parallel_reduce(Kokkos::TeamVectorRange(team,e.n_inner),
+                            [&](const int i, int& bad) {
+      const double x = v[i];
+      // NOTE: written so that NaN's count as bad
+      if (not (x>=e.lb and x<=e.ub)) {
+        ++bad;
+      }
+    },nbad);
+
+    // All teams write the same value, so there is no need for atomics
+    if (nbad>0) {
+      Kokkos::single(Kokkos::PerTeam(team),[&]{
+        flags(beg) = 1;
+      });
+    }
+  });
+}
+
+std::vector<int> FusedPropertyChecks::get_flagged () const
+{
+  std::vector<int> flagged;
+  if (not m_setup_done) {
+    return flagged;
+  }
+
+  Kokkos::deep_copy(m_flags_h,m_flags);
+  for (int i=0; i<num_checks(); ++i) {
+    if (m_flags_h(i)!=0) {
+      flagged.push_back(i);
+    }
+  }
+  return flagged;
+}
+
+void FusedPropertyChecks::reset_flags ()
+{
+  if (m_setup_done) {
+    Kokkos::deep_copy(m_flags,0);
+  }
+}
+
+} // namespace scream
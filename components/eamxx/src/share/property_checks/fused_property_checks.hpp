@@ -0,0 +1,95 @@
+#ifndef SCREAM_FUSED_PROPERTY_CHECKS_HPP
+#define SCREAM_FUSED_PROPERTY_CHECKS_HPP
+
+#include "share/property_checks/property_check.hpp"
+#include "share/eamxx_types.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace scream
+{
+
+/*
+ * Screen several property checks with a single kernel
+ *
+ * Running each property check separately costs one (or more) kernel launches and
+ * one device-to-host copy of the result per check. For an atm process with many
+ * checks, and fields that are small on each rank, this overhead can dominate the
+ * cost of the checks themselves. This class evaluates a pass/fail flag for all its
+ * checks in one kernel, writing the flags to a device buffer. The host only needs
+ * to copy the (small) array of flags back when it wants to know whether some check
+ * failed, and run check() (and possibly repair()) only for the flagged checks.
+ *
+ * Only checks that provide screening bounds (see PropertyCheck::get_screening_bounds)
+ * on a single Real field can be added. Each field is viewed as a set of rows of
+ * contiguous entries, which are mapped to the teams of the kernel. Besides regular
+ * fields (possibly padded), this supports single-slice subfields along the first or
+ * the last two dimensions of a field (e.g., a tracer of the tracers group).
+ *
+ * The flags are sticky: screen() only raises them, and reset_flags() must be called
+ * to clear them. This allows calling screen() several times before checking the flags.
+ */
+
+class FusedPropertyChecks {
+public:
+  using KT = KokkosTypes<DefaultDevice>;
+  template<typename T>
+  using view_1d = typename KT::template view_1d<T>;
+
+  FusedPropertyChecks () = default;
+  ~FusedPropertyChecks () = default;
+
+  // Add a check, and return true if it was added. Return false if the check
+  // cannot be screened by this class (in which case it must be run separately).
+  bool add (const std::shared_ptr<PropertyCheck>& pc);
+
+  int num_checks () const { return m_checks.size(); }
+
+  const std::shared_ptr<PropertyCheck>& get_check (const int i) const;
+
+  // Raise the flag of every check with an entry outside its screening bounds
+  void screen ();
+
+  // Copy the flags to host, and return the indices of the flagged checks
+  std::vector<int> get_flagged () const;
+
+  void reset_flags ();
+
+// CUDA requires the parent fcn of a KOKKOS_LAMBDA to have public access
+#ifndef EAMXX_ENABLE_GPU
+protected:
+#endif
+
+  // The check's field is viewed as n_outer rows of n_inner contiguous entries,
+  // the i-th row starting at data+i*stride.
+  struct Entry {
+    const Real* data;
+    int         n_outer;
+    int         n_inner;
+    int         stride;
+    double      lb;
+    double      ub;
+  };
+
+protected:
+
+  // Copy entries to device, and compute the row offsets of each check
+  void setup ();
+
+  std::vector<std::shared_ptr<PropertyCheck>> m_checks;
+  std::vector<Entry>                          m_entries;
+
+  bool m_setup_done = false;
+  int  m_num_rows   = 0;
+  int  m_max_inner  = 1;
+
+  view_1d<Entry>              m_entries_d;
+  view_1d<int>                m_row_offsets;  // m_row_offsets(i) is the first row of check i
+  view_1d<int>                m_flags;
+  view_1d<int>::HostMirror    m_flags_h;
+};
+
+} // namespace scream
+
+#endif // SCREAM_FUSED_PROPERTY_CHECKS_HPP
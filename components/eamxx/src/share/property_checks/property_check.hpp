@@ -118,6 +118,12 @@ public:
   // Whether the input check is the same as this class
   virtual bool same_as (const PropertyCheck& pc) const;
 
+  // If the check can be screened by verifying that all the entries of its (only)
+  // field are in [lb,ub], set the bounds and return true. The screening must be
+  // conservative: if all entries are in [lb,ub], the check must pass (but an entry
+  // outside [lb,ub] does not imply that check() fails). See FusedPropertyChecks.
+  virtual bool get_screening_bounds (double& /* lb */, double& /* ub */) const { return false; }
+
 protected:
   virtual void repair_impl () const {
     EKAT_ERROR_MSG ("Error! The method 'repair_impl' has not been overridden.\n"
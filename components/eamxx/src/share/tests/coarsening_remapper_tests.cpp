@@ -6,6 +6,8 @@
 #include "share/util/eamxx_setup_random_test.hpp"
 #include "share/field/field_utils.hpp"
 
+#include <filesystem>
+
 namespace scream {
 
 class CoarseningRemapperTester : public CoarseningRemapper {
@@ -64,6 +66,10 @@ public:
   view_1d<int>::HostMirror get_send_pid_lids_start () const {
     return cmvdc(m_send_pid_lids_start);
   }
+
+  const HorizRemapperData& get_remap_data () const {
+    return s_remapper_data.at(m_data_key);
+  }
 };
 
 void root_print (const std::string& msg, const ekat::Comm& comm) {
@@ -514,4 +520,66 @@ TEST_CASE("coarsening_remap")
   scorpio::finalize_subsystem();
 }
 
+TEST_CASE("coarsening_remap_cache")
+{
+  using gid_type = AbstractGrid::gid_type;
+
+  ekat::Comm comm(MPI_COMM_WORLD);
+
+  root_print ("\n +---------------------------------+\n",comm);
+  root_print (" |  Testing horiz remap data cache  |\n",comm);
+  root_print (" +---------------------------------+\n\n",comm);
+
+  scorpio::init_subsystem(comm);
+  auto engine = setup_random_test (&comm);
+
+  std::string filename = "cr_cache_tests_map." + std::to_string(comm.size()) + ".nc";
+  const int ngdofs_tgt = 2*comm.size();
+  create_remap_file(filename, ngdofs_tgt);
+  auto src_grid = build_src_grid(comm, ngdofs_tgt+1, engine);
+
+  // Start from an empty cache dir
+  const std::string cache_dir = "cr_cache_tests_dir." + std::to_string(comm.size());
+  if (comm.am_i_root()) {
+    std::filesystem::remove_all(cache_dir);
+  }
+  comm.barrier();
+  HorizRemapperData::set_cache_dir(cache_dir);
+
+  auto to_vec = [](const auto& v) {
+    auto v_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),v);
+    return std::vector<typename decltype(v_h)::non_const_value_type>(v_h.data(),v_h.data()+v_h.size());
+  };
+  auto tgt_gids = [&](const CoarseningRemapperTester& r) {
+    return to_vec(r.get_coarse_grid()->get_dofs_gids().get_view<const gid_type*>());
+  };
+
+  // The first remapper reads the map file and writes the cache files,
+  // while remappers alive at the same time share the same data
+  auto r1 = std::make_shared<CoarseningRemapperTester>(src_grid,filename);
+  auto r2 = std::make_shared<CoarseningRemapperTester>(src_grid,filename);
+  REQUIRE (not r1->get_remap_data().loaded_from_cache);
+  REQUIRE (r1->get_row_offsets().data()==r2->get_row_offsets().data());
+
+  const auto row_offsets = to_vec(r1->get_row_offsets());
+  const auto col_lids    = to_vec(r1->get_col_lids());
+  const auto weights     = to_vec(r1->get_weights());
+  const auto gids        = tgt_gids(*r1);
+
+  // Once all customers are gone the data is released, and the next
+  // remapper loads it from the cache files
+  r1 = r2 = nullptr;
+  auto r3 = std::make_shared<CoarseningRemapperTester>(src_grid,filename);
+  REQUIRE (r3->get_remap_data().loaded_from_cache);
+  REQUIRE (to_vec(r3->get_row_offsets())==row_offsets);
+  REQUIRE (to_vec(r3->get_col_lids())==col_lids);
+  REQUIRE (to_vec(r3->get_weights())==weights);
+  REQUIRE (tgt_gids(*r3)==gids);
+
+  HorizRemapperData::set_cache_dir("");
+
+  // Clean up scorpio stuff
+  scorpio::finalize_subsystem();
+}
+
 } // namespace scream
@@ -7,6 +7,7 @@
 #include "share/field/field.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/field/field_batch_update.hpp"
 #include "share/util/eamxx_setup_random_test.hpp"
 
 #include "share/grid/point_grid.hpp"
@@ -972,6 +973,135 @@ TEST_CASE ("update") {
   }
 }
 
+TEST_CASE ("batch_update") {
+  using namespace scream;
+  using namespace ekat::units;
+  using namespace ShortFieldTagsNames;
+  using RPDF = std::uniform_real_distribution<Real>;
+
+  auto engine = setup_random_test ();
+  RPDF pdf(0,1);
+
+  const int ncol = 5;
+  const int nlev = 7;
+  const Real fill_val = constants::DefaultFillValue<float>().value;
+
+  // Fields of different sizes, to exercise the flattened indexing
+  std::vector<FieldLayout> layouts = {
+    FieldLayout({COL},{ncol}),
+    FieldLayout({COL,LEV},{ncol,nlev}),
+    FieldLayout({COL,CMP,LEV},{ncol,2,nlev})
+  };
+
+  std::vector<Field> x, y, y_ref;
+  for (size_t i=0; i<layouts.size(); ++i) {
+    FieldIdentifier fid ("x"+std::to_string(i),layouts[i],kg,"some_grid");
+    x.emplace_back(fid);
+    x.back().allocate_view();
+    randomize(x.back(),engine,pdf);
+    y.push_back(x.back().clone("y"+std::to_string(i)));
+    randomize(y.back(),engine,pdf);
+    y_ref.push_back(y.back().clone());
+  }
+
+  SECTION ("update") {
+    FieldBatchUpdate bu(CombineMode::Update);
+    for (size_t i=0; i<x.size(); ++i) {
+      REQUIRE (FieldBatchUpdate::supports(x[i],y[i]));
+      bu.add(x[i],y[i]);
+    }
+    REQUIRE_THROWS (bu.run());
+    bu.setup();
+    REQUIRE_THROWS (bu.add(x[0],y[0]));
+
+    bu.run(2,3);
+    for (size_t i=0; i<x.size(); ++i) {
+      y_ref[i].update(x[i],2,3);
+      REQUIRE (views_are_equal(y[i],y_ref[i]));
+    }
+  }
+
+  SECTION ("max-min") {
+    FieldBatchUpdate bu_max(CombineMode::Max);
+    FieldBatchUpdate bu_min(CombineMode::Min);
+    std::vector<Field> y_min;
+    for (size_t i=0; i<x.size(); ++i) {
+      y_min.push_back(y[i].clone());
+      bu_max.add(x[i],y[i]);
+      bu_min.add(x[i],y_min[i]);
+    }
+    bu_max.setup();
+    bu_min.setup();
+    bu_max.run();
+    bu_min.run();
+    for (size_t i=0; i<x.size(); ++i) {
+      auto y_ref_min = y_ref[i].clone();
+      y_ref[i].max(x[i]);
+      y_ref_min.min(x[i]);
+      REQUIRE (views_are_equal(y[i],y_ref[i]));
+      REQUIRE (views_are_equal(y_min[i],y_ref_min));
+    }
+  }
+
+  SECTION ("fill_and_count") {
+    FieldBatchUpdate bu(CombineMode::Update);
+    std::vector<Field> counts, counts_ref;
+    for (size_t i=0; i<x.size(); ++i) {
+      // Put fill values in half of the entries
+      auto xv = x[i].get_internal_view_data<Real,Host>();
+      const int n = layouts[i].size();
+      for (int k=0; k<n; k+=2) {
+        xv[k] = fill_val;
+      }
+      x[i].sync_to_dev();
+      y[i].get_header().set_extra_data("mask_value",fill_val);
+      y_ref[i].get_header().set_extra_data("mask_value",fill_val);
+
+      FieldIdentifier cid ("count"+std::to_string(i),layouts[i],Units::nondimensional(),"some_grid",DataType::IntType);
+      counts.emplace_back(cid);
+      counts.back().allocate_view();
+      counts.back().deep_copy(1);
+      counts_ref.push_back(counts.back().clone());
+
+      bu.add(x[i],y[i],counts[i]);
+    }
+    bu.setup();
+    bu.run();
+
+    for (size_t i=0; i<x.size(); ++i) {
+      y_ref[i].update(x[i],1,1);
+      REQUIRE (views_are_equal(y[i],y_ref[i]));
+
+      auto mask = counts_ref[i].clone();
+      compute_mask<Comparison::NE>(x[i],fill_val,mask);
+      counts_ref[i].update(mask,1,1);
+      REQUIRE (views_are_equal(counts[i],counts_ref[i]));
+    }
+  }
+
+  SECTION ("unsupported") {
+    // Subfields are not supported
+    FieldIdentifier fid ("v",layouts[2],kg,"some_grid");
+    Field v (fid);
+    v.allocate_view();
+    auto v0 = v.get_component(0);
+    auto v1 = v.get_component(1);
+    REQUIRE (not FieldBatchUpdate::supports(v0,v1));
+
+    FieldBatchUpdate bu(CombineMode::Update);
+    REQUIRE_THROWS (bu.add(v0,v1));
+
+    // Count requires a fill value
+    FieldIdentifier cid ("count",layouts[0],Units::nondimensional(),"some_grid",DataType::IntType);
+    Field count(cid);
+    count.allocate_view();
+    REQUIRE_THROWS (bu.add(x[0],y[0],count));
+
+    // Unsupported combine mode
+    REQUIRE_THROWS (FieldBatchUpdate(CombineMode::Replace));
+  }
+}
+
 TEST_CASE ("sync_subfields") {
   // This test is for previously incorrect behavior, where syncing a subfield
   // to host/device would deep copy the entire data view (including all entries of
@@ -7,6 +7,7 @@
 #include "share/field/field.hpp"
 #include "share/field/field_manager.hpp"
 #include "share/field/field_utils.hpp"
+#include "share/field/field_reduction_batch.hpp"
 #include "share/util/eamxx_setup_random_test.hpp"
 
 #include "share/grid/point_grid.hpp"
@@ -503,6 +504,70 @@ TEST_CASE("utils") {
     REQUIRE(field_min<Real>(f1,&comm)==gmin);
   }
 
+  SECTION ("reduction_batch") {
+    auto v1 = f1.get_strided_view<Real**>();
+    auto dim0 = fid.get_layout().dim(0);
+    auto dim1 = fid.get_layout().dim(1);
+    auto lsize = fid.get_layout().size();
+    auto offset = comm.rank()*lsize;
+    Kokkos::parallel_for(kt::RangePolicy(0,dim0*dim1),
+                         KOKKOS_LAMBDA(int idx) {
+      int i = idx / dim1;
+      int j = idx % dim1;
+      v1(i,j) = offset + idx+1;
+    });
+    Kokkos::fence();
+
+    // A subfield, to exercise the host fallback
+    auto f1_sub = f1.subfield(1,2);
+
+    // Weight and output for a horiz contraction
+    FieldIdentifier w_fid ("w", {{COL},{dim0}}, m/s, "some_grid");
+    FieldIdentifier c_fid ("c", {{LEV},{dim1}}, m/s, "some_grid");
+    Field w(w_fid), c(c_fid);
+    w.allocate_view();
+    c.get_header().get_alloc_properties().request_allocation(P8::n);
+    c.allocate_view();
+    w.deep_copy(1.0);
+    auto c_ref = c.clone();
+    auto c_loc = c.clone();
+    horiz_contraction<Real>(c_ref,f1,w,&comm);
+
+    auto tol = std::numeric_limits<Real>::epsilon() * 100;
+
+    FieldReductionBatch rb(comm);
+    auto h_sum  = rb.add_sum(f1);
+    auto h_norm = rb.add_frobenius_norm(f1);
+    auto h_max  = rb.add_max(f1);
+    auto h_min  = rb.add_min(f1);
+    auto h_sub  = rb.add_sum(f1_sub);
+    rb.add_horiz_contraction(c,f1,w);
+    rb.add_all_reduce(c_loc);
+
+    REQUIRE_THROWS (rb.finish()); // Not started yet
+    REQUIRE_THROWS (rb.get_value(h_sum)); // No results yet
+
+    // Run twice, to check that requests are persistent
+    for (int n=0; n<2; ++n) {
+      c.deep_copy(0);
+      horiz_contraction<Real>(c_loc,f1,w,nullptr);
+      rb.start();
+      REQUIRE (rb.in_progress());
+      REQUIRE_THROWS (rb.start()); // Already in progress
+      rb.finish();
+
+      // Device reductions may accumulate in a different order than the host ones
+      REQUIRE_THAT (rb.get_value(h_sum), Catch::Matchers::WithinRel(field_sum<Real>(f1,&comm),tol));
+      REQUIRE_THAT (rb.get_value(h_norm), Catch::Matchers::WithinRel(frobenius_norm<Real>(f1,&comm),tol));
+      REQUIRE (rb.get_value(h_max)==field_max<Real>(f1,&comm));
+      REQUIRE (rb.get_value(h_min)==field_min<Real>(f1,&comm));
+      REQUIRE (rb.get_value(h_sub)==field_sum<Real>(f1_sub,&comm));
+      REQUIRE (views_are_equal(c,c_ref));
+      REQUIRE (views_are_equal(c_loc,c_ref));
+    }
+    REQUIRE_THROWS (rb.add_sum(f1)); // Cannot add after start
+  }
+
   SECTION ("perturb") {
     using namespace ShortFieldTagsNames;
     using RPDF = std::uniform_real_distribution<Real>;
@@ -218,6 +218,82 @@ TEST_CASE ("grid_import_export") {
   if (comm.am_i_root()) {
     printf(" -> Testing scatter routine ... %s\n",ok ? "PASS" : "FAIL");
   }
+
+  // Test fields transfer
+  if (comm.am_i_root()) {
+    printf(" -> Testing fields transfer ...\n");
+  }
+  ok = true;
+  const int ncmp = 3;
+  const auto nondim = ekat::units::Units::nondimensional();
+  auto create_fields = [&](const std::shared_ptr<const AbstractGrid>& g) {
+    const int ncols = g->get_num_local_dofs();
+    std::vector<Field> fields;
+    fields.emplace_back(FieldIdentifier("f1",FieldLayout({COL},{ncols}),nondim,g->name()));
+    fields.emplace_back(FieldIdentifier("f2",FieldLayout({COL,CMP},{ncols,ncmp}),nondim,g->name()));
+    for (auto& f : fields) {
+      f.allocate_view();
+    }
+    return fields;
+  };
+  auto fields    = create_fields(grid);
+  auto ov_fields = create_fields(ov_grid);
+  imp_exp.setup_fields_transfer(fields,ov_fields);
+
+  // Scatter: the ov fields must get the value of the unique field at the same gid
+  auto f1_h = fields[0].get_view<Real*,Host>();
+  auto f2_h = fields[1].get_view<Real**,Host>();
+  for (int i=0; i<grid->get_num_local_dofs(); ++i) {
+    f1_h(i) = gids[i];
+    for (int k=0; k<ncmp; ++k) {
+      f2_h(i,k) = gids[i]*ncmp + k;
+    }
+  }
+  for (auto& f : fields) {
+    f.sync_to_dev();
+  }
+  imp_exp.scatter_fields();
+
+  auto ov_f1_h = ov_fields[0].get_view<Real*,Host>();
+  auto ov_f2_h = ov_fields[1].get_view<Real**,Host>();
+  for (auto& f : ov_fields) {
+    f.sync_to_host();
+  }
+  for (int i=0; i<ov_grid->get_num_local_dofs(); ++i) {
+    CHECK (ov_f1_h(i)==ov_gids[i]);
+    ok &= catch_capture.lastAssertionPassed();
+    for (int k=0; k<ncmp; ++k) {
+      CHECK (ov_f2_h(i,k)==ov_gids[i]*ncmp+k);
+      ok &= catch_capture.lastAssertionPassed();
+    }
+  }
+
+  // Gather: the unique fields get the sum over all ranks having the gid in the ov grid
+  for (int i=0; i<ov_grid->get_num_local_dofs(); ++i) {
+    ov_f1_h(i) = 1;
+    for (int k=0; k<ncmp; ++k) {
+      ov_f2_h(i,k) = k;
+    }
+  }
+  for (auto& f : ov_fields) {
+    f.sync_to_dev();
+  }
+  imp_exp.gather_fields();
+  for (auto& f : fields) {
+    f.sync_to_host();
+  }
+  for (int i=0; i<grid->get_num_local_dofs(); ++i) {
+    const int ncopies = gid2pids[gids[i]].size();
+    CHECK (f1_h(i)==ncopies);
+    ok &= catch_capture.lastAssertionPassed();
+    for (int k=0; k<ncmp; ++k) {
+      CHECK (f2_h(i,k)==ncopies*k);
+      ok &= catch_capture.lastAssertionPassed();
+    }
+  }
+  if (comm.am_i_root()) {
+    printf(" -> Testing fields transfer ... %s\n",ok ? "PASS" : "FAIL");
+  }
 }
 
 } // anonymous namespace
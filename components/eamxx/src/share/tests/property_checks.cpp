@@ -1,10 +1,12 @@
 #include <catch2/catch.hpp>
 #include <numeric>
+#include <algorithm>
 
 #include "share/property_checks/field_within_interval_check.hpp"
 #include "share/property_checks/field_lower_bound_check.hpp"
 #include "share/property_checks/field_upper_bound_check.hpp"
 #include "share/property_checks/field_nan_check.hpp"
+#include "share/property_checks/fused_property_checks.hpp"
 #include "share/util/eamxx_setup_random_test.hpp"
 #include "share/grid/point_grid.hpp"
 #include "share/field/field_utils.hpp"
@@ -311,6 +313,70 @@ TEST_CASE("property_checks", "") {
       REQUIRE(f_data[i] == 1.0);
     }
   }
+
+  // Check that screening several checks at once flags the right checks
+  SECTION ("fused_property_checks") {
+    auto f_cmp1 = f.subfield(CMP,1);  // Slice along the second to last dim
+    auto f_col1 = f.subfield(COL,1);  // Slice along the first dim
+    auto f_lev3 = f.subfield(LEV,3);  // Slice along the last dim
+
+    std::vector<std::shared_ptr<PropertyCheck>> checks = {
+      std::make_shared<FieldNaNCheck>(f,grid),
+      std::make_shared<FieldWithinIntervalCheck>(f_cmp1,grid,0,1),
+      std::make_shared<FieldLowerBoundCheck>(f_col1,grid,0),
+      std::make_shared<FieldUpperBoundCheck>(f_lev3,grid,1)
+    };
+
+    FusedPropertyChecks fpc;
+    for (const auto& pc : checks) {
+      REQUIRE (fpc.add(pc));
+    }
+
+    // Dynamic subfields and non-Real fields cannot be screened
+    FieldIdentifier fid_int ("field_int", {tags,dims}, m/s,"some_grid", DataType::IntType);
+    Field f_int(fid_int);
+    f_int.allocate_view();
+    REQUIRE (not fpc.add(std::make_shared<FieldNaNCheck>(f.subfield(CMP,0,true),grid)));
+    REQUIRE (not fpc.add(std::make_shared<FieldNaNCheck>(f_int,grid)));
+    REQUIRE (fpc.num_checks()==4);
+
+    // Screen, and verify that the flagged checks are exactly those that do not pass
+    auto screen_and_verify = [&](const std::vector<int>& expected) {
+      fpc.screen();
+      auto flagged = fpc.get_flagged();
+      REQUIRE (flagged==expected);
+      for (int i=0; i<fpc.num_checks(); ++i) {
+        const bool pass = fpc.get_check(i)->check().result==CheckResult::Pass;
+        REQUIRE (pass==(std::find(flagged.begin(),flagged.end(),i)==flagged.end()));
+      }
+      fpc.reset_flags();
+    };
+
+    auto f_view = f.get_view<Real***,Host>();
+    f.deep_copy(0.5);
+    f.sync_to_host();
+    screen_and_verify({});
+
+    // Out of [0,1] in cmp 1 of col 1, but not in lev 3
+    f_view(1,1,5) = -1;
+    f.sync_to_dev();
+    screen_and_verify({1,2});
+
+    // A NaN in col 0 and lev 3 (but not in cmp 1)
+    f.deep_copy(0.5);
+    f.sync_to_host();
+    f_view(0,2,3) = std::numeric_limits<Real>::quiet_NaN();
+    f.sync_to_dev();
+    screen_and_verify({0,3});
+
+    // The flags are sticky until reset
+    fpc.screen();
+    f.deep_copy(0.5);
+    fpc.screen();
+    REQUIRE (fpc.get_flagged()==std::vector<int>{0,3});
+    fpc.reset_flags();
+    REQUIRE (fpc.get_flagged().empty());
+  }
 }
 
 } // anonymous namespace
@@ -1,6 +1,7 @@
 #include <catch2/catch.hpp>
 
 #include "share/util/eamxx_array_utils.hpp"
+#include "share/util/eamxx_column_compaction.hpp"
 #include "share/util/eamxx_universal_constants.hpp"
 #include "share/util/eamxx_utils.hpp"
 #include "share/util/eamxx_time_stamp.hpp"
@@ -256,3 +257,83 @@ TEST_CASE ("array_utils") {
     }
   }
 }
+
+TEST_CASE ("column_compaction") {
+  using namespace scream;
+  using kt = KokkosTypes<DefaultDevice>;
+
+  const int ncol = 38;
+  const int nlev = 5;
+  const int nbnd = 3;
+
+  // Select every third column, plus the last one
+  kt::view_1d<int> idx("idx",ncol);
+  auto pred = KOKKOS_LAMBDA(const int i) { return i%3==0 or i==ncol-1; };
+  const int nsel = compact_indices(ncol,pred,idx);
+  REQUIRE (nsel==(ncol-1)/3+2);
+
+  auto idx_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),idx);
+  for (int i=0; i<nsel-1; ++i) {
+    REQUIRE (idx_h(i)==3*i);
+  }
+  REQUIRE (idx_h(nsel-1)==ncol-1);
+
+  // Too small indices view
+  REQUIRE_THROWS (compact_indices(ncol,pred,kt::view_1d<int>("",ncol-1)));
+
+  // Gather two rank-2 and one rank-3 views, then scatter them back to zeroed views
+  kt::view_2d<Real> a("a",ncol,nlev), b("b",ncol,nlev);
+  kt::view_3d<Real> c("c",ncol,nlev,nbnd);
+  Kokkos::parallel_for(kt::RangePolicy(0,ncol*nlev*nbnd),KOKKOS_LAMBDA(const int k) {
+    const int i = k / (nlev*nbnd);
+    const int j = (k / nbnd) % nlev;
+    const int l = k % nbnd;
+    a(i,j) = i*nlev + j;
+    b(i,j) = -(i*nlev + j);
+    c(i,j,l) = k;
+  });
+
+  kt::view_2d<Real> a_sel("a_sel",nsel,nlev), b_sel("b_sel",nsel,nlev);
+  kt::view_3d<Real> c_sel("c_sel",nsel,nlev,nbnd);
+  gather_selected(idx,nsel,std::array{a,b},std::array{a_sel,b_sel});
+  gather_selected(idx,nsel,std::array{c},std::array{c_sel});
+
+  // Incompatible extents
+  REQUIRE_THROWS (gather_selected(idx,nsel,std::array{a},std::array{kt::view_2d<Real>("",nsel,nlev+1)}));
+  REQUIRE_THROWS (gather_selected(idx,nsel,std::array{a},std::array{kt::view_2d<Real>("",nsel-1,nlev)}));
+
+  auto a_sel_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),a_sel);
+  auto b_sel_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),b_sel);
+  auto c_sel_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),c_sel);
+  for (int i=0; i<nsel; ++i) {
+    const int icol = idx_h(i);
+    for (int j=0; j<nlev; ++j) {
+      REQUIRE (a_sel_h(i,j)==icol*nlev+j);
+      REQUIRE (b_sel_h(i,j)==-(icol*nlev+j));
+      for (int l=0; l<nbnd; ++l) {
+        REQUIRE (c_sel_h(i,j,l)==(icol*nlev+j)*nbnd+l);
+      }
+    }
+  }
+
+  kt::view_2d<Real> a_full("a_full",ncol,nlev), b_full("b_full",ncol,nlev);
+  kt::view_3d<Real> c_full("c_full",ncol,nlev,nbnd);
+  scatter_selected(idx,nsel,std::array{a_sel,b_sel},std::array{a_full,b_full});
+  scatter_selected(idx,nsel,std::array{c_sel},std::array{c_full});
+
+  auto a_h      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),a);
+  auto c_h      = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),c);
+  auto a_full_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),a_full);
+  auto b_full_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),b_full);
+  auto c_full_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),c_full);
+  for (int i=0; i<ncol; ++i) {
+    const bool sel = i%3==0 or i==ncol-1;
+    for (int j=0; j<nlev; ++j) {
+      REQUIRE (a_full_h(i,j)==(sel ? a_h(i,j) : 0));
+      REQUIRE (b_full_h(i,j)==(sel ? -a_h(i,j) : 0));
+      for (int l=0; l<nbnd; ++l) {
+        REQUIRE (c_full_h(i,j,l)==(sel ? c_h(i,j,l) : 0));
+      }
+    }
+  }
+}
@@ -0,0 +1,160 @@
+#ifndef SCREAM_COLUMN_COMPACTION_HPP
+#define SCREAM_COLUMN_COMPACTION_HPP
+
+#include "share/eamxx_types.hpp"
+
+#include <ekat/ekat_assert.hpp>
+
+#include <array>
+#include <string>
+
+namespace scream {
+
+/*
+ * Utilities to work on a subset of columns (e.g., daytime columns in radiation)
+ *
+ *  - compact_indices: store in idx the indices i in [0,n) for which pred(i) is true,
+ *    in increasing order, and return how many there are. Uses a parallel prefix sum,
+ *    so there is no serial loop over the columns.
+ *  - gather_selected: dst[v](i,...) = src[v](idx(i),...), for i in [0,nsel)
+ *  - scatter_selected: dst[v](idx(i),...) = src[v](i,...), for i in [0,nsel)
+ *
+ * The gather/scatter utilities process N views in a single kernel. All views must
+ * have the same rank (up to 3), and the same extents, except for the first one
+ * (which is nsel for the compact views, and >=max(idx)+1 for the full views).
+ * The views are passed as std::array, so one can write
+ *   gather_selected(idx,nsel,std::array{p_lay,t_lay},std::array{p_lay_day,t_lay_day});
+ */
+
+template<typename Pred, typename IdxView>
+int compact_indices (const int n, const Pred& pred, const IdxView& idx)
+{
+  using exe_space = typename IdxView::execution_space;
+
+  EKAT_REQUIRE_MSG (static_cast<int>(idx.extent(0))>=n,
+      "Error! Indices view is too small for compaction.\n"
+      " - idx extent: " + std::to_string(idx.extent(0)) + "\n"
+      " - n         : " + std::to_string(n) + "\n");
+
+  int nsel = 0;
+  Kokkos::parallel_scan("compact_indices",Kokkos::RangePolicy<exe_space>(0,n),
+                        KOKKOS_LAMBDA(const int i, int& update, const bool final) {
+    if (pred(i)) {
+      if (final) {
+        idx(update) = i;
+      }
+      ++update;
+    }
+  },nsel);
+  return nsel;
+}
+
+namespace impl {
+
+template<typename SrcView, typename DstView, std::size_t N>
+void check_selected_views (const std::array<SrcView,N>& src,
+                           const std::array<DstView,N>& dst,
+                           const int ncompact, const bool gather)
+{
+  static_assert (static_cast<int>(SrcView::rank)==static_cast<int>(DstView::rank),
+      "Error! Source and target views must have the same rank.\n");
+  static_assert (SrcView::rank>=1 and SrcView::rank<=3,
+      "Error! Only views of rank 1, 2, or 3 are supported.\n");
+
+  for (std::size_t v=0; v<N; ++v) {
+    for (int r=1; r<static_cast<int>(SrcView::rank); ++r) {
+      EKAT_REQUIRE_MSG (src[v].extent(r)==dst[0].extent(r) and dst[v].extent(r)==dst[0].extent(r),
+          "Error! Views passed to gather/scatter_selected have incompatible extents.\n"
+          " - view index: " + std::to_string(v) + "\n"
+          " - dimension : " + std::to_string(r) + "\n");
+    }
+    const auto compact = gather ? dst[v].extent(0) : src[v].extent(0);
+    EKAT_REQUIRE_MSG (static_cast<int>(compact)>=ncompact,
+        "Error! Compact view passed to gather/scatter_selected is too small.\n"
+        " - view index: " + std::to_string(v) + "\n"
+        " - extent    : " + std::to_string(compact) + "\n"
+        " - nsel      : " + std::to_string(ncompact) + "\n");
+  }
+}
+
+} // namespace impl
+
+template<typename IdxView, typename SrcView, typename DstView, std::size_t N>
+void gather_selected (const IdxView& idx, const int nsel,
+                      const std::array<SrcView,N>& src,
+                      const std::array<DstView,N>& dst)
+{
+  using exe_space = typename DstView::execution_space;
+  constexpr int rank = DstView::rank;
+
+  impl::check_selected_views(src,dst,nsel,true);
+
+  // Copy views in a Kokkos::Array, so they can be captured in the device lambda
+  Kokkos::Array<SrcView,N> s;
+  Kokkos::Array<DstView,N> d;
+  for (std::size_t v=0; v<N; ++v) {
+    s[v] = src[v];
+    d[v] = dst[v];
+  }
+
+  const int n1 = rank>1 ? dst[0].extent(1) : 1;
+  const int n2 = rank>2 ? dst[0].extent(2) : 1;
+  Kokkos::parallel_for("gather_selected",Kokkos::RangePolicy<exe_space>(0,nsel*n1*n2),
+                       KOKKOS_LAMBDA(const int k) {
+    const int i = k / (n1*n2);
+    const int j = (k / n2) % n1;
+    const int l = k % n2;
+    const int icol = idx(i);
+    for (std::size_t v=0; v<N; ++v) {
+      if constexpr (rank==1) {
+        d[v](i) = s[v](icol);
+      } else if constexpr (rank==2) {
+        d[v](i,j) = s[v](icol,j);
+      } else {
+        d[v](i,j,l) = s[v](icol,j,l);
+      }
+    }
+  });
+}
+
+template<typename IdxView, typename SrcView, typename DstView, std::size_t N>
+void scatter_selected (const IdxView& idx, const int nsel,
+                       const std::array<SrcView,N>& src,
+                       const std::array<DstView,N>& dst)
+{
+  using exe_space = typename DstView::execution_space;
+  constexpr int rank = DstView::rank;
+
+  impl::check_selected_views(src,dst,nsel,false);
+
+  // Copy views in a Kokkos::Array, so they can be captured in the device lambda
+  Kokkos::Array<SrcView,N> s;
+  Kokkos::Array<DstView,N> d;
+  for (std::size_t v=0; v<N; ++v) {
+    s[v] = src[v];
+    d[v] = dst[v];
+  }
+
+  const int n1 = rank>1 ? dst[0].extent(1) : 1;
+  const int n2 = rank>2 ? dst[0].extent(2) : 1;
+  Kokkos::parallel_for("scatter_selected",Kokkos::RangePolicy<exe_space>(0,nsel*n1*n2),
+                       KOKKOS_LAMBDA(const int k) {
+    const int i = k / (n1*n2);
+    const int j = (k / n2) % n1;
+    const int l = k % n2;
+    const int icol = idx(i);
+    for (std::size_t v=0; v<N; ++v) {
+      if constexpr (rank==1) {
+        d[v](icol) = s[v](i);
+      } else if constexpr (rank==2) {
+        d[v](icol,j) = s[v](i,j);
+      } else {
+        d[v](icol,j,l) = s[v](i,j,l);
+      }
+    }
+  });
+}
+
+} // namespace scream
+
+#endif // SCREAM_COLUMN_COMPACTION_HPP
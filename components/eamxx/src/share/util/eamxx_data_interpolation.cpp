@@ -46,6 +46,9 @@ void DataInterpolation::run (const util::TimeStamp& ts)
     shift_data_interval ();
   }
 
+  // Advance the loading of the next slice (if any)
+  prefetch_step ();
+
   // Perform the time interpolation: f_out = f_beg*alpha + f_end*(1-alpha),
   // where alpha = (ts-t_beg) / (t_end-t_beg).
   // NOTE: pay attention to time strategy, since for YearlyPeriodic you may
@@ -128,34 +131,96 @@ void DataInterpolation::shift_data_interval ()
   m_curr_interval_idx.second = m_time_database.get_next_idx(m_curr_interval_idx.first);
 
   m_data_interval.advance(m_time_database.slices[m_curr_interval_idx.second].time);
-  std::swap (m_horiz_remapper_beg,m_horiz_remapper_end);
-  update_end_fields ();
+  if (m_prefetch.slice_idx==m_curr_interval_idx.second) {
+    // The new end slice is (at least partially) in the prefetch fields. Finish
+    // loading it (if needed), and rotate: the old beg fields become the next prefetch buffer
+    complete_prefetch ();
+    auto old_beg = m_horiz_remapper_beg;
+    m_horiz_remapper_beg  = m_horiz_remapper_end;
+    m_horiz_remapper_end  = m_horiz_remapper_next;
+    m_horiz_remapper_next = old_beg;
+  } else {
+    std::swap (m_horiz_remapper_beg,m_horiz_remapper_end);
+    update_end_fields ();
+  }
+  start_prefetch ();
 }
 
 void DataInterpolation::
 update_end_fields ()
 {
-  // First, set the correct fields in the reader
-  std::vector<Field> fields;
-  for (int i=0; i<m_nfields; ++i) {
-    fields.push_back(m_horiz_remapper_end->get_src_field(i));
-  }
+  const auto& slice = m_time_database.slices[m_curr_interval_idx.second];
+  setup_reader (m_horiz_remapper_end,slice);
 
-  if (m_vr_type==Dynamic3D or m_vr_type==Dynamic3DRef) {
-    // We also need to read the src pressure profile
-    fields.push_back(m_horiz_remapper_end->get_src_field(m_nfields));
+  // Read and interpolate fields
+  m_reader->read_variables(slice.time_idx);
+  m_horiz_remapper_end->remap_fwd();
+}
+
+void DataInterpolation::
+setup_reader (const std::shared_ptr<AbstractRemapper>& hremap, const DataSlice& slice)
+{
+  // Resetting fields in the reader may allocate temporaries, so only do it if needed
+  if (m_reader_hremap!=hremap) {
+    std::vector<Field> fields;
+    for (int i=0; i<num_vars_to_read(); ++i) {
+      // NOTE: for Dynamic3D/Dynamic3DRef, the src pressure profile is THE LAST registered field
+      fields.push_back(hremap->get_src_field(i));
+    }
+    m_reader->set_fields(fields);
+    m_reader_hremap = hremap;
   }
-  m_reader->set_fields(fields);
 
   // If we're also changing the file, must (re)init the scorpio structures
-  const auto& slice = m_time_database.slices[m_curr_interval_idx.second];
   if (m_reader->get_filename()!=slice.filename) {
     m_reader->reset_filename(slice.filename);
   }
+}
 
-  // Read and interpolate fields
-  m_reader->read_variables(slice.time_idx);
-  m_horiz_remapper_end->remap_fwd();
+int DataInterpolation::
+num_vars_to_read () const
+{
+  // For Dynamic3D/Dynamic3DRef we also need to read the src pressure profile
+  return m_vr_type==Dynamic3D or m_vr_type==Dynamic3DRef ? m_nfields+1 : m_nfields;
+}
+
+void DataInterpolation::
+start_prefetch ()
+{
+  // With a linear timeline, there may be no slice after the current interval end
+  const int end = m_curr_interval_idx.second;
+  m_prefetch.slice_idx = m_time_database.has_next(end) ? m_time_database.get_next_idx(end) : -1;
+  m_prefetch.step = 0;
+}
+
+void DataInterpolation::
+prefetch_step ()
+{
+  // Steps [0,nvars) read one variable each, step nvars does the horiz remap
+  const int nvars = num_vars_to_read();
+  if (m_prefetch.slice_idx<0 or m_prefetch.step>nvars) {
+    return;
+  }
+
+  if (m_prefetch.step<nvars) {
+    const auto& slice = m_time_database.slices[m_prefetch.slice_idx];
+    setup_reader (m_horiz_remapper_next,slice);
+
+    const auto& name = m_horiz_remapper_next->get_src_field(m_prefetch.step).name();
+    m_reader->read_variable(name,slice.time_idx);
+  } else {
+    m_horiz_remapper_next->remap_fwd();
+  }
+  ++m_prefetch.step;
+}
+
+void DataInterpolation::
+complete_prefetch ()
+{
+  const int nvars = num_vars_to_read();
+  while (m_prefetch.step<=nvars) {
+    prefetch_step ();
+  }
 }
 
 void DataInterpolation::
@@ -180,7 +245,8 @@ init_data_interval (const util::TimeStamp& t0)
 
   // We need to read in the beg/end fields for the initial interval. However, our generic
   // framework can only load the end slice (since that's what we need at runtime).
-  // So, load end state for t=t_beg, then call shift_data_interval
+  // So, load end state for t=t_beg, then call shift_data_interval (which also starts
+  // prefetching the slice after the interval end)
   // NOTE: don't compute length now, since beg time point is invalid (we don't need length yet).
   m_data_interval = util::TimeInterval (util::TimeStamp(),t_beg,m_time_database.timeline,false);
   m_curr_interval_idx.second = t0_interval;
@@ -309,6 +375,12 @@ get_next_idx (int prev) const
   return next;
 }
 
+bool DataInterpolation::TimeDatabase::
+has_next (int prev) const
+{
+  return timeline==util::TimeLine::YearlyPeriodic or prev+1<size();
+}
+
 int DataInterpolation::TimeDatabase::
 find_interval (const util::TimeStamp& t) const
 {
@@ -392,6 +464,7 @@ create_horiz_remappers (const std::string& map_file)
   if (map_file!="") {
     m_horiz_remapper_beg = std::make_shared<RefiningRemapperP2P>(m_grid_after_hremap,map_file);
     m_horiz_remapper_end = std::make_shared<RefiningRemapperP2P>(m_grid_after_hremap,map_file);
+    m_horiz_remapper_next = std::make_shared<RefiningRemapperP2P>(m_grid_after_hremap,map_file);
 
     int map_ncols_src = m_horiz_remapper_beg->get_src_grid()->get_num_global_dofs();
     int map_ncols_tgt = m_horiz_remapper_beg->get_tgt_grid()->get_num_global_dofs();
@@ -417,6 +490,7 @@ create_horiz_remappers (const std::string& map_file)
 
     m_horiz_remapper_beg = std::make_shared<IDR>(m_grid_after_hremap,SAT);
     m_horiz_remapper_end = std::make_shared<IDR>(m_grid_after_hremap,SAT);
+    m_horiz_remapper_next = std::make_shared<IDR>(m_grid_after_hremap,SAT);
   }
 }
 
@@ -452,6 +526,7 @@ create_horiz_remappers (const Real iop_lat, const Real iop_lon)
   // Create IOP remappers
   m_horiz_remapper_beg = std::make_shared<IOPRemapper>(data_grid,m_grid_after_hremap,iop_lat,iop_lon);
   m_horiz_remapper_end = std::make_shared<IOPRemapper>(data_grid,m_grid_after_hremap,iop_lat,iop_lon);
+  m_horiz_remapper_next = std::make_shared<IOPRemapper>(data_grid,m_grid_after_hremap,iop_lat,iop_lon);
 }
 
 void DataInterpolation::
@@ -610,14 +685,17 @@ void DataInterpolation::register_fields_in_remappers ()
     const auto& f = m_vert_remapper->get_src_field(i);
     m_horiz_remapper_beg->register_field_from_tgt(f.clone(f.name(), m_horiz_remapper_beg->get_src_grid()->name()));
     m_horiz_remapper_end->register_field_from_tgt(f.clone(f.name(), m_horiz_remapper_end->get_src_grid()->name()));
+    m_horiz_remapper_next->register_field_from_tgt(f.clone(f.name(), m_horiz_remapper_next->get_src_grid()->name()));
   }
   if (m_vr_type==Dynamic3D or m_vr_type==Dynamic3DRef) {
     const auto& data_p = m_helper_pressure_fields["p_file"];
     m_horiz_remapper_beg->register_field_from_tgt(data_p.clone(data_p.name(), m_horiz_remapper_beg->get_src_grid()->name()));
     m_horiz_remapper_end->register_field_from_tgt(data_p.clone(data_p.name(), m_horiz_remapper_end->get_src_grid()->name()));
+    m_horiz_remapper_next->register_field_from_tgt(data_p.clone(data_p.name(), m_horiz_remapper_next->get_src_grid()->name()));
   }
   m_horiz_remapper_beg->registration_ends();
   m_horiz_remapper_end->registration_ends();
+  m_horiz_remapper_next->registration_ends();
 }
 
 } // namespace scream
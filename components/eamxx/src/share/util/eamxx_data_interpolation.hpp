@@ -70,11 +70,6 @@ public:
 
 protected:
 
-  void shift_data_interval ();
-  void update_end_fields ();
-
-  int get_input_files_dimlen (const std::string& dimname) const;
-
   // ----------- Internal data types ---------- //
 
   struct DataSlice {
@@ -90,23 +85,52 @@ protected:
 
     int size () const { return slices.size(); }
     int get_next_idx (int prev_idx) const;
+    bool has_next (int prev_idx) const;
 
     // Find interval containing t
     int find_interval (const util::TimeStamp& t) const;
   };
 
+  struct Prefetch {
+    int slice_idx = -1; // Slice being prefetched (-1 means none)
+    int step      = 0;  // Number of prefetch steps already performed
+  };
+
+  // ------------- Internal methods ------------ //
+
+  void shift_data_interval ();
+  void update_end_fields ();
+
+  // Set fields and file in the reader, so that it loads the given slice
+  // into the src fields of the given horiz remapper
+  void setup_reader (const std::shared_ptr<AbstractRemapper>& hremap, const DataSlice& slice);
+
+  // The slice after the current interval end is loaded into a third set of fields
+  // while the current interval is in use, one variable per run call (plus one call
+  // for the horiz remap). This way, crossing into the next interval does not
+  // require to read and remap all the fields during a single time step.
+  void start_prefetch ();
+  void prefetch_step ();
+  void complete_prefetch ();
+  int num_vars_to_read () const;
+
+  int get_input_files_dimlen (const std::string& dimname) const;
+
   // --------------- Internal data ------------- //
 
   std::shared_ptr<AtmosphereInput> m_reader;
+  std::shared_ptr<AbstractRemapper> m_reader_hremap; // The hremap whose src fields are set in the reader
 
   std::shared_ptr<const AbstractGrid> m_model_grid;
   std::shared_ptr<AbstractGrid>       m_grid_after_hremap; // nonconst b/c we may need to set some geo data
 
   std::vector<Field>                  m_fields;
 
-  // Use two horiz remappers, so we only set them up once (it may be costly)
+  // Use three horiz remappers (beg/end of current interval, plus the prefetched slice),
+  // so we only set them up once (it may be costly)
   std::shared_ptr<AbstractRemapper> m_horiz_remapper_beg;
   std::shared_ptr<AbstractRemapper> m_horiz_remapper_end;
+  std::shared_ptr<AbstractRemapper> m_horiz_remapper_next;
   std::shared_ptr<AbstractRemapper> m_vert_remapper;
 
   // These are inited as the usual "ncol" and "lev" at construction, but the user
@@ -124,6 +148,7 @@ protected:
   std::pair<int,int>    m_curr_interval_idx;
 
   TimeDatabase          m_time_database;
+  Prefetch              m_prefetch;
 
   ekat::Comm            m_comm;
   ekat::ParameterList   m_params;
@@ -21,6 +21,7 @@ TimeInterpolation::TimeInterpolation(
   const vos_type& list_of_files
 ) : TimeInterpolation(grid)
 {
+  m_fm_next = std::make_shared<FieldManager>(grid,RepoState::Closed);
   set_file_data_triplets(list_of_files);
   m_is_data_from_file = true;
 }
@@ -29,6 +30,7 @@ void TimeInterpolation::finalize()
 {
   if (m_is_data_from_file) {
     m_file_data_atm_input = nullptr;
+    m_file_data_input_fm = nullptr;
     m_is_data_from_file = false;
   }
 }
@@ -52,6 +54,9 @@ void TimeInterpolation::perform_time_interpolation(const TimeStamp& time_in)
   // If data is handled by files we need to check that the timestamps are still relevant
   if (m_file_data_triplets.size()>0) {
     check_and_update_data(time_in);
+
+    // Advance the loading of the next triplet (if any)
+    prefetch_step();
   }
 
   // Gather weights for interpolation.  Note, timestamp differences are integers and we need a
@@ -94,6 +99,9 @@ void TimeInterpolation::add_field(const Field& field_in, const bool store_shallo
   auto field1 = field_in.clone();
   m_fm_time0->add_field(field0);
   m_fm_time1->add_field(field1);
+  if (m_fm_next) {
+    m_fm_next->add_field(field_in.clone());
+  }
   if (store_shallow_copy) {
     // Then we want to store the actual field_in and override it when interpolating
     m_interp_fields.emplace(name,field_in);
@@ -105,6 +113,43 @@ void TimeInterpolation::add_field(const Field& field_in, const bool store_shallo
   m_field_names.push_back(name);
 }
 /*-----------------------------------------------------------------------------------------------*/
+/* Function which sets up the remap of data from file, done once per time snap.
+ * Input:
+ *   remapper - A remapper whose src fields live on the grid of the data files, and whose tgt
+ *              fields live on the interpolator grid. For each interpolator field, the remapper
+ *              must have src/tgt fields with the same name.
+ *   fixer    - An optional function, called on each src field after it is read.
+ */
+void TimeInterpolation::set_file_data_remapper(const std::shared_ptr<AbstractRemapper>& remapper,
+                                               const std::function<void(const Field&)>& fixer)
+{
+  EKAT_REQUIRE_MSG(m_is_data_from_file,
+      "Error! TimeInterpolation::set_file_data_remapper - a remapper can only be used with data from files.\n");
+  EKAT_REQUIRE_MSG(remapper!=nullptr,
+      "Error! TimeInterpolation::set_file_data_remapper - invalid remapper pointer.\n");
+
+  m_fm_file_data = std::make_shared<FieldManager>(remapper->get_src_grid(),RepoState::Closed);
+  for (auto name : m_field_names) {
+    bool found = false;
+    for (int i=0; i<remapper->get_num_fields(); ++i) {
+      if (remapper->get_src_field(i).name()==name) {
+        EKAT_REQUIRE_MSG(remapper->get_tgt_field(i).name()==name,
+            "Error! TimeInterpolation::set_file_data_remapper - remapper src/tgt fields names do not match.\n"
+            " - src field name: " + name + "\n"
+            " - tgt field name: " + remapper->get_tgt_field(i).name() + "\n");
+        m_fm_file_data->add_field(remapper->get_src_field(i));
+        found = true;
+        break;
+      }
+    }
+    EKAT_REQUIRE_MSG(found,
+        "Error! TimeInterpolation::set_file_data_remapper - interpolator field not found in the remapper.\n"
+        " - field name: " + name + "\n");
+  }
+  m_file_data_remapper = remapper;
+  m_file_data_fixer = fixer;
+}
+/*-----------------------------------------------------------------------------------------------*/
 /* Function to shift all data from time1 to time0, update timestamp for time0
  */
 void TimeInterpolation::shift_data()
@@ -115,7 +160,24 @@ void TimeInterpolation::shift_data()
     auto& field1 = m_fm_time1->get_field(name);
     std::swap(field0,field1);
   }
-  m_file_data_atm_input->set_field_manager(m_fm_time1);
+  // The input stream still points to the old fields, so it must be reset before the next read
+  m_file_data_input_fm = nullptr;
+}
+/*-----------------------------------------------------------------------------------------------*/
+/* Function to rotate data when the prefetched triplet is the new time1:
+ *   time0 <- time1, time1 <- next, next <- time0
+ */
+void TimeInterpolation::rotate_data()
+{
+  for (auto name : m_field_names)
+  {
+    auto& field0 = m_fm_time0->get_field(name);
+    auto& field1 = m_fm_time1->get_field(name);
+    auto& field_next = m_fm_next->get_field(name);
+    std::swap(field0,field1);
+    std::swap(field1,field_next);
+  }
+  m_file_data_input_fm = nullptr;
 }
 /*-----------------------------------------------------------------------------------------------*/
 /* Function which will initialize the TimeStamps.
@@ -159,16 +221,13 @@ void TimeInterpolation::initialize_data_from_files()
 {
   auto triplet_curr = m_file_data_triplets[m_triplet_idx];
   // Initialize the AtmosphereInput object that will be used to gather data
-  ekat::ParameterList input_params;
-  input_params.set("field_names",m_field_names);
-  input_params.set("filename",triplet_curr.filename);
-  m_file_data_atm_input = std::make_shared<AtmosphereInput>(input_params,m_fm_time1);
-  m_file_data_atm_input->set_logger(m_logger);
+  setup_file_data_input(triplet_curr,m_file_data_remapper ? m_fm_file_data : m_fm_time1);
   // Assign the mask value gathered from the FillValue found in the source file.
   // TODO: Should we make it possible to check if FillValue is in the metadata and only assign mask_value if it is?
   for (auto& name : m_field_names) {
     auto& field0 = m_fm_time0->get_field(name);
     auto& field1 = m_fm_time1->get_field(name);
+    auto& field_next = m_fm_next->get_field(name);
     auto& field_out = m_interp_fields.at(name);
 
     auto set_fill_value = [&](const auto var_fill_value) {
@@ -176,10 +235,12 @@ void TimeInterpolation::initialize_data_from_files()
       if (dt==DataType::FloatType) {
         field0.get_header().set_extra_data("mask_value",static_cast<float>(var_fill_value));
         field1.get_header().set_extra_data("mask_value",static_cast<float>(var_fill_value));
+        field_next.get_header().set_extra_data("mask_value",static_cast<float>(var_fill_value));
         field_out.get_header().set_extra_data("mask_value",static_cast<float>(var_fill_value));
       } else if (dt==DataType::DoubleType) {
         field0.get_header().set_extra_data("mask_value",static_cast<double>(var_fill_value));
         field1.get_header().set_extra_data("mask_value",static_cast<double>(var_fill_value));
+        field_next.get_header().set_extra_data("mask_value",static_cast<double>(var_fill_value));
         field_out.get_header().set_extra_data("mask_value",static_cast<double>(var_fill_value));
       } else {
         EKAT_ERROR_MSG (
@@ -344,39 +405,116 @@ void TimeInterpolation::set_file_data_triplets(const vos_type& list_of_files) {
 void TimeInterpolation::read_data()
 {
   const auto triplet_curr = m_file_data_triplets[m_triplet_idx];
-  if (not m_file_data_atm_input or triplet_curr.filename != m_file_data_atm_input->get_filename()) {
-    // Then we need to close this input stream and open a new one
-    ekat::ParameterList input_params;
-    input_params.set("field_names",m_field_names);
-    input_params.set("filename",triplet_curr.filename);
-    m_file_data_atm_input = std::make_shared<AtmosphereInput>(input_params,m_fm_time1);
-    m_file_data_atm_input->set_logger(m_logger);
-    // Also determine the FillValue, if used
-    // TODO: Should we make it possible to check if FillValue is in the metadata and only assign mask_value if it is?
-    for (auto& name : m_field_names) {
-      auto& field = m_fm_time1->get_field(name);
-      const auto dt = field.data_type();
-      if (dt==DataType::FloatType) {
-        auto var_fill_value = scorpio::get_attribute<float>(triplet_curr.filename,name,"_FillValue");
-        field.get_header().set_extra_data("mask_value",var_fill_value);
-      } else if (dt==DataType::DoubleType) {
-        auto var_fill_value = scorpio::get_attribute<double>(triplet_curr.filename,name,"_FillValue");
-        field.get_header().set_extra_data("mask_value",var_fill_value);
-      } else {
-        EKAT_ERROR_MSG (
-            "[TimeInterpolation] Unexpected/unsupported field data type.\n"
-            " - field name: " + field.name() + "\n"
-            " - data type : " + e2str(dt) + "\n");
-      }
-    }
-  }
+  setup_file_data_input(triplet_curr,m_file_data_remapper ? m_fm_file_data : m_fm_time1);
 
   if (m_logger) {
     m_logger->info(m_header);
     m_logger->info("[EAMxx:time_interpolation] Reading data at time " + triplet_curr.timestamp.to_string());
   }
   m_file_data_atm_input->read_variables(triplet_curr.time_idx);
+  if (m_file_data_remapper) {
+    remap_file_data(m_fm_time1);
+  }
   m_time1 = triplet_curr.timestamp;
+
+  // Start loading the triplet after this one
+  start_prefetch();
+}
+/*-----------------------------------------------------------------------------------------------*/
+/* Function to make the input stream read the file of the given triplet into the fields of the
+ * given field manager. Resetting the fields of the input stream may allocate temporaries, so it
+ * is done only if the target field manager changed (or its fields were swapped).
+ */
+void TimeInterpolation::setup_file_data_input(const DataFromFileTriplet& triplet, const fm_type& fm)
+{
+  if (not m_file_data_atm_input or triplet.filename != m_file_data_atm_input->get_filename()) {
+    // Then we need to close this input stream and open a new one
+    ekat::ParameterList input_params;
+    input_params.set("field_names",m_field_names);
+    input_params.set("filename",triplet.filename);
+    m_file_data_atm_input = std::make_shared<AtmosphereInput>(input_params,fm);
+    m_file_data_atm_input->set_logger(m_logger);
+  } else if (fm != m_file_data_input_fm) {
+    m_file_data_atm_input->set_field_manager(fm);
+  } else {
+    return;
+  }
+  m_file_data_input_fm = fm;
+
+  // Also determine the FillValue, if used, since the fields may have been last read from another file
+  // TODO: Should we make it possible to check if FillValue is in the metadata and only assign mask_value if it is?
+  for (auto& name : m_field_names) {
+    auto& field = fm->get_field(name);
+    const auto dt = field.data_type();
+    if (dt==DataType::FloatType) {
+      auto var_fill_value = scorpio::get_attribute<float>(triplet.filename,name,"_FillValue");
+      field.get_header().set_extra_data("mask_value",var_fill_value);
+    } else if (dt==DataType::DoubleType) {
+      auto var_fill_value = scorpio::get_attribute<double>(triplet.filename,name,"_FillValue");
+      field.get_header().set_extra_data("mask_value",var_fill_value);
+    } else {
+      EKAT_ERROR_MSG (
+          "[TimeInterpolation] Unexpected/unsupported field data type.\n"
+          " - field name: " + field.name() + "\n"
+          " - data type : " + e2str(dt) + "\n");
+    }
+  }
+}
+/*-----------------------------------------------------------------------------------------------*/
+void TimeInterpolation::start_prefetch()
+{
+  const int next = m_triplet_idx+1;
+  m_prefetch_idx = next < static_cast<int>(m_file_data_triplets.size()) ? next : -1;
+  m_prefetch_step = 0;
+}
+/*-----------------------------------------------------------------------------------------------*/
+void TimeInterpolation::prefetch_step()
+{
+  // Each step reads one field. If data is remapped, one last step does the remap
+  if (m_prefetch_idx<0 or m_prefetch_step>=num_prefetch_steps()) {
+    return;
+  }
+  if (m_prefetch_step<static_cast<int>(m_field_names.size())) {
+    const auto& triplet = m_file_data_triplets[m_prefetch_idx];
+    setup_file_data_input(triplet,m_file_data_remapper ? m_fm_file_data : m_fm_next);
+    m_file_data_atm_input->read_variable(m_field_names[m_prefetch_step],triplet.time_idx);
+  } else {
+    remap_file_data(m_fm_next);
+  }
+  ++m_prefetch_step;
+}
+/*-----------------------------------------------------------------------------------------------*/
+void TimeInterpolation::complete_prefetch()
+{
+  while (m_prefetch_step<num_prefetch_steps()) {
+    prefetch_step();
+  }
+}
+/*-----------------------------------------------------------------------------------------------*/
+int TimeInterpolation::num_prefetch_steps() const
+{
+  const int nfields = m_field_names.size();
+  return m_file_data_remapper ? nfields+1 : nfields;
+}
+/*-----------------------------------------------------------------------------------------------*/
+/* Function to fix and remap the data just read from file, and store it in the given field manager.
+ * NOTE: the src fields are shared by synchronous reads and prefetch. This is ok, since
+ *       a synchronous read always restarts the prefetch from scratch.
+ */
+void TimeInterpolation::remap_file_data(const fm_type& fm)
+{
+  if (m_file_data_fixer) {
+    for (auto name : m_field_names) {
+      m_file_data_fixer(m_fm_file_data->get_field(name));
+    }
+  }
+  m_file_data_remapper->remap_fwd();
+  for (int i=0; i<m_file_data_remapper->get_num_fields(); ++i) {
+    const auto& tgt = m_file_data_remapper->get_tgt_field(i);
+    if (fm->has_field(tgt.name())) {
+      fm->get_field(tgt.name()).deep_copy(tgt);
+    }
+  }
 }
 /*-----------------------------------------------------------------------------------------------*/
 /* Function to check the current set of interpolation data against a timestamp and, if needed,
@@ -410,16 +548,24 @@ void TimeInterpolation::check_and_update_data(const TimeStamp& ts_in)
 		   <<  "     TimeStamp time1: " << m_time1.to_string() << "\n");
     // Now we need to make sure we didn't jump more than one triplet, if we did then the data at time0 is
     // incorrect.
-    if (step_cnt>1) {
-      // Then we need to populate data for time1 as the previous triplet before shifting data to time0
-      --m_triplet_idx;
+    if (step_cnt==1 and m_prefetch_idx==m_triplet_idx) {
+      // The new time1 data is (at least partially) prefetched: finish loading it, and rotate
+      complete_prefetch();
+      rotate_data();
+      update_timestamp(m_file_data_triplets[m_triplet_idx].timestamp);
+      start_prefetch();
+    } else {
+      if (step_cnt>1) {
+        // Then we need to populate data for time1 as the previous triplet before shifting data to time0
+        --m_triplet_idx;
+        read_data();
+        ++m_triplet_idx;
+      }
+      // We shift the time1 data to time0 and read the new data.
+      shift_data();
+      update_timestamp(m_file_data_triplets[m_triplet_idx].timestamp);
       read_data();
-      ++m_triplet_idx;
     }
-    // We shift the time1 data to time0 and read the new data.
-    shift_data();
-    update_timestamp(m_file_data_triplets[m_triplet_idx].timestamp);
-    read_data();
     // Sanity Check
     bool current_data_check = (ts_in.seconds_from(m_time0) >= 0) and (m_time1.seconds_from(ts_in) >= 0);
     EKAT_REQUIRE_MSG(current_data_check,"ERROR!! TimeInterpolation::check_and_update_data - Something went wrong in updating data:\n"
@@ -2,6 +2,7 @@
 #define EAMXX_TIME_INTERPOLATION_HPP
 
 #include "share/grid/abstract_grid.hpp"
+#include "share/grid/remap/abstract_remapper.hpp"
 
 #include "share/util/eamxx_time_stamp.hpp"
 
@@ -10,6 +11,8 @@
 
 #include "share/io/scorpio_input.hpp"
 
+#include <functional>
+
 namespace scream{
 namespace util {
 
@@ -37,6 +40,15 @@ public:
   // Build interpolator
   void add_field(const Field& field_in, const bool store_shallow_copy=false);
 
+  // When using data from file, optionally remap each time snap right after it is read, so that
+  // the time interpolation happens on the remapper tgt grid. Data is read into the remapper src
+  // fields, which must have the same names as the interpolator fields (and the file variables),
+  // and then copied from the tgt fields. The optional fixer is called on each src field before
+  // remapping (e.g., to cure masked values). Must be called after all fields are added, after
+  // the remapper registration ends, and before initialize_data_from_files.
+  void set_file_data_remapper(const std::shared_ptr<AbstractRemapper>& remapper,
+                              const std::function<void(const Field&)>& fixer = nullptr);
+
   // Getters
   Field get_field(const std::string& name) {
     return m_interp_fields.at(name);
@@ -70,15 +82,28 @@ protected:
 
   // Helper functions to shift data
   void shift_data();
+  void rotate_data();
 
   // For the case where forcing data comes from files
   void set_file_data_triplets(const vos_type& list_of_files);
   void read_data();
   void check_and_update_data(const TimeStamp& ts_in);
-
-  // Local field managers used to store two time snaps of data for interpolation
+  void setup_file_data_input(const DataFromFileTriplet& triplet, const fm_type& fm);
+
+  // While interpolating between time0 and time1, the triplet after time1 is loaded
+  // in a third field manager, one field per call to perform_time_interpolation. This
+  // way, moving to the next triplet does not require to read all fields at once.
+  void start_prefetch();
+  void prefetch_step();
+  void complete_prefetch();
+  int num_prefetch_steps() const;
+  void remap_file_data(const fm_type& fm);
+
+  // Local field managers used to store two time snaps of data for interpolation,
+  // plus the prefetched one (only when using data from file)
   fm_type  m_fm_time0;
   fm_type  m_fm_time1;
+  fm_type  m_fm_next;
   vos_type m_field_names;
   std::map<std::string,Field> m_interp_fields;
 
@@ -90,8 +115,16 @@ protected:
   std::vector<DataFromFileTriplet>           m_file_data_triplets;
   int                                        m_triplet_idx;
   std::shared_ptr<AtmosphereInput>           m_file_data_atm_input;
+  fm_type                                    m_file_data_input_fm; // The fm the input stream reads into
+  int                                        m_prefetch_idx = -1;  // Triplet being prefetched (-1 means none)
+  int                                        m_prefetch_step = 0;  // Number of fields already prefetched
   bool                                       m_is_data_from_file=false;
 
+  // Optional remap of the data read from file (see set_file_data_remapper)
+  std::shared_ptr<AbstractRemapper>          m_file_data_remapper;
+  std::function<void(const Field&)>          m_file_data_fixer;
+  fm_type                                    m_fm_file_data; // The remapper src fields
+
   std::shared_ptr<ekat::logger::LoggerBase>  m_logger;
   std::string                                m_header;
 }; // class TimeInterpolation
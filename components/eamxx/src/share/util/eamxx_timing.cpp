@@ -1,9 +1,23 @@
 #include "share/util/eamxx_timing.hpp"
 
+#include <ekat/ekat_assert.hpp>
+
+#include <Kokkos_Core.hpp>
+
 #include <gptl.h>
 
 namespace scream {
 
+namespace {
+bool s_timers_device_fence = false;
+
+void fence_if_needed () {
+  if (s_timers_device_fence) {
+    Kokkos::fence();
+  }
+}
+} // anonymous namespace
+
 void init_gptl (bool& was_already_inited) {
 #ifdef SCREAM_CIME_BUILD
   was_already_inited = true;
@@ -17,13 +31,37 @@ void finalize_gptl () {
 }
 
 void start_timer (const std::string& name) {
+  fence_if_needed();
   GPTLstart(name.c_str());
 }
 
 void stop_timer (const std::string& name) {
+  fence_if_needed();
   GPTLstop(name.c_str());
 }
 
+void start_timer (TimerHandle& timer) {
+  EKAT_ASSERT_MSG (not timer.m_name.empty(),
+      "Error! Cannot start a timer handle with no name.\n");
+  fence_if_needed();
+  GPTLstart_handle(timer.m_name.c_str(),&timer.m_gptl_handle);
+}
+
+void stop_timer (TimerHandle& timer) {
+  EKAT_ASSERT_MSG (not timer.m_name.empty(),
+      "Error! Cannot stop a timer handle with no name.\n");
+  fence_if_needed();
+  GPTLstop_handle(timer.m_name.c_str(),&timer.m_gptl_handle);
+}
+
+void set_timers_device_fence (const bool fence) {
+  s_timers_device_fence = fence;
+}
+
+bool get_timers_device_fence () {
+  return s_timers_device_fence;
+}
+
 void write_timers_to_file (const ekat::Comm& comm, const std::string& fname) {
   GPTLpr_summary_file (comm.mpi_comm(),fname.c_str());
 }
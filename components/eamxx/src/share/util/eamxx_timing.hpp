@@ -15,6 +15,36 @@ void finalize_gptl ();
 void start_timer (const std::string& name);
 void stop_timer (const std::string& name);
 
+// A timer to be used in hot paths. The name is stored once, and the GPTL timer
+// is looked up the first time the timer is started/stopped, so that later calls
+// neither build strings nor hash the name. Like GPTL handles, a TimerHandle must
+// only be used by one thread.
+class TimerHandle {
+public:
+  TimerHandle () = default;
+  TimerHandle (const std::string& name) : m_name (name) {}
+
+  const std::string& name () const { return m_name; }
+
+private:
+  friend void start_timer (TimerHandle& timer);
+  friend void stop_timer (TimerHandle& timer);
+
+  std::string m_name;
+  void*       m_gptl_handle = nullptr;
+};
+
+void start_timer (TimerHandle& timer);
+void stop_timer (TimerHandle& timer);
+
+// If on, fence the device before starting/stopping a timer, so that timers
+// measure the time of the kernels launched in their scope, rather than
+// just their launch time. Off by default, since fences prevent overlapping
+// host and device work.
+void set_timers_device_fence (const bool fence);
+bool get_timers_device_fence ();
+
+// Writes per-timer stats across ranks (including min/max over ranks)
 void write_timers_to_file (const ekat::Comm& comm, const std::string& fname);
 
 } // namespace scream
@@ -90,6 +90,10 @@
  
  -L and -I need to be changed to reflect the locations of the NetCDF library and header files, respectively.
  
+ The per grid cell calculations (calchurtt) can be run with OpenMP threads by adding -fopenmp (gcc) or -qopenmp (intel),
+ 	or by using 'make OPENMP=1'; set OMP_NUM_THREADS as usual. The outputs are the same as for the serial build.
+ 	The years are still processed in order because each year uses the previous year output as its reference.
+ 
  Some other details on the standalone version from July 2019 (adv):
  
  these are modifications to full_updateannuallanduse_louise_cleanedup.c, which louise gave me
@@ -1397,7 +1401,37 @@ updatehurttgrazing() {
 }
 
 /* NOTE: used by standalone only */
-// the exact number of valid records have to be allocated and read in, and these are different for historical and future
+// read a single time record of a luh variable into values, which needs lonlen * latlen doubles
+// time is the slowest varying dimension, so this is the same block of data that reading the whole variable
+//  puts at offset hurttyear * MAXOUTPIX * MAXOUTLIN, without reading (and allocating) all the other years every year
+// note that the netcdf start indices are 0-based
+void
+readhurttrecord(int varid, long hurttyear, double *values) {
+    
+    int recdimsp, dimcnt;
+    int recdimids[NC_MAX_VAR_DIMS];
+    size_t start[NC_MAX_VAR_DIMS];
+    size_t count[NC_MAX_VAR_DIMS];
+    
+    nc_inq_varndims(innetcdfid, varid, &recdimsp);
+    nc_inq_vardimid(innetcdfid, varid, recdimids);
+    for (dimcnt = 0; dimcnt < recdimsp; dimcnt++) {
+        start[dimcnt] = 0;
+        nc_inq_dimlen(innetcdfid, recdimids[dimcnt], &count[dimcnt]);
+    }
+    start[0] = hurttyear;
+    count[0] = 1;
+    
+    innetcdfstat = nc_get_vara_double(innetcdfid, varid, start, count, values);
+    if (innetcdfstat != NC_NOERR) {
+        printf("Error reading record %li of variable %d: %s\n", hurttyear, varid, nc_strerror(innetcdfstat));
+        exit(0);
+    }
+    
+}
+
+/* NOTE: used by standalone only */
+// only the needed year records are read in (see readhurttrecord), so ISFUTURE is not used
 void
 readhurttprimary(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     // hurttbaseyear is not used
@@ -1405,7 +1439,6 @@ readhurttprimary(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     double *primaryvalues;
     double inprimaryvalue;
     long outgrid;
-    long offsetgrid;
     
     selectedvarcnt = 0;
     
@@ -1430,20 +1463,12 @@ readhurttprimary(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     }
     
     // nc_inq_var(innetcdfid, selectedvarids[0], varname, &vartype, &vardimsp, &vardimidsp, &varattsp);
-	if(ISFUTURE){
-		varlayers = INFUTURELUTIME;
-	} else {
-		varlayers = INHISTLUTIME;
-	}
-    varlayers2 = 1;
-    primaryvalues = malloc(sizeof(double) * lonlen * latlen * varlayers * varlayers2); // lonlen=720, latlen=360
-
-    nc_get_var_double(innetcdfid, selectedvarids[0], primaryvalues);
+    primaryvalues = malloc(sizeof(double) * lonlen * latlen); // lonlen=720, latlen=360
     
     if (hurttyear >= 0) {
+        readhurttrecord(selectedvarids[0], hurttyear, primaryvalues);
         for (outgrid = 0; outgrid < MAXOUTPIX * MAXOUTLIN; outgrid++) {  // MAXOUTPIX 720; MAXOUTLIN 360
-            offsetgrid = hurttyear * MAXOUTPIX * MAXOUTLIN + outgrid;
-            inprimaryvalue = primaryvalues[offsetgrid];
+            inprimaryvalue = primaryvalues[outgrid];
 			// put input directly into glmo array
             // this is needed only when running standalone
 			glmo[outgrid][2] = inprimaryvalue;
@@ -1464,7 +1489,7 @@ readhurttprimary(long hurttbaseyear, long hurttyear, int ISFUTURE) {
 }
 
 /* NOTE: used by standalone only */
-// the exact number of valid records have to be allocated and read in, and these are different for historical and future
+// only the needed year records are read in (see readhurttrecord), so ISFUTURE is not used
 void
 readhurttsecondary(long hurttbaseyear, long hurttyear, int ISFUTURE) {
 	// hurttbaseyear is not used
@@ -1472,7 +1497,6 @@ readhurttsecondary(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     double *secondaryvalues;
     double insecondaryvalue;
     long outgrid;
-    long offsetgrid;
     
     selectedvarcnt = 0;
     
@@ -1491,19 +1515,12 @@ readhurttsecondary(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     }
     
     nc_inq_var(innetcdfid, selectedvarids[0], varname, &vartype, &vardimsp, &vardimidsp, &varattsp);
-	if(ISFUTURE){
-		varlayers = INFUTURELUTIME;
-	} else {
-		varlayers = INHISTLUTIME;
-	}
-    varlayers2 = 1;
-    secondaryvalues = malloc(sizeof(double) * lonlen * latlen * varlayers * varlayers2);
-    nc_get_var_double(innetcdfid,selectedvarids[0],secondaryvalues);
+    secondaryvalues = malloc(sizeof(double) * lonlen * latlen);
     
     if (hurttyear >= 0) {
+        readhurttrecord(selectedvarids[0], hurttyear, secondaryvalues);
         for (outgrid = 0; outgrid < MAXOUTPIX * MAXOUTLIN; outgrid++) {
-            offsetgrid = hurttyear * MAXOUTPIX * MAXOUTLIN + outgrid;
-            insecondaryvalue = secondaryvalues[offsetgrid];
+            insecondaryvalue = secondaryvalues[outgrid];
 			// put input directly into glmo array
             // this is only used for standalone
 			glmo[outgrid][3] = insecondaryvalue;
@@ -1525,14 +1542,13 @@ readhurttsecondary(long hurttbaseyear, long hurttyear, int ISFUTURE) {
 }
 
 /* NOTE: used by standalone only */
-// the exact number of valid records have to be allocated and read in, and these are different for historical and future
+// only the needed year records are read in (see readhurttrecord), so ISFUTURE is not used
 void
 readhurttcrop(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     
     double *cropvalues;
     double incropvalue;
     long outgrid;
-    long offsetgrid;
     
     selectedvarcnt = 0;
     
@@ -1551,23 +1567,16 @@ readhurttcrop(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     }
     
     /*  nc_inq_var(innetcdfid, selectedvarids[0], varname, &vartype, &vardimsp, &vardimidsp, &varattsp); */
-	if(ISFUTURE){
-		varlayers = INFUTURELUTIME;
-	} else {
-		varlayers = INHISTLUTIME;
-	}
-    varlayers2 = 1;
-    cropvalues = malloc(sizeof(double) * lonlen * latlen * varlayers * varlayers2);
-    nc_get_var_double(innetcdfid,selectedvarids[0],cropvalues);
+    cropvalues = malloc(sizeof(double) * lonlen * latlen);
     
     //printf("hurttbaseyear: %li \n",hurttbaseyear);
     //printf("hurttyear: %li \n",hurttyear);
     
+    readhurttrecord(selectedvarids[0], hurttbaseyear, cropvalues);
     for (outgrid = 0; outgrid < MAXOUTPIX * MAXOUTLIN; outgrid++) {
         // hurttbaseyear is set to 0. This means that it is reading values for year 1850
 		// this is not being used for the reference; this is overwritten by values from the dynamic file
-        offsetgrid = hurttbaseyear * MAXOUTPIX * MAXOUTLIN + outgrid;
-        incropvalue = cropvalues[offsetgrid];
+        incropvalue = cropvalues[outgrid];
         if (incropvalue >= 0.0 && incropvalue <= 1.1) {
             //inhurttbasecrop[outgrid] = round(incropvalue * 100.0);
             inhurttbasecrop[outgrid] = incropvalue * 100.0;
@@ -1581,9 +1590,9 @@ readhurttcrop(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     }
     
     if (hurttyear >= 0) {
+        readhurttrecord(selectedvarids[0], hurttyear, cropvalues);
         for (outgrid = 0; outgrid < MAXOUTPIX * MAXOUTLIN; outgrid++) {
-            offsetgrid = hurttyear * MAXOUTPIX * MAXOUTLIN + outgrid;
-            incropvalue = cropvalues[offsetgrid];
+            incropvalue = cropvalues[outgrid];
 			// put input directly into glmo array
             // this is for standalone runds only
 			glmo[outgrid][0] = incropvalue;
@@ -1605,14 +1614,13 @@ readhurttcrop(long hurttbaseyear, long hurttyear, int ISFUTURE) {
 }
 
 /* NOTE: used by standalone only */
-// the exact number of valid records have to be allocated and read in, and these are different for historical and future
+// only the needed year records are read in (see readhurttrecord), so ISFUTURE is not used
 void
 readhurttpasture(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     
     double *pasturevalues;
     double inpasturevalue;
     long outgrid;
-    long offsetgrid;
     
     selectedvarcnt = 0;
     
@@ -1630,18 +1638,11 @@ readhurttpasture(long hurttbaseyear, long hurttyear, int ISFUTURE) {
         
     }
     /*  nc_inq_var(innetcdfid, selectedvarids[0], varname, &vartype, &vardimsp, &vardimidsp, &varattsp); */
-	if(ISFUTURE){
-		varlayers = INFUTURELUTIME;
-	} else {
-		varlayers = INHISTLUTIME;
-	}
-    varlayers2 = 1;
-    pasturevalues = malloc(sizeof(double) * lonlen * latlen * varlayers * varlayers2);
-    nc_get_var_double(innetcdfid,selectedvarids[0],pasturevalues);
+    pasturevalues = malloc(sizeof(double) * lonlen * latlen);
     
+    readhurttrecord(selectedvarids[0], hurttbaseyear, pasturevalues);
     for (outgrid = 0; outgrid < MAXOUTPIX * MAXOUTLIN; outgrid++) {
-        offsetgrid = hurttbaseyear * MAXOUTPIX * MAXOUTLIN + outgrid;
-        inpasturevalue = pasturevalues[offsetgrid];
+        inpasturevalue = pasturevalues[outgrid];
         if (inpasturevalue >= 0.0 && inpasturevalue <= 1.1) {
             //inhurttbasepasture[outgrid] = round(inpasturevalue * 100.0);
             inhurttbasepasture[outgrid] = inpasturevalue * 100.0;
@@ -1655,9 +1656,9 @@ readhurttpasture(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     }
     
     if (hurttyear >= 0) {
+        readhurttrecord(selectedvarids[0], hurttyear, pasturevalues);
         for (outgrid = 0; outgrid < MAXOUTPIX * MAXOUTLIN; outgrid++) {
-            offsetgrid = hurttyear * MAXOUTPIX * MAXOUTLIN + outgrid;
-            inpasturevalue = pasturevalues[offsetgrid];
+            inpasturevalue = pasturevalues[outgrid];
 			// put input directly into glmo array
             // this is for standalone only
 			glmo[outgrid][1] = inpasturevalue;
@@ -1680,7 +1681,7 @@ readhurttpasture(long hurttbaseyear, long hurttyear, int ISFUTURE) {
 }
 
 /* NOTE: used by standalone only */
-// the exact number of valid records have to be allocated and read in, and these are different for historical and future
+// only the needed year records are read in (see readhurttrecord), so ISFUTURE is not used
 void
 readhurttvh1(long hurttbaseyear, long hurttyear, int ISFUTURE) {
 	// hurttbaseyear is not used
@@ -1688,18 +1689,8 @@ readhurttvh1(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     double *vh1values;
     double invh1value;
     long outgrid;
-    long offsetgrid;
-	//const size_t start[] = {1,1,1};
 	int udimid;
 	size_t udimlen;
-	
-	if(ISFUTURE){
-		varlayers = INFUTUREHARVTIME;
-	} else {
-		varlayers = INHISTHARVTIME;
-	}
-	
-	//const size_t count[] ={varlayers,MAXOUTLIN,MAXOUTPIX};
     
     selectedvarcnt = 0;
     
@@ -1720,17 +1711,12 @@ readhurttvh1(long hurttbaseyear, long hurttyear, int ISFUTURE) {
         
     }
     nc_inq_var(innetcdfid, selectedvarids[0], varname, &vartype, &vardimsp, &vardimidsp, &varattsp);
-    varlayers2 = 1;
-    vh1values = malloc(sizeof(double) * lonlen * latlen * varlayers * varlayers2);
-	// vara doesn't work on the new file either, but var does
-    //nc_get_vara_double(innetcdfid,selectedvarids[0],start,count,vh1values);
-	nc_get_var_double(innetcdfid,selectedvarids[0],vh1values);
-	//printf("varlayers=%i\tcount0=%zu\tcount1=%zu\tcount2=%zu\tvarid=%i\n", varlayers, count[0], count[1], count[2], selectedvarids[0]);
+    vh1values = malloc(sizeof(double) * lonlen * latlen);
 
     if (hurttyear >= 0) {
+        readhurttrecord(selectedvarids[0], hurttyear, vh1values);
         for (outgrid = 0; outgrid < MAXOUTPIX * MAXOUTLIN; outgrid++) {
-            offsetgrid = hurttyear * MAXOUTPIX * MAXOUTLIN + outgrid;
-            invh1value = vh1values[offsetgrid];
+            invh1value = vh1values[outgrid];
             if (invh1value >= 0.0 && invh1value <= 1.1) {
                 inhurttvh1[outgrid] = (invh1value * 100.0);
                 if (inhurttvh1[outgrid] > 100.0) {
@@ -1740,7 +1726,6 @@ readhurttvh1(long hurttbaseyear, long hurttyear, int ISFUTURE) {
             else {
                 inhurttvh1[outgrid] = 0.0;
             }
-			//printf("outgrid=%li\toffsetgrid=%li\tinval=%f\tihvh1=%f\tvh1val=%f\n", outgrid, offsetgrid, invh1value, inhurttvh1[outgrid], vh1values[offsetgrid]);
         }
     }
     
@@ -1749,7 +1734,7 @@ readhurttvh1(long hurttbaseyear, long hurttyear, int ISFUTURE) {
 }
 
 /* NOTE: used by standalone only */
-// the exact number of valid records have to be allocated and read in, and these are different for historical and future
+// only the needed year records are read in (see readhurttrecord), so ISFUTURE is not used
 void
 readhurttvh2(long hurttbaseyear, long hurttyear, int ISFUTURE) {
 	// hurttbaseyear is not used
@@ -1757,16 +1742,6 @@ readhurttvh2(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     double *vh2values;
     double invh2value;
     long outgrid;
-    long offsetgrid;
-	//const size_t start[] = {1,1,1};
-	
-	if(ISFUTURE){
-		varlayers = INFUTUREHARVTIME;
-	} else {
-		varlayers = INHISTHARVTIME;
-	}
-	
-	//const size_t count[] ={varlayers,MAXOUTLIN,MAXOUTPIX};
     
     selectedvarcnt = 0;
     
@@ -1785,16 +1760,12 @@ readhurttvh2(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     }
 	
     /*  nc_inq_var(innetcdfid, selectedvarids[0], varname, &vartype, &vardimsp, &vardimidsp, &varattsp); */
-    varlayers2 = 1;
-    vh2values = malloc(sizeof(double) * lonlen * latlen * varlayers * varlayers2);
-	// vara doesn't work on the new file either, but var does
-	nc_get_var_double(innetcdfid,selectedvarids[0],vh2values);
-	//nc_get_vara_double(innetcdfid,selectedvarids[0],start,count,vh2values);
+    vh2values = malloc(sizeof(double) * lonlen * latlen);
     
     if (hurttyear >= 0) {
+        readhurttrecord(selectedvarids[0], hurttyear, vh2values);
         for (outgrid = 0; outgrid < MAXOUTPIX * MAXOUTLIN; outgrid++) {
-            offsetgrid = hurttyear * MAXOUTPIX * MAXOUTLIN + outgrid;
-            invh2value = vh2values[offsetgrid];
+            invh2value = vh2values[outgrid];
             if (invh2value >= 0.0 && invh2value <= 1.1) {
                 inhurttvh2[outgrid] = (invh2value * 100.0);
                 if (inhurttvh2[outgrid] > 100.0) {
@@ -1812,7 +1783,7 @@ readhurttvh2(long hurttbaseyear, long hurttyear, int ISFUTURE) {
 }
 
 /* NOTE: used by standalone only */
-// the exact number of valid records have to be allocated and read in, and these are different for historical and future
+// only the needed year records are read in (see readhurttrecord), so ISFUTURE is not used
 void
 readhurttsh1(long hurttbaseyear, long hurttyear, int ISFUTURE) {
 	// hurttbaseyear is not used
@@ -1820,16 +1791,6 @@ readhurttsh1(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     double *sh1values;
     double insh1value;
     long outgrid;
-    long offsetgrid;
-	//const size_t start[] = {1,1,1};
-	
-	if(ISFUTURE){
-		varlayers = INFUTUREHARVTIME;
-	} else {
-		varlayers = INHISTHARVTIME;
-	}
-	
-	//const size_t count[] ={varlayers,MAXOUTLIN,MAXOUTPIX};
     
     selectedvarcnt = 0;
     
@@ -1848,16 +1809,12 @@ readhurttsh1(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     }
     
     /*  nc_inq_var(innetcdfid, selectedvarids[0], varname, &vartype, &vardimsp, &vardimidsp, &varattsp); */
-    varlayers2 = 1;
-    sh1values = malloc(sizeof(double) * lonlen * latlen * varlayers * varlayers2);
-	// vara doesn't work on the new file either, but var does
-	nc_get_var_double(innetcdfid,selectedvarids[0],sh1values);
-    //nc_get_vara_double(innetcdfid,selectedvarids[0],start,count,sh1values);
+    sh1values = malloc(sizeof(double) * lonlen * latlen);
     
     if (hurttyear >= 0) {
+        readhurttrecord(selectedvarids[0], hurttyear, sh1values);
         for (outgrid = 0; outgrid < MAXOUTPIX * MAXOUTLIN; outgrid++) {
-            offsetgrid = hurttyear * MAXOUTPIX * MAXOUTLIN + outgrid;
-            insh1value = sh1values[offsetgrid];
+            insh1value = sh1values[outgrid];
             if (insh1value >= 0.0 && insh1value <= 1.1) {
                 inhurttsh1[outgrid] = (insh1value * 100.0);
                 if (inhurttsh1[outgrid] > 100.0) {
@@ -1875,7 +1832,7 @@ readhurttsh1(long hurttbaseyear, long hurttyear, int ISFUTURE) {
 }
 
 /* NOTE: used by standalone only */
-// the exact number of valid records have to be allocated and read in, and these are different for historical and future
+// only the needed year records are read in (see readhurttrecord), so ISFUTURE is not used
 void
 readhurttsh2(long hurttbaseyear, long hurttyear, int ISFUTURE) {
 	// hurttbaseyear is not used
@@ -1883,16 +1840,6 @@ readhurttsh2(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     double *sh2values;
     double insh2value;
     long outgrid;
-    long offsetgrid;
-	//const size_t start[] = {1,1,1};
-	
-	if(ISFUTURE){
-		varlayers = INFUTUREHARVTIME;
-	} else {
-		varlayers = INHISTHARVTIME;
-	}
-	
-	//const size_t count[] ={varlayers,MAXOUTLIN,MAXOUTPIX};
     
     selectedvarcnt = 0;
     
@@ -1911,16 +1858,12 @@ readhurttsh2(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     }
     
     /*  nc_inq_var(innetcdfid, selectedvarids[0], varname, &vartype, &vardimsp, &vardimidsp, &varattsp); */
-    varlayers2 = 1;
-    sh2values = malloc(sizeof(double) * lonlen * latlen * varlayers * varlayers2);
-	// vara doesn't work on the new file either, but var does
-	nc_get_var_double(innetcdfid,selectedvarids[0],sh2values);
-    //nc_get_vara_double(innetcdfid,selectedvarids[0],start,count,sh2values);
+    sh2values = malloc(sizeof(double) * lonlen * latlen);
     
     if (hurttyear >= 0) {
+        readhurttrecord(selectedvarids[0], hurttyear, sh2values);
         for (outgrid = 0; outgrid < MAXOUTPIX * MAXOUTLIN; outgrid++) {
-            offsetgrid = hurttyear * MAXOUTPIX * MAXOUTLIN + outgrid;
-            insh2value = sh2values[offsetgrid];
+            insh2value = sh2values[outgrid];
             if (insh2value >= 0.0 && insh2value <= 1.1) {
                 inhurttsh2[outgrid] = (insh2value * 100.0);
                 if (inhurttsh2[outgrid] > 100.0) {
@@ -1938,7 +1881,7 @@ readhurttsh2(long hurttbaseyear, long hurttyear, int ISFUTURE) {
 }
 
 /* NOTE: used by standalone only */
-// the exact number of valid records have to be allocated and read in, and these are different for historical and future
+// only the needed year records are read in (see readhurttrecord), so ISFUTURE is not used
 void
 readhurttsh3(long hurttbaseyear, long hurttyear, int ISFUTURE) {
 	// hurttbaseyear is not used
@@ -1946,16 +1889,6 @@ readhurttsh3(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     double *sh3values;
     double insh3value;
     long outgrid;
-    long offsetgrid;
-	//const size_t start[] = {1,1,1};
-	
-	if(ISFUTURE){
-		varlayers = INFUTUREHARVTIME;
-	} else {
-		varlayers = INHISTHARVTIME;
-	}
-	
-	//const size_t count[] ={varlayers,MAXOUTLIN,MAXOUTPIX};
     
     selectedvarcnt = 0;
     
@@ -1974,16 +1907,12 @@ readhurttsh3(long hurttbaseyear, long hurttyear, int ISFUTURE) {
     }
     
     /*  nc_inq_var(innetcdfid, selectedvarids[0], varname, &vartype, &vardimsp, &vardimidsp, &varattsp); */
-    varlayers2 = 1;
-    sh3values = malloc(sizeof(double) * lonlen * latlen * varlayers * varlayers2);
-	// vara doesn't work on the new file either, but var does
-	nc_get_var_double(innetcdfid,selectedvarids[0],sh3values);
-    //nc_get_vara_double(innetcdfid,selectedvarids[0],start,count,sh3values);
+    sh3values = malloc(sizeof(double) * lonlen * latlen);
     
     if (hurttyear >= 0) {
+        readhurttrecord(selectedvarids[0], hurttyear, sh3values);
         for (outgrid = 0; outgrid < MAXOUTPIX * MAXOUTLIN; outgrid++) {
-            offsetgrid = hurttyear * MAXOUTPIX * MAXOUTLIN + outgrid;
-            insh3value = sh3values[offsetgrid];
+            insh3value = sh3values[outgrid];
             if (insh3value >= 0.0 && insh3value <= 1.1) {
                 inhurttsh3[outgrid] = (insh3value * 100.0);
                 if (inhurttsh3[outgrid] > 100.0) {
@@ -5781,7 +5710,14 @@ void
 calchurtt(int modyear, int calcyear) {
     
     int outgrid;
-    
+
+    // the grid cells are independent: each one only writes its own entries of the output arrays,
+    //  and only reads the input arrays (findcurrentpasturegrid also reads neighboring cells, but of incurrentpftval, which is not modified here)
+    // so they can be processed in parallel, with the same results as serial; see OPENMP in the Makefile
+    // the DEBUG output is per grid cell, so keep it serial for readability
+#if defined(_OPENMP) && !defined(DEBUG)
+#pragma omp parallel for schedule(dynamic, MAXOUTPIX)
+#endif
     for (outgrid = 0; outgrid < MAXOUTPIX * MAXOUTLIN; outgrid++) {
 		/* initalize two pft mask arrays for each grid -adv */
 		cropavailpotvegtreepftval[outgrid] = 0;
@@ -6346,20 +6282,25 @@ updateannuallanduse_main(double glmo[][GLMONFLDS], double plodata[][PLONFLDS], i
     writeinhurtt();
     
 	/* get the clm potential vegetation pft data -adv */
-   strcpy(filenamestr, in_dir);
-	strcat(filenamestr, pot_veg_file);
-	
-	if (opennetcdf(filenamestr) == 0) {
-		exit(0);
-	}
-	
-	readpotvegpft();
-	readpotvegpftpct();
-	
-	if (closenetcdf(filenamestr) == 0) {
-		exit(0);
+	// these do not change from year to year and nothing else modifies them, so only read them for the first year processed
+	static int potvegread = 0;
+	if (!potvegread) {
+      strcpy(filenamestr, in_dir);
+		strcat(filenamestr, pot_veg_file);
+
+		if (opennetcdf(filenamestr) == 0) {
+			exit(0);
+		}
+
+		readpotvegpft();
+		readpotvegpftpct();
+
+		if (closenetcdf(filenamestr) == 0) {
+			exit(0);
+		}
+		potvegread = 1;
 	}
-	
+
 	/* this puts the currentpft data into the output year pft array,
 	 then adjusts the crops, then the pasture, then calculates harvest fractions
 	 these adjustments are done in order so that the pasture adjustments depend somewhat on the crop adjustments
@@ -69,6 +69,10 @@ struct SimulationParams
   // to >0 for diagnostics.
   int       internal_diagnostics_level = 0;
 
+  // Overlap the boundary exchange in the RK stages with the computation
+  // on elements that have no shared connection. Default is false.
+  bool      bexch_overlap = false;
+
   // Use this member to check whether the struct has been initialized
   bool      params_set = false;
 };
@@ -113,6 +117,7 @@ inline void SimulationParams::print (std::ostream& out) {
   out << "   dp3d_thresh: " << dp3d_thresh << "\n";
   out << "   vtheta_thresh: " << vtheta_thresh << "\n";
   out << "   internal_diagnostics_level: " << internal_diagnostics_level << "\n";
+  out << "   bexch_overlap: " << (bexch_overlap ? "yes" : "no") << "\n";
   out << "\n**********************************************************\n";
 }
 
@@ -59,6 +59,7 @@ BoundaryExchange::BoundaryExchange()
   m_cleaned_up = true;
   m_send_pending = false;
   m_recv_pending = false;
+  m_non_shared_pack_pending = false;
 
   m_diagnostics_level = 0;
 }
@@ -318,6 +319,68 @@ void BoundaryExchange::exchange (const ExecViewUnmanaged<const Real * [NP][NP]>*
 #endif
 }
 
+void BoundaryExchange::exchange_start ()
+{
+  // Check that the registration has completed first
+  assert (m_registration_completed);
+
+  // Check that this object is setup to perform exchange and not exchange_min_max
+  assert (m_exchange_type==MPI_EXCHANGE);
+
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  if (!m_buffer_views_and_requests_built) {
+    build_buffer_views_and_requests();
+  }
+
+  // Note: we don't print the pre-exchange state hash here, since not all
+  //       elements are up to date yet.
+
+  if ( ! m_recv_requests.empty())
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_recv_requests.size(), m_recv_requests.data()),
+                            m_connectivity->get_comm().mpi_comm());
+  m_recv_pending = true;
+
+  // Only pack shared connections, and get the MPI messages going. The other
+  // connections are packed in exchange_finish
+  pack_and_send (PackFilter::SharedOnly);
+  m_non_shared_pack_pending = true;
+}
+
+void BoundaryExchange::exchange_finish () {
+  exchange_finish(nullptr);
+}
+
+void BoundaryExchange::exchange_finish (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp) {
+  exchange_finish(&rspheremp);
+}
+
+void BoundaryExchange::exchange_finish (const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp)
+{
+  if (m_num_2d_fields+m_num_3d_fields+m_num_3d_int_fields==0) {
+    return;
+  }
+
+  // Don't call exchange_finish without exchange_start
+  assert (m_non_shared_pack_pending && m_send_pending);
+
+  // All elements are up to date now, so we can pack the remaining connections.
+  // These don't go through MPI, so there is nothing to sync or send.
+  tstart("be pack non-shared");
+  pack_fields (PackFilter::NonSharedOnly);
+  m_non_shared_pack_pending = false;
+  tstop("be pack non-shared");
+
+  recv_and_unpack (rspheremp);
+
+#ifndef HOMME_BE_NO_HASHER
+  if (m_diagnostics_level > 0)
+    Homme::print_global_state_hash(std::string("BE-post-") + m_label);
+#endif
+}
+
 void BoundaryExchange::exchange_min_max ()
 {
   // Check that the registration has completed first
@@ -365,7 +428,8 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<const int*> ucon_ptr,
       const ExecViewUnmanaged<ExecViewManaged<Real[NP][NP]>**> fields_2d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Real*>**> send_2d_buffers,
-      const int num_elems, const int num_2d_fields) {
+      const int num_elems, const int num_2d_fields,
+      const bool pack_shared, const bool pack_non_shared) {
   HOMMEXX_STATIC const ConnectionHelpers helpers;
   const int nconn = ucon.extent_int(0);
   Kokkos::parallel_for(
@@ -374,6 +438,9 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const int iconn = it / num_2d_fields;
       const int ifield = it % num_2d_fields;
       const auto& info = ucon(iconn);
+      const bool shared = (info.sharing == etoi(ConnectionSharing::SHARED));
+      if (shared ? !pack_shared : !pack_non_shared)
+        return;
       const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                 info.sharing_local_remote_iconn :
                                 iconn);
@@ -392,6 +459,7 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
       const ExecViewUnmanaged<ExecViewManaged<Scalar[NP][NP][NUM_LEV_PACKS]>**> fields_3d,
       const ExecViewUnmanaged<ExecViewUnmanaged<Scalar**>**> send_3d_buffers,
       const int num_elems, const int num_3d_fields,
+      const bool pack_shared, const bool pack_non_shared,
       ExecViewManaged<int*>* nlev_packs_ = nullptr) {
   assert(partial_column == (nlev_packs_ != nullptr));
   if (partial_column) assert(nlev_packs_->extent_int(0) == num_3d_fields);
@@ -411,6 +479,9 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         }
         const int iconn = it / (num_3d_fields*NUM_LEV_PACKS);
         const auto& info = ucon(iconn);
+        const bool shared = (info.sharing == etoi(ConnectionSharing::SHARED));
+        if (shared ? !pack_shared : !pack_non_shared)
+          return;
         const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                   info.sharing_local_remote_iconn :
                                   iconn);
@@ -442,6 +513,9 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
         for (int iconn = ucon_ptr(ie); iconn < iconn_end; ++iconn) {
           const auto& info = ucon(iconn);
           assert(info.kind != etoi(ConnectionSharing::MISSING));
+          const bool shared = (info.sharing == etoi(ConnectionSharing::SHARED));
+          if (shared ? !pack_shared : !pack_non_shared)
+            continue;
           const int buffer_iconn = (info.sharing == etoi(ConnectionSharing::LOCAL) ?
                                     info.sharing_local_remote_iconn :
                                     iconn);
@@ -462,6 +536,11 @@ pack (const ExecViewUnmanaged<const HaloExchangeUnstructuredConnectionInfo*> uco
 }
 
 void BoundaryExchange::pack_and_send ()
+{
+  pack_and_send(PackFilter::All);
+}
+
+void BoundaryExchange::pack_and_send (const PackFilter filter)
 {
   tstart("be pack_and_send");
   // The registration MUST be completed by now
@@ -490,39 +569,48 @@ void BoundaryExchange::pack_and_send ()
   }
 
   // ---- Pack ---- //
+  pack_fields(filter);
+
+  // ---- Send ---- //
+  tstart("be sync_send_buffer");
+  m_buffers_manager->sync_send_buffer(this); // Deep copy send_buffer into mpi_send_buffer (no op if MPI is on device)
+  tstop("be sync_send_buffer");
+  tstart("be send");
+  if ( ! m_send_requests.empty())
+    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
+                            m_connectivity->get_comm().mpi_comm());
+
+  // Notify a send is ongoing
+  m_send_pending = true;
+  tstop("be pack_and_send");
+}
+
+void BoundaryExchange::pack_fields (const PackFilter filter)
+{
+  const bool pack_shared     = (filter != PackFilter::NonSharedOnly);
+  const bool pack_non_shared = (filter != PackFilter::SharedOnly);
+
   const auto& ucon = m_connectivity->get_d_ucon();
   const auto& ucon_ptr = m_connectivity->get_d_ucon_ptr();
   // First, pack 2d fields (if any)...
   if (m_num_2d_fields > 0)
     pack(ucon, ucon_ptr, m_2d_fields, m_send_2d_buffers, m_num_elems,
-         m_num_2d_fields);
+         m_num_2d_fields, pack_shared, pack_non_shared);
   // ...then pack 3d fields (if any)...
   if (m_num_3d_fields > 0) {
     if (m_3d_nlev_pack_d.size() > 0)
       pack<NUM_LEV, true>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                          m_num_elems, m_num_3d_fields, &m_3d_nlev_pack_d);
+                          m_num_elems, m_num_3d_fields, pack_shared, pack_non_shared,
+                          &m_3d_nlev_pack_d);
     else
       pack<NUM_LEV>(ucon, ucon_ptr, m_3d_fields, m_send_3d_buffers,
-                    m_num_elems, m_num_3d_fields);
+                    m_num_elems, m_num_3d_fields, pack_shared, pack_non_shared);
   }
   // ...then pack 3d interface fields (if any)
   if (m_num_3d_int_fields > 0)
     pack<NUM_LEV_P>(ucon, ucon_ptr, m_3d_int_fields, m_send_3d_int_buffers,
-                    m_num_elems, m_num_3d_int_fields);
+                    m_num_elems, m_num_3d_int_fields, pack_shared, pack_non_shared);
   Kokkos::fence();
-
-  // ---- Send ---- //
-  tstart("be sync_send_buffer");
-  m_buffers_manager->sync_send_buffer(this); // Deep copy send_buffer into mpi_send_buffer (no op if MPI is on device)
-  tstop("be sync_send_buffer");
-  tstart("be send");
-  if ( ! m_send_requests.empty())
-    HOMMEXX_MPI_CHECK_ERROR(MPI_Startall(m_send_requests.size(), m_send_requests.data()),
-                            m_connectivity->get_comm().mpi_comm());
-
-  // Notify a send is ongoing
-  m_send_pending = true;
-  tstop("be pack_and_send");
 }
 
 void BoundaryExchange::recv_and_unpack () {
@@ -192,6 +192,16 @@ public:
   void exchange ();
   void exchange (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
 
+  // Split-phase version of exchange, to overlap communication with computation.
+  // exchange_start only packs and sends the data of shared connections, so it
+  // can be called as soon as the elements with at least one shared connection
+  // are up to date (see Connectivity::get_halo_and_interior_elements).
+  // exchange_finish packs the remaining connections, then receives and unpacks
+  // everything, so all elements must be up to date by then.
+  void exchange_start ();
+  void exchange_finish ();
+  void exchange_finish (ExecViewUnmanaged<const Real * [NP][NP]> rspheremp);
+
   // Exchange all registered 1d fields, performing min/max operations with neighbors
   void exchange_min_max ();
 
@@ -244,6 +254,16 @@ private:
 
   void build_buffer_views_and_requests ();
 
+  // Which connections to pack. Shared connections are the only ones that
+  // need MPI, so they can be packed (and sent) before the others.
+  enum class PackFilter {
+    All,
+    SharedOnly,
+    NonSharedOnly
+  };
+  void pack_and_send (const PackFilter filter);
+  void pack_fields (const PackFilter filter);
+
   std::shared_ptr<Connectivity>   m_connectivity;
 
   int                       m_elem_buf_size[2];
@@ -301,6 +321,7 @@ private:
   bool        m_cleaned_up;
   bool        m_send_pending;
   bool        m_recv_pending;
+  bool        m_non_shared_pack_pending;
 
   int         m_num_elems;
 
@@ -313,6 +334,7 @@ private:
   void free_requests();
   // Only the impl knows about the raw pointer.
   void exchange(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
+  void exchange_finish(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 public: // This is semantically private but must be public for nvcc.
   void recv_and_unpack(const ExecViewUnmanaged<const Real * [NP][NP]>* rspheremp);
 };
@@ -313,6 +313,28 @@ void Connectivity::setup_ucon () {
   }
 }
 
+void Connectivity::get_halo_and_interior_elements (std::vector<int>& halo, std::vector<int>& interior) const
+{
+  assert (m_finalized);
+
+  halo.clear();
+  interior.clear();
+  for (int ie = 0; ie < m_num_local_elements; ++ie) {
+    bool is_halo = false;
+    for (int k = h_ucon_ptr(ie); k < h_ucon_ptr(ie+1); ++k) {
+      if (h_ucon(k).sharing == etoi(ConnectionSharing::SHARED)) {
+        is_halo = true;
+        break;
+      }
+    }
+    if (is_halo) {
+      halo.push_back(ie);
+    } else {
+      interior.push_back(ie);
+    }
+  }
+}
+
 void Connectivity::clean_up()
 {
   // Cleaning the elements counter
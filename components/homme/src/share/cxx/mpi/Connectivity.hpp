@@ -11,6 +11,8 @@
 #include "Comm.hpp"
 #include "Types.hpp"
 
+#include <vector>
+
 namespace Homme
 {
 struct LidGidPos
@@ -100,6 +102,11 @@ public:
   HostViewUnmanaged<const ConnectionInfo*> get_h_ucon () const { return h_ucon; }
   HostViewUnmanaged<const int*> get_h_ucon_ptr () const { return h_ucon_ptr; }
 
+  // Split the local elements in 'halo' elements (with at least one shared
+  // connection) and 'interior' elements (all others). The data that a boundary
+  // exchange sends to remote processes only depends on halo elements.
+  void get_halo_and_interior_elements (std::vector<int>& halo, std::vector<int>& interior) const;
+
   // Get number of connections with given kind and sharing
   template<typename MemSpace>
   KOKKOS_INLINE_FUNCTION
@@ -28,7 +28,7 @@ extern "C" {
 
 void initialize_dp3d_from_ps_c () {
   // Initialize dp3d from ps
-  GPTLstart("tl-sc dp3d-from-ps");
+  start_timer("tl-sc dp3d-from-ps");
 
   auto& context = Context::singleton();
   auto& tl = context.get<TimeLevel>();
@@ -54,13 +54,13 @@ void initialize_dp3d_from_ps_c () {
     });
   }
   Kokkos::fence();
-  GPTLstop("tl-sc dp3d-from-ps");
+  stop_timer("tl-sc dp3d-from-ps");
 }
 
 void prim_run_subcycle_c (const Real& dt, int& nstep, int& nm1, int& n0, int& np1, 
                           const int& next_output_step, const int& nsplit_iteration)
 {
-  GPTLstart("tl-sc prim_run_subcycle_c");
+  start_timer("tl-sc prim_run_subcycle_c");
 
   auto& context = Context::singleton();
 
@@ -130,13 +130,13 @@ void prim_run_subcycle_c (const Real& dt, int& nstep, int& nm1, int& n0, int& np
     }
 
     // Loop over rsplit vertically lagrangian timesteps
-    GPTLstart("tl-sc prim_step-loop");
+    start_timer("tl-sc prim_step-loop");
     prim_step(dt,compute_diagnostics);
     for (int r=1; r<params.rsplit; ++r) {
       tl.update_dynamics_levels(UpdateType::LEAPFROG);
       prim_step(dt,false);
     }
-    GPTLstop("tl-sc prim_step-loop");
+    stop_timer("tl-sc prim_step-loop");
 
     tl.update_tracers_levels(params.dt_tracer_factor);
 
@@ -150,9 +150,9 @@ void prim_run_subcycle_c (const Real& dt, int& nstep, int& nm1, int& n0, int& np
     // always for tracers
     // if rsplit>0:  also remap dynamics and compute reference level ps_v
     ////////////////////////////////////////////////////////////////////////
-    GPTLstart("tl-sc vertical_remap");
+    start_timer("tl-sc vertical_remap");
     vertical_remap(dt_remap);
-    GPTLstop("tl-sc vertical_remap");
+    stop_timer("tl-sc vertical_remap");
 
     ////////////////////////////////////////////////////////////////////////
     // time step is complete.  update some diagnostic variables:
@@ -177,7 +177,7 @@ void prim_run_subcycle_c (const Real& dt, int& nstep, int& nm1, int& n0, int& np
   n0    = tl.n0;
   np1   = tl.np1;
 
-  GPTLstop("tl-sc prim_run_subcycle_c");
+  stop_timer("tl-sc prim_run_subcycle_c");
 }
 
 } // extern "C"
@@ -27,7 +27,7 @@ static void set_tracer_transport_derived_values (
   // initialize mean flux accumulation variables and save some variables at n0
   // for use by advection
   // ===============
-  GPTLstart("tl-s deep_copy+derived_dp");
+  start_timer("tl-s deep_copy+derived_dp");
   {
     const auto eta_dot_dpdn = elements.m_derived.m_eta_dot_dpdn;
     const auto derived_vn0 = elements.m_derived.m_vn0;
@@ -61,12 +61,12 @@ static void set_tracer_transport_derived_values (
     });
   }
   Kokkos::fence();
-  GPTLstop("tl-s deep_copy+derived_dp");  
+  stop_timer("tl-s deep_copy+derived_dp");  
 }
 
 void prim_step (const Real dt, const bool compute_diagnostics)
 {
-  GPTLstart("tl-s prim_step");
+  start_timer("tl-s prim_step");
   // Get control and simulation params
   SimulationParams& params = Context::singleton().get<SimulationParams>();
   assert(params.params_set);
@@ -82,7 +82,7 @@ void prim_step (const Real dt, const bool compute_diagnostics)
   // ===============
   // Dynamical Step
   // ===============
-  GPTLstart("tl-s prim_advance_exp-loop");
+  start_timer("tl-s prim_advance_exp-loop");
   prim_advance_exp(tl,dt,compute_diagnostics);
   tl.tevolve += dt;
   for (int n=1; n<params.dt_tracer_factor; ++n) {
@@ -90,7 +90,7 @@ void prim_step (const Real dt, const bool compute_diagnostics)
     prim_advance_exp(tl,dt,false);
     tl.tevolve += dt;
   }
-  GPTLstop("tl-s prim_advance_exp-loop");
+  stop_timer("tl-s prim_advance_exp-loop");
 
   // ===============
   // Tracer Advection.
@@ -105,17 +105,17 @@ void prim_step (const Real dt, const bool compute_diagnostics)
   // Advect tracers if their count is > 0.
   // not be advected.  This will be cleaned up when the physgrid is merged into CAM trunk
   // Currently advecting all species
-  GPTLstart("tl-s prim_advec_tracers_remap");
+  start_timer("tl-s prim_advec_tracers_remap");
   if (params.qsize>0) {
     prim_advec_tracers_remap(dt*params.dt_tracer_factor);
   }
-  GPTLstop("tl-s prim_advec_tracers_remap");
-  GPTLstop("tl-s prim_step");
+  stop_timer("tl-s prim_advec_tracers_remap");
+  stop_timer("tl-s prim_step");
 }
 
 void prim_step_flexible (const Real dt, const bool compute_diagnostics) {
 #ifdef MODEL_THETA_L
-  GPTLstart("tl-s prim_step_flexible");
+  start_timer("tl-s prim_step_flexible");
   const auto& context = Context::singleton();
   const SimulationParams& params = context.get<SimulationParams>();
   assert(params.params_set);
@@ -183,9 +183,9 @@ void prim_step_flexible (const Real dt, const bool compute_diagnostics) {
                               Errors::err_not_implemented);
       } else {
         // Remap dynamics variables but not tracers.
-        GPTLstart("tl-sc vertical_remap");
+        start_timer("tl-sc vertical_remap");
         vertical_remap(dt_remap);
-        GPTLstop("tl-sc vertical_remap");
+        stop_timer("tl-sc vertical_remap");
       }
     }
   }
@@ -202,7 +202,7 @@ void prim_step_flexible (const Real dt, const bool compute_diagnostics) {
     Context::singleton().get<ComposeTransport>().remap_q(tl);
 #endif
 
-  GPTLstop("tl-s prim_step_flexible");
+  stop_timer("tl-s prim_step_flexible");
 #else
   Errors::runtime_abort("prim_step_flexible not supported in non-theta-l builds.");
 #endif
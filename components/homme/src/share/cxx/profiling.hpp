@@ -12,14 +12,20 @@
 
 #include "gptl.h"
 
-#ifdef HOMMEXX_ENABLE_GPU
-#define start_timer(name) {}
-#define stop_timer(name) {}
+// On GPU, kernel launches are asynchronous, so a timer only measures launch
+// times, unless HOMMEXX_FENCE_TIMERS is on, in which case the device is fenced
+// before starting/stopping the timer.
+// NOTE: timers are looked up by name. GPTL handles cannot be cached at the call
+//       site, since they are per thread, and they dangle after GPTLfinalize.
+#ifdef HOMMEXX_FENCE_TIMERS
+#define HOMMEXX_TIMER_FENCE() Kokkos::fence()
 #else
-#define start_timer(name) { GPTLstart(name); }
-#define stop_timer(name) { GPTLstop(name); }
+#define HOMMEXX_TIMER_FENCE() {}
 #endif
 
+#define start_timer(name) { HOMMEXX_TIMER_FENCE(); GPTLstart(name); }
+#define stop_timer(name)  { HOMMEXX_TIMER_FENCE(); GPTLstop(name); }
+
 #ifdef VTUNE_PROFILE
 #include <ittnotify.h>
 
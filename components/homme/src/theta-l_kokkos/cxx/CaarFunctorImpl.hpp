@@ -31,6 +31,7 @@
 #include "ErrorDefs.hpp"
 
 #include <assert.h>
+#include <vector>
 
 namespace Homme {
 
@@ -92,6 +93,7 @@ struct CaarFunctorImpl {
   const bool          m_theta_hydrostatic_mode;
   const AdvectionForm m_theta_advection_form;
   const bool          m_pgrad_correction;
+  const bool          m_bexch_overlap;
 
   HybridVCoord          m_hvcoord;
   ElementsState         m_state;
@@ -104,6 +106,7 @@ struct CaarFunctorImpl {
   SphereOperators       m_sphere_ops;
 
   struct TagPreExchange {};
+  struct TagPreExchangeSubset {};
   struct TagPostExchange {};
 
   // Policies
@@ -123,6 +126,15 @@ struct CaarFunctorImpl {
 
   Kokkos::Array<std::shared_ptr<BoundaryExchange>, NUM_TIME_LEVELS> m_bes;
 
+  // If m_bexch_overlap is true, the pre-exchange loop is split in two: first we
+  // process the elements with shared connections (halo), then we start the
+  // exchange, and process the remaining elements (interior) while MPI messages
+  // are in flight. m_elem_subset is the list of element ids processed by
+  // TagPreExchangeSubset, and is set to one of the two lists before each launch.
+  ExecViewManaged<int*>             m_halo_elems;
+  ExecViewManaged<int*>             m_interior_elems;
+  ExecViewUnmanaged<const int*>     m_elem_subset;
+
   CaarFunctorImpl(const Elements &elements, const Tracers &/* tracers */,
                   const ReferenceElement &ref_FE, const HybridVCoord &hvcoord,
                   const SphereOperators &sphere_ops, const SimulationParams& params)
@@ -131,6 +143,7 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
+      , m_bexch_overlap(params.bexch_overlap)
       , m_hvcoord(hvcoord)
       , m_state(elements.m_state)
       , m_derived(elements.m_derived)
@@ -154,6 +167,7 @@ struct CaarFunctorImpl {
       , m_theta_hydrostatic_mode(params.theta_hydrostatic_mode)
       , m_theta_advection_form(params.theta_adv_form)
       , m_pgrad_correction(params.pgrad_correction)
+      , m_bexch_overlap(params.bexch_overlap)
       , m_policy_pre (Homme::get_default_team_policy<ExecSpace,TagPreExchange>(m_num_elems))
       , m_policy_post (0,num_elems*NP*NP)
       , m_tu(m_policy_pre)
@@ -323,6 +337,27 @@ struct CaarFunctorImpl {
       }
       be.registration_completed();
     }
+
+    if (m_bexch_overlap) {
+      std::vector<int> halo, interior;
+      bm_exchange->get_connectivity()->get_halo_and_interior_elements(halo,interior);
+      m_halo_elems = ExecViewManaged<int*>("caar halo elems",halo.size());
+      m_interior_elems = ExecViewManaged<int*>("caar interior elems",interior.size());
+      Kokkos::deep_copy(m_halo_elems,HostViewUnmanaged<const int*>(halo.data(),halo.size()));
+      Kokkos::deep_copy(m_interior_elems,HostViewUnmanaged<const int*>(interior.data(),interior.size()));
+    }
+  }
+
+  // Same team size and vector length as m_policy_pre, so that m_tu and the
+  // buffers (sized after m_policy_pre) can be used with these policies too
+  TeamPolicyType<TagPreExchangeSubset> get_subset_policy (const int num_subset_elems) const {
+    const auto threads_vectors =
+      DefaultThreadsDistribution<ExecSpace>::team_num_threads_vectors(m_num_elems);
+    TeamPolicyType<TagPreExchangeSubset> policy(num_subset_elems,
+                                                threads_vectors.first,
+                                                threads_vectors.second);
+    policy.set_chunk_size(1);
+    return policy;
   }
 
   void set_rk_stage_data (const RKStageData& data) {
@@ -345,18 +380,22 @@ struct CaarFunctorImpl {
 
     profiling_resume();
 
-    GPTLstart("caar compute");
-    int nerr;
-    Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
-    Kokkos::fence();
-    GPTLstop("caar compute");
-    if (nerr > 0)
-      check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
+    if (m_bexch_overlap) {
+      run_pre_exchange_overlapped(data);
+    } else {
+      GPTLstart("caar compute");
+      int nerr;
+      Kokkos::parallel_reduce("caar loop pre-boundary exchange", m_policy_pre, *this, nerr);
+      Kokkos::fence();
+      GPTLstop("caar compute");
+      if (nerr > 0)
+        check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchange", data.n0);
 
-    GPTLstart("caar_bexchV");
-    m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
-    Kokkos::fence();
-    GPTLstop("caar_bexchV");
+      GPTLstart("caar_bexchV");
+      m_bes[data.np1]->exchange(m_geometry.m_rspheremp);
+      Kokkos::fence();
+      GPTLstop("caar_bexchV");
+    }
 
     if (!m_theta_hydrostatic_mode) {
       GPTLstart("caar compute");
@@ -370,12 +409,58 @@ struct CaarFunctorImpl {
     profiling_pause();
   }
 
+  void run_pre_exchange_overlapped (const RKStageData& data)
+  {
+    auto& be = *m_bes[data.np1];
+    int nerr;
+
+    // Halo elements first, so we can get the MPI messages going
+    GPTLstart("caar compute");
+    m_elem_subset = m_halo_elems;
+    Kokkos::parallel_reduce("caar loop pre-boundary exchange (halo)",
+                            get_subset_policy(m_halo_elems.extent_int(0)), *this, nerr);
+    Kokkos::fence();
+    GPTLstop("caar compute");
+    if (nerr > 0)
+      check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchangeSubset (halo)", data.n0);
+
+    GPTLstart("caar_bexchV");
+    be.exchange_start();
+    GPTLstop("caar_bexchV");
+
+    // Interior elements, while halo data is in flight
+    GPTLstart("caar compute");
+    m_elem_subset = m_interior_elems;
+    Kokkos::parallel_reduce("caar loop pre-boundary exchange (interior)",
+                            get_subset_policy(m_interior_elems.extent_int(0)), *this, nerr);
+    Kokkos::fence();
+    GPTLstop("caar compute");
+    if (nerr > 0)
+      check_print_abort_on_bad_elems("CaarFunctorImpl::run TagPreExchangeSubset (interior)", data.n0);
+
+    GPTLstart("caar_bexchV");
+    be.exchange_finish(m_geometry.m_rspheremp);
+    Kokkos::fence();
+    GPTLstop("caar_bexchV");
+  }
+
   KOKKOS_INLINE_FUNCTION
   void operator()(const TagPreExchange&, const TeamMember &team, int& nerr) const {
-    // In this body, we use '====' to separate sync epochs (delimited by barriers)
-    // Note: make sure the same temp is not used within each epoch!
+    KernelVariables kv(team, m_tu);
+    compute_pre_exchange(kv, nerr);
+  }
 
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TagPreExchangeSubset&, const TeamMember &team, int& nerr) const {
     KernelVariables kv(team, m_tu);
+    kv.ie = m_elem_subset(team.league_rank());
+    compute_pre_exchange(kv, nerr);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void compute_pre_exchange (KernelVariables& kv, int& nerr) const {
+    // In this body, we use '====' to separate sync epochs (delimited by barriers)
+    // Note: make sure the same temp is not used within each epoch!
 
     // =========== EPOCH 1 =========== //
     compute_div_vdp(kv);